@@ -0,0 +1,511 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <math.h>
+#include <time.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define WARMUP_FRAMES 60
+#define SPRITE_COUNT 50000
+#define SPRITE_TEXTURES 4
+#define UPLOAD_SIZE 256
+#define UPLOADS_PER_FRAME 8
+#define RECORD_CHUNKS 64
+#define RECORD_TILES 2000 // Per Chunk
+#define SHAPE_COUNT 20000 // A Quarter Each Of Rects, Lines, Circles And Hexagons
+#define WORLD_SPRITES 200000 // Spread Over WORLD_SCALE x WORLD_SCALE Screens
+#define WORLD_SCALE 12
+#define TEXT_LABELS 3000 // About 14 Glyphs Each, Under SPRITE_COUNT
+#define TEXT_CHANGING 16 // One In This Many Labels Gets A New String Every Frame
+
+// Runs Each Scenario For A Fixed Number Of Frames In Its Own Context And
+// Prints One JSON Document With Throughput And Per Frame CPU Time Percentiles
+//
+// Usage: bench [--frames N] [--scenario NAME] [--windowed] [--out FILE] [--font FILE]
+//
+// The Text Scenario Needs A TrueType Font And Is Skipped Without --font
+
+typedef struct {
+	const char* name;
+	void (*setup)(OGContext*);
+	void (*before)(OGContext*); // Runs Ahead Of Every og_render, Outside The Frame
+	void (*render)(OGContext*);
+	void (*teardown)(OGContext*);
+	uint32_t job_threads;
+	bool needs_font;
+} Scenario;
+
+typedef struct {
+	const char* name;
+	uint32_t frames;
+	double seconds;
+	double fps;
+	double cpu_ms_avg;
+	double cpu_ms_p50;
+	double cpu_ms_p99;
+	double mb_per_sec; // Upload Scenario Only
+	uint32_t binds; // Sprite Texture Binds In The Last Frame
+	uint32_t binds_unsorted; // The Same Frame Replayed In Submission Order
+} Result;
+
+double now_ms();
+int compare_doubles(const void *a, const void *b);
+bool run(const Scenario *scenario, uint32_t frames, bool windowed, Result *out, char *device);
+
+void render_empty(OGContext *og_ctx);
+void render_clear(OGContext *og_ctx);
+void setup_sprites(OGContext *og_ctx);
+void render_sprites(OGContext *og_ctx);
+void teardown_sprites(OGContext *og_ctx);
+void setup_upload(OGContext *og_ctx);
+void render_upload(OGContext *og_ctx);
+void teardown_upload(OGContext *og_ctx);
+void render_record(OGContext *og_ctx);
+void render_shapes(OGContext *og_ctx);
+void setup_entities(OGContext *og_ctx);
+void render_entities(OGContext *og_ctx);
+void teardown_entities(OGContext *og_ctx);
+void setup_world(OGContext *og_ctx);
+void render_world(OGContext *og_ctx);
+void teardown_world(OGContext *og_ctx);
+void setup_text(OGContext *og_ctx);
+void render_text(OGContext *og_ctx);
+void teardown_text(OGContext *og_ctx);
+void before_resize(OGContext *og_ctx);
+void record_chunk(OGContext *og_ctx, VkCommandBuffer cmd_buffer, uint32_t chunk, void* data);
+
+static OGTexture* textures[SPRITE_TEXTURES];
+static OGImage upload_targets[UPLOADS_PER_FRAME];
+static uint8_t* upload_pixels;
+static uint64_t uploaded_bytes;
+static OGEntityStore* entities;
+static OGSpatialGrid* world;
+static uint32_t* visible;
+static uint32_t world_frame;
+static const char* font_path;
+static OGFont* font;
+static uint32_t text_frame;
+
+static const Scenario scenarios[] = {
+	{ .name = "empty", .render = render_empty },
+	{ .name = "clear", .render = render_clear },
+	{ .name = "sprites", .setup = setup_sprites, .render = render_sprites, .teardown = teardown_sprites },
+	{ .name = "entities", .setup = setup_entities, .render = render_entities, .teardown = teardown_entities },
+	{ .name = "sprites_culled", .setup = setup_world, .render = render_world, .teardown = teardown_world },
+	{ .name = "shapes", .render = render_shapes },
+	{ .name = "text", .setup = setup_text, .render = render_text, .teardown = teardown_text, .needs_font = true },
+	{ .name = "upload", .setup = setup_upload, .render = render_upload, .teardown = teardown_upload },
+	{ .name = "record_serial", .render = render_record },
+	{ .name = "record_parallel", .render = render_record, .job_threads = OG_JOBS_AUTO },
+	{ .name = "resize", .before = before_resize, .render = render_clear },
+};
+
+int main(int argc, char **argv) {
+	uint32_t frames = 1000;
+	const char* only = NULL;
+	const char* out_path = NULL;
+	bool windowed = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+			frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+		} else if (!strcmp(argv[i], "--scenario") && i + 1 < argc) {
+			only = argv[++i];
+		} else if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+			out_path = argv[++i];
+		} else if (!strcmp(argv[i], "--font") && i + 1 < argc) {
+			font_path = argv[++i];
+		} else if (!strcmp(argv[i], "--windowed")) {
+			windowed = true;
+		}
+	}
+
+	Result results[OG_ARR_SIZE(scenarios)];
+	uint32_t result_count = 0;
+	char device[VK_MAX_PHYSICAL_DEVICE_NAME_SIZE] = "unknown";
+
+	for (uint32_t i = 0; i < OG_ARR_SIZE(scenarios); i++) {
+		if (only && strcmp(only, scenarios[i].name)) {
+			continue;
+		}
+		if (scenarios[i].needs_font && !font_path) {
+			fprintf(stderr, "[BENCH]: Skipping %s, No --font Given\n", scenarios[i].name);
+			continue;
+		}
+		if (run(&scenarios[i], frames, windowed, &results[result_count], device)) {
+			result_count++;
+		}
+	}
+
+	FILE *file = out_path ? fopen(out_path, "w") : stdout;
+	if (!file) {
+		OG_LOG_ERR("Bench Output Could Not Be Opened");
+		return 1;
+	}
+
+	fprintf(file, "{\n\t\"device\": \"%s\",\n\t\"width\": %d,\n\t\"height\": %d,\n\t\"windowed\": %s,\n\t\"results\": [",
+			device, WIDTH, HEIGHT, windowed ? "true" : "false");
+	for (uint32_t i = 0; i < result_count; i++) {
+		Result *r = &results[i];
+		fprintf(file, "%s\n\t\t{\"scenario\": \"%s\", \"frames\": %u, \"seconds\": %.4f, \"fps\": %.2f, "
+				"\"cpu_ms_avg\": %.4f, \"cpu_ms_p50\": %.4f, \"cpu_ms_p99\": %.4f, \"mb_per_sec\": %.2f, "
+				"\"binds\": %u, \"binds_unsorted\": %u}",
+				i ? "," : "", r->name, r->frames, r->seconds, r->fps,
+				r->cpu_ms_avg, r->cpu_ms_p50, r->cpu_ms_p99, r->mb_per_sec, r->binds, r->binds_unsorted);
+	}
+	fprintf(file, "\n\t]\n}\n");
+
+	if (out_path) {
+		fclose(file);
+	}
+	return result_count ? 0 : 1;
+}
+
+double now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+int compare_doubles(const void *a, const void *b) {
+	double da = *(const double*)a;
+	double db = *(const double*)b;
+	return (da > db) - (da < db);
+}
+
+bool run(const Scenario *scenario, uint32_t frames, bool windowed, Result *out, char *device) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Origami Bench",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = !windowed,
+		.max_sprites = SPRITE_COUNT,
+		.job_threads = scenario->job_threads,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(p_ctx->physical_device, &pd_props);
+	snprintf(device, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE, "%s", pd_props.deviceName);
+
+	if (scenario->setup) {
+		scenario->setup(p_ctx);
+	}
+
+	for (uint32_t i = 0; i < WARMUP_FRAMES && p_ctx->running; i++) {
+		og_poll_events(p_ctx);
+		if (scenario->before) {
+			scenario->before(p_ctx);
+		}
+		og_render(p_ctx, scenario->render);
+	}
+	OG_CHECK_VK(vkDeviceWaitIdle(p_ctx->logical_device), "Device Wait Idle Failed");
+	uploaded_bytes = 0;
+
+	double* samples = malloc(sizeof(double) * frames);
+	uint32_t done = 0;
+
+	double start = now_ms();
+	while (done < frames && p_ctx->running) {
+		double frame_start = now_ms();
+		og_poll_events(p_ctx);
+		if (scenario->before) {
+			scenario->before(p_ctx);
+		}
+		og_render(p_ctx, scenario->render);
+		samples[done++] = now_ms() - frame_start;
+	}
+
+	// Throughput Counts Until The GPU Has Actually Finished The Last Frame
+	OG_CHECK_VK(vkDeviceWaitIdle(p_ctx->logical_device), "Device Wait Idle Failed");
+	double elapsed = now_ms() - start;
+	uint32_t binds = p_ctx->sprites.binds;
+	uint32_t binds_unsorted = p_ctx->sprites.binds_unsorted;
+
+	if (scenario->teardown) {
+		scenario->teardown(p_ctx);
+	}
+	og_quit(p_ctx);
+
+	if (!done) {
+		free(samples);
+		return false;
+	}
+
+	double sum = 0.0;
+	for (uint32_t i = 0; i < done; i++) {
+		sum += samples[i];
+	}
+	qsort(samples, done, sizeof(double), compare_doubles);
+
+	out->name = scenario->name;
+	out->frames = done;
+	out->seconds = elapsed / 1000.0;
+	out->fps = done / out->seconds;
+	out->cpu_ms_avg = sum / done;
+	out->cpu_ms_p50 = samples[(done - 1) / 2];
+	out->cpu_ms_p99 = samples[(done - 1) * 99 / 100];
+	out->mb_per_sec = uploaded_bytes / (1024.0 * 1024.0) / out->seconds;
+	out->binds = binds;
+	out->binds_unsorted = binds_unsorted;
+
+	free(samples);
+	return true;
+}
+
+
+void render_empty(OGContext *og_ctx) {
+	(void)og_ctx;
+}
+
+void render_clear(OGContext *og_ctx) {
+	OGColor color = {{1, 0, 0, 1}};
+	og_clear_screen(og_ctx, color);
+}
+
+void setup_sprites(OGContext *og_ctx) {
+	uint32_t pixels[16 * 16];
+	for (uint32_t t = 0; t < SPRITE_TEXTURES; t++) {
+		for (uint32_t i = 0; i < 16 * 16; i++) {
+			pixels[i] = 0xff000000u | (0x3f << (t * 6 % 24)) | (i * 0x010101u);
+		}
+		textures[t] = og_create_texture(og_ctx, 16, 16, pixels);
+		og_upload_wait(og_ctx, textures[t]->upload);
+	}
+}
+
+// Fixed Layout So Every Run Draws The Same Frames
+void render_sprites(OGContext *og_ctx) {
+	for (uint32_t i = 0; i < SPRITE_COUNT; i++) {
+		OGSprite sprite = {
+			.x = (float)((i * 37) % WIDTH),
+			.y = (float)((i * 91) % HEIGHT),
+			.w = 8.0f,
+			.h = 8.0f,
+			.rotation = (float)(i % 628) / 100.0f,
+			.color = {{1, 1, 1, 1}},
+			.texture = textures[i % SPRITE_TEXTURES],
+			.layer = i % 4,
+		};
+		og_draw_sprite(og_ctx, &sprite);
+	}
+}
+
+void teardown_sprites(OGContext *og_ctx) {
+	for (uint32_t t = 0; t < SPRITE_TEXTURES; t++) {
+		og_destroy_texture(og_ctx, textures[t]);
+	}
+}
+
+// The Sprites Scenario Again, Kept In An Entity Store Instead Of Built Every Frame
+void setup_entities(OGContext *og_ctx) {
+	setup_sprites(og_ctx);
+
+	entities = og_create_entity_store(SPRITE_COUNT);
+	for (uint32_t i = 0; i < SPRITE_COUNT; i++) {
+		OGEntity entity = og_entity_create(entities, textures[i % SPRITE_TEXTURES], i % 4);
+		og_entity_set_transform(entities, entity, (float)((i * 37) % WIDTH), (float)((i * 91) % HEIGHT),
+				(float)(i % 628) / 100.0f, 8.0f, 8.0f);
+	}
+}
+
+// Spins Everything By Walking The Rotation Arrays, Then Draws The Whole Store
+void render_entities(OGContext *og_ctx) {
+	for (uint32_t g = 0; g < entities->group_count; g++) {
+		OGEntityGroup *group = &entities->groups[g];
+		for (uint32_t i = 0; i < group->count; i++) {
+			group->rotation[i] += 0.01f;
+		}
+	}
+	og_draw_entities(og_ctx, entities, 0.0f, 0.0f, 1.0f);
+}
+
+void teardown_entities(OGContext *og_ctx) {
+	teardown_sprites(og_ctx);
+	og_destroy_entity_store(entities);
+}
+
+void setup_world(OGContext *og_ctx) {
+	setup_sprites(og_ctx);
+
+	world = og_create_spatial_grid(64.0f, WORLD_SPRITES);
+	visible = malloc(WORLD_SPRITES * sizeof(uint32_t));
+	world_frame = 0;
+
+	for (uint32_t i = 0; i < WORLD_SPRITES; i++) {
+		float x = (float)((i * 7919u) % (WIDTH * WORLD_SCALE));
+		float y = (float)((i * 104729u) % (HEIGHT * WORLD_SCALE));
+		og_spatial_insert(world, x, y, x + 16.0f, y + 16.0f, i);
+	}
+}
+
+// Every Sprite Drifts Each Frame, Only What The Panning Camera Sees Is Drawn.
+// Handles On A Fresh Grid Come Out In Insert Order, So They Double As Indices
+void render_world(OGContext *og_ctx) {
+	float offset = (float)(world_frame % 256);
+	for (uint32_t i = 0; i < WORLD_SPRITES; i++) {
+		float x = (float)((i * 7919u) % (WIDTH * WORLD_SCALE)) + offset;
+		float y = (float)((i * 104729u) % (HEIGHT * WORLD_SCALE));
+		og_spatial_move(world, i, x, y, x + 16.0f, y + 16.0f);
+	}
+
+	float cam_x = (float)(world_frame * 4 % (WIDTH * (WORLD_SCALE - 1)));
+	float cam_y = (float)(world_frame * 2 % (HEIGHT * (WORLD_SCALE - 1)));
+	uint32_t count = og_spatial_query(world, cam_x, cam_y, cam_x + WIDTH, cam_y + HEIGHT, visible, WORLD_SPRITES);
+
+	for (uint32_t v = 0; v < count && v < WORLD_SPRITES; v++) {
+		uint32_t i = visible[v];
+		const OGSpatialItem *item = &world->items[i];
+		OGSprite sprite = {
+			.x = item->min_x - cam_x + 8.0f,
+			.y = item->min_y - cam_y + 8.0f,
+			.w = 16.0f,
+			.h = 16.0f,
+			.color = {{1, 1, 1, 1}},
+			.texture = textures[i % SPRITE_TEXTURES],
+		};
+		og_draw_sprite(og_ctx, &sprite);
+	}
+	world_frame++;
+}
+
+void teardown_world(OGContext *og_ctx) {
+	teardown_sprites(og_ctx);
+	og_destroy_spatial_grid(world);
+	free(visible);
+}
+
+void render_shapes(OGContext *og_ctx) {
+	OGColor color = {{0, 1, 0, 0.5f}};
+
+	for (uint32_t i = 0; i < SHAPE_COUNT / 4; i++) {
+		float x = (float)((i * 37) % WIDTH);
+		float y = (float)((i * 91) % HEIGHT);
+
+		float hexagon[12];
+		for (uint32_t k = 0; k < 6; k++) {
+			hexagon[k * 2] = x + 6.0f * cosf((float)k * 1.0472f);
+			hexagon[k * 2 + 1] = y + 6.0f * sinf((float)k * 1.0472f);
+		}
+
+		og_draw_rect(og_ctx, x, y, 8.0f, 8.0f, color);
+		og_draw_line(og_ctx, x, y, x + 20.0f, y + 10.0f, 2.0f, color);
+		og_draw_circle(og_ctx, x, y, 3.0f + (float)(i % 8), color);
+		og_draw_polygon(og_ctx, hexagon, 6, color);
+	}
+}
+
+void setup_text(OGContext *og_ctx) {
+	font = og_load_font(og_ctx, font_path);
+	text_frame = 0;
+}
+
+// Thousands Of Short Labels, A Few Of Them Changing Every Frame Like Damage Numbers
+void render_text(OGContext *og_ctx) {
+	OGColor color = {{1, 1, 1, 1}};
+	char label[32];
+
+	if (!font) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < TEXT_LABELS; i++) {
+		uint32_t value = i % TEXT_CHANGING ? i : i + text_frame;
+		snprintf(label, sizeof(label), "Unit %u: %u HP", i, value % 1000);
+		og_draw_text(og_ctx, font, label, (float)((i * 37) % WIDTH), (float)((i * 91) % HEIGHT),
+				8.0f + (float)(i % 4) * 4.0f, color);
+	}
+	text_frame++;
+}
+
+void teardown_text(OGContext *og_ctx) {
+	if (font) {
+		og_destroy_font(og_ctx, font);
+	}
+}
+
+void setup_upload(OGContext *og_ctx) {
+	VkImageCreateInfo img_create_info = {};
+	img_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	img_create_info.imageType = VK_IMAGE_TYPE_2D;
+	img_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+	img_create_info.extent.width = UPLOAD_SIZE;
+	img_create_info.extent.height = UPLOAD_SIZE;
+	img_create_info.extent.depth = 1;
+	img_create_info.mipLevels = 1;
+	img_create_info.arrayLayers = 1;
+	img_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+	img_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	img_create_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	img_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	if (og_ctx->upload.concurrent) {
+		img_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		img_create_info.queueFamilyIndexCount = 2;
+		img_create_info.pQueueFamilyIndices = og_ctx->upload.families;
+	}
+
+	for (uint32_t i = 0; i < UPLOADS_PER_FRAME; i++) {
+		og_create_image(og_ctx, &img_create_info, OG_MEMORY_GPU_ONLY, &upload_targets[i]);
+	}
+
+	upload_pixels = malloc(UPLOAD_SIZE * UPLOAD_SIZE * 4);
+	for (uint32_t i = 0; i < UPLOAD_SIZE * UPLOAD_SIZE * 4; i++) {
+		upload_pixels[i] = (uint8_t)(i * 31);
+	}
+}
+
+// Every Target Is Overwritten Each Frame, Only The Copies Themselves Are Measured
+void render_upload(OGContext *og_ctx) {
+	for (uint32_t i = 0; i < UPLOADS_PER_FRAME; i++) {
+		og_upload_image(og_ctx, upload_targets[i].image, UPLOAD_SIZE, UPLOAD_SIZE, upload_pixels);
+		uploaded_bytes += UPLOAD_SIZE * UPLOAD_SIZE * 4;
+	}
+}
+
+void teardown_upload(OGContext *og_ctx) {
+	og_upload_wait(og_ctx, og_upload_flush(og_ctx));
+	for (uint32_t i = 0; i < UPLOADS_PER_FRAME; i++) {
+		og_destroy_image(og_ctx, &upload_targets[i]);
+	}
+	free(upload_pixels);
+}
+
+// Same Commands Either Way, Only The Number Of Recording Threads Changes
+void render_record(OGContext *og_ctx) {
+	og_record_parallel(og_ctx, RECORD_CHUNKS, record_chunk, NULL);
+}
+
+void record_chunk(OGContext *og_ctx, VkCommandBuffer cmd_buffer, uint32_t chunk, void* data) {
+	(void)og_ctx;
+	(void)data;
+	uint32_t band = HEIGHT / RECORD_CHUNKS;
+
+	for (uint32_t i = 0; i < RECORD_TILES; i++) {
+		VkClearAttachment clear_attachment = {};
+		clear_attachment.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		clear_attachment.clearValue.color.float32[0] = (float)chunk / RECORD_CHUNKS;
+		clear_attachment.clearValue.color.float32[3] = 1.0f;
+
+		VkClearRect clear_rect = {};
+		clear_rect.rect.offset.x = (int32_t)((i * 4) % (WIDTH - 4));
+		clear_rect.rect.offset.y = (int32_t)(chunk * band);
+		clear_rect.rect.extent.width = 4;
+		clear_rect.rect.extent.height = band;
+		clear_rect.layerCount = 1;
+
+		vkCmdClearAttachments(cmd_buffer, 1, &clear_attachment, 1, &clear_rect);
+	}
+}
+
+// Alternates Between Two Sizes So Every Frame Rebuilds Its Targets, Headless Or
+// The Whole Swapchain When Run With --windowed
+void before_resize(OGContext *og_ctx) {
+	static uint32_t flip = 0;
+	flip ^= 1;
+	og_resize(og_ctx, flip ? WIDTH - 256 : WIDTH, flip ? HEIGHT - 144 : HEIGHT);
+}
@@ -0,0 +1,102 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <time.h>
+
+#define ENTITIES 100000
+#define TEXTURES 4
+#define PASSES 200
+
+// Times Getting Entities Into The Sprite Batch, Without A Device: Once Through
+// og_draw_sprite Per Entity, Gathering Each One's Components Into An OGSprite,
+// And Once Through og_draw_entities Straight From The Component Arrays
+//
+// Usage: entities [--passes N]
+
+double now_ms();
+void draw_each(OGContext *og_ctx, OGEntityStore *store);
+
+static OGTexture textures[TEXTURES];
+
+int main(int argc, char **argv) {
+	uint32_t passes = PASSES;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--passes") && i + 1 < argc) {
+			passes = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+	}
+
+	// Only The Batch's CPU Side Is Set Up, Nothing Here Touches Vulkan
+	static OGContext ctx = {};
+	static OGTexture white = {};
+	__init_sprite_arena(&ctx.sprites, ENTITIES);
+	ctx.sprites.white = &white;
+	for (uint32_t t = 0; t < TEXTURES; t++) {
+		textures[t].id = t + 1;
+	}
+
+	OGEntityStore *store = og_create_entity_store(ENTITIES);
+	for (uint32_t i = 0; i < ENTITIES; i++) {
+		OGEntity entity = og_entity_create(store, &textures[i % TEXTURES], i % 2);
+		og_entity_set_transform(store, entity, (float)(i % 1280), (float)(i % 720), (float)i * 0.01f, 8.0f, 8.0f);
+	}
+
+	printf("{\n\t\"simd\": %s,\n\t\"entities\": %u,\n\t\"results\": [",
+#if defined(__SSE2__)
+			"\"sse2\""
+#else
+			"null"
+#endif
+			, ENTITIES);
+
+	for (uint32_t k = 0; k < 2; k++) {
+		double start = now_ms();
+		for (uint32_t p = 0; p < passes; p++) {
+			if (k == 0) {
+				draw_each(&ctx, store);
+			} else {
+				og_draw_entities(&ctx, store, 0.0f, 0.0f, 1.0f);
+			}
+			ctx.sprites.count = 0;
+			ctx.sprites.run_count = 0;
+		}
+		double seconds = (now_ms() - start) / 1000.0;
+		double entities = (double)ENTITIES * passes;
+
+		printf("%s\n\t\t{\"path\": \"%s\", \"entities_per_sec\": %.0f, \"ns_per_entity\": %.2f}",
+				k ? "," : "", k ? "og_draw_entities" : "og_draw_sprite", entities / seconds, seconds * 1e9 / entities);
+	}
+	printf("\n\t]\n}\n");
+
+	og_destroy_entity_store(store);
+	return 0;
+}
+
+double now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// What A Game Without The Store Does, One Gathered Sprite At A Time
+void draw_each(OGContext *og_ctx, OGEntityStore *store) {
+	for (uint32_t g = 0; g < store->group_count; g++) {
+		OGEntityGroup *group = &store->groups[g];
+
+		for (uint32_t i = 0; i < group->count; i++) {
+			uint32_t color = group->color[i];
+			OGSprite sprite = {
+				.x = group->x[i],
+				.y = group->y[i],
+				.w = group->scale_x[i],
+				.h = group->scale_y[i],
+				.rotation = group->rotation[i],
+				.color = {{ (color & 0xFF) / 255.0f, (color >> 8 & 0xFF) / 255.0f,
+					(color >> 16 & 0xFF) / 255.0f, (color >> 24) / 255.0f }},
+				.texture = group->texture,
+				.layer = group->layer,
+			};
+			og_draw_sprite(og_ctx, &sprite);
+		}
+	}
+}
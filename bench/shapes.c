@@ -0,0 +1,125 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <math.h>
+#include <time.h>
+
+#define SHAPES 10000 // Per Pass, One Pass Fills The Arena Once
+#define PASSES 500
+#define ARENA_VERTICES (1 << 20)
+
+// Times Only CPU Tessellation Into The Shape Arena, Without A Device Or Any
+// Rendering, And Prints Shapes And Vertices Per Second For Each Kind Of Shape
+//
+// Usage: shapes [--passes N]
+
+typedef struct {
+	const char* name;
+	void (*draw)(OGContext*, uint32_t);
+} Kernel;
+
+double now_ms();
+void draw_rects(OGContext *og_ctx, uint32_t i);
+void draw_lines(OGContext *og_ctx, uint32_t i);
+void draw_small_circles(OGContext *og_ctx, uint32_t i);
+void draw_large_circles(OGContext *og_ctx, uint32_t i);
+void draw_polygons(OGContext *og_ctx, uint32_t i);
+
+static const OGColor color = {{1, 0.5f, 0, 1}};
+static float polygon[16 * 2];
+
+static const Kernel kernels[] = {
+	{ "rect", draw_rects },
+	{ "line", draw_lines },
+	{ "circle_r8", draw_small_circles },
+	{ "circle_r200", draw_large_circles },
+	{ "polygon_16", draw_polygons },
+};
+
+int main(int argc, char **argv) {
+	uint32_t passes = PASSES;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--passes") && i + 1 < argc) {
+			passes = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+	}
+
+	for (uint32_t k = 0; k < 16; k++) {
+		polygon[k * 2] = 100.0f + 40.0f * cosf((float)k * 0.3927f);
+		polygon[k * 2 + 1] = 100.0f + 40.0f * sinf((float)k * 0.3927f);
+	}
+
+	// Only The Arena Is Set Up, Nothing Here Touches Vulkan
+	static OGContext ctx = {};
+	__init_shape_arena(&ctx.shapes, ARENA_VERTICES);
+
+	printf("{\n\t\"simd\": %s,\n\t\"results\": [",
+#if defined(__SSE2__)
+			"\"sse2\""
+#else
+			"null"
+#endif
+			);
+
+	for (uint32_t k = 0; k < OG_ARR_SIZE(kernels); k++) {
+		uint64_t vertices = 0;
+		uint64_t indices = 0;
+
+		// One Untimed Pass Faults The Arena In
+		for (uint32_t i = 0; i < SHAPES; i++) {
+			kernels[k].draw(&ctx, i);
+		}
+		_reset_shapes(&ctx);
+
+		double start = now_ms();
+		for (uint32_t p = 0; p < passes; p++) {
+			for (uint32_t i = 0; i < SHAPES; i++) {
+				kernels[k].draw(&ctx, i);
+			}
+			vertices += ctx.shapes.vertex_count;
+			indices += ctx.shapes.index_count;
+			_reset_shapes(&ctx);
+		}
+		double seconds = (now_ms() - start) / 1000.0;
+
+		double shapes = (double)SHAPES * passes;
+		double bytes = (double)vertices * sizeof(OGShapeVertex) + (double)indices * sizeof(uint32_t);
+		printf("%s\n\t\t{\"kernel\": \"%s\", \"shapes_per_sec\": %.0f, \"ns_per_shape\": %.2f, "
+				"\"mverts_per_sec\": %.2f, \"mb_per_sec\": %.2f}",
+				k ? "," : "", kernels[k].name, shapes / seconds, seconds * 1e9 / shapes,
+				vertices / seconds / 1e6, bytes / seconds / (1024.0 * 1024.0));
+	}
+	printf("\n\t]\n}\n");
+
+	free(ctx.shapes.vertices);
+	free(ctx.shapes.indices);
+	return 0;
+}
+
+double now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+void draw_rects(OGContext *og_ctx, uint32_t i) {
+	og_draw_rect(og_ctx, (float)(i % 1280), (float)(i % 720), 8.0f, 8.0f, color);
+}
+
+void draw_lines(OGContext *og_ctx, uint32_t i) {
+	float x = (float)(i % 1280);
+	og_draw_line(og_ctx, x, 0.0f, x + 30.0f, 700.0f, 1.5f, color);
+}
+
+void draw_small_circles(OGContext *og_ctx, uint32_t i) {
+	og_draw_circle(og_ctx, (float)(i % 1280), (float)(i % 720), 8.0f, color);
+}
+
+void draw_large_circles(OGContext *og_ctx, uint32_t i) {
+	og_draw_circle(og_ctx, (float)(i % 1280), (float)(i % 720), 200.0f, color);
+}
+
+void draw_polygons(OGContext *og_ctx, uint32_t i) {
+	(void)i;
+	og_draw_polygon(og_ctx, polygon, 16, color);
+}
@@ -0,0 +1,134 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <time.h>
+
+#define ENTITIES 200000
+#define WORLD 16384.0f // Square, In Pixels
+#define CELL 64.0f
+#define VIEW_W 1280.0f
+#define VIEW_H 720.0f
+#define MOVE_PASSES 50
+#define QUERIES 2000
+#define LARGE_EVERY 1000 // One Entity In This Many Is Bigger Than A Cell
+
+// Times The Spatial Grid Alone, Without A Device: Inserting ENTITIES Boxes,
+// Moving All Of Them A Few Pixels Per Pass And Querying Screen Sized Views,
+// Checked Against A Brute Force Scan. Prints One JSON Document
+//
+// Usage: spatial [--entities N]
+
+typedef struct {
+	float x, y, w, h;
+	float vx, vy;
+} Entity;
+
+double now_ms();
+float rand_unit(uint32_t *state);
+
+int main(int argc, char **argv) {
+	uint32_t count = ENTITIES;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--entities") && i + 1 < argc) {
+			count = (uint32_t)strtoul(argv[++i], NULL, 10);
+		}
+	}
+
+	uint32_t seed = 1;
+	Entity *entities = malloc(count * sizeof(Entity));
+	OGSpatialHandle *handles = malloc(count * sizeof(OGSpatialHandle));
+	uint32_t *visible = malloc(count * sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < count; i++) {
+		Entity *e = &entities[i];
+		e->x = rand_unit(&seed) * WORLD;
+		e->y = rand_unit(&seed) * WORLD;
+		e->w = i % LARGE_EVERY ? 8.0f + rand_unit(&seed) * 24.0f : 200.0f;
+		e->h = i % LARGE_EVERY ? 8.0f + rand_unit(&seed) * 24.0f : 120.0f;
+		e->vx = (rand_unit(&seed) - 0.5f) * 4.0f;
+		e->vy = (rand_unit(&seed) - 0.5f) * 4.0f;
+	}
+
+	OGSpatialGrid *grid = og_create_spatial_grid(CELL, count);
+
+	double start = now_ms();
+	for (uint32_t i = 0; i < count; i++) {
+		Entity *e = &entities[i];
+		handles[i] = og_spatial_insert(grid, e->x, e->y, e->x + e->w, e->y + e->h, i);
+	}
+	double insert_ms = now_ms() - start;
+
+	start = now_ms();
+	for (uint32_t p = 0; p < MOVE_PASSES; p++) {
+		for (uint32_t i = 0; i < count; i++) {
+			Entity *e = &entities[i];
+			e->x += e->vx;
+			e->y += e->vy;
+			og_spatial_move(grid, handles[i], e->x, e->y, e->x + e->w, e->y + e->h);
+		}
+	}
+	double move_ms = now_ms() - start;
+
+	uint64_t results = 0;
+	uint64_t tested = 0;
+	start = now_ms();
+	for (uint32_t q = 0; q < QUERIES; q++) {
+		float x = rand_unit(&seed) * (WORLD - VIEW_W);
+		float y = rand_unit(&seed) * (WORLD - VIEW_H);
+		results += og_spatial_query(grid, x, y, x + VIEW_W, y + VIEW_H, visible, count);
+		tested += grid->tested;
+	}
+	double query_ms = now_ms() - start;
+
+	// The Same Views Again, Compared With Checking Every Entity
+	uint32_t mismatches = 0;
+	seed = 7;
+	for (uint32_t q = 0; q < 50; q++) {
+		float x = rand_unit(&seed) * (WORLD - VIEW_W);
+		float y = rand_unit(&seed) * (WORLD - VIEW_H);
+		uint32_t found = og_spatial_query(grid, x, y, x + VIEW_W, y + VIEW_H, visible, count);
+
+		uint32_t expected = 0;
+		uint64_t sum = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			Entity *e = &entities[i];
+			if (e->x + e->w >= x && e->x <= x + VIEW_W && e->y + e->h >= y && e->y <= y + VIEW_H) {
+				expected++;
+				sum += i;
+			}
+		}
+		for (uint32_t i = 0; i < found; i++) {
+			sum -= visible[i];
+		}
+		mismatches += found != expected || sum != 0;
+	}
+
+	printf("{\n\t\"entities\": %u,\n\t\"cell\": %.0f,\n", count, CELL);
+	printf("\t\"inserts_per_sec\": %.0f,\n", count / (insert_ms / 1000.0));
+	printf("\t\"moves_per_sec\": %.0f,\n", (double)count * MOVE_PASSES / (move_ms / 1000.0));
+	printf("\t\"queries_per_sec\": %.0f,\n", QUERIES / (query_ms / 1000.0));
+	printf("\t\"us_per_query\": %.2f,\n", query_ms * 1000.0 / QUERIES);
+	printf("\t\"visible_per_query\": %.0f,\n", (double)results / QUERIES);
+	printf("\t\"tested_per_query\": %.0f,\n", (double)tested / QUERIES);
+	printf("\t\"mismatches\": %u\n}\n", mismatches);
+
+	og_destroy_spatial_grid(grid);
+	free(entities);
+	free(handles);
+	free(visible);
+	return mismatches != 0;
+}
+
+double now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// xorshift32, Same Numbers On Every Run
+float rand_unit(uint32_t *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return (float)(*state >> 8) / 16777216.0f;
+}
@@ -0,0 +1,104 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define FRAMES 600
+#define CIRCLES 200
+
+// Renders The Same Moving Scene Twice, Once Plain And Once While Capturing Every
+// Frame, And Prints The Frame Times Of Both So The Overhead Of Capture Shows Up.
+// Pass "raw" To Write One Raw BGRA File Instead Of A TGA Per Frame
+
+uint32_t frames = 0;
+
+void render();
+int compare_times(const void *a, const void *b);
+void measure(OGContext *og_ctx, const char* label);
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Capture",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.present_mode = OG_PRESENT_IMMEDIATE,
+		.capture = true,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	bool raw = argc > 1 && !strcmp(argv[1], "raw");
+	measure(p_ctx, "Capture Off");
+
+	if (!og_capture_begin(p_ctx, raw ? "capture.bgra" : "capture", raw ? OG_CAPTURE_RAW : OG_CAPTURE_TGA)) {
+		og_quit(p_ctx);
+		return 1;
+	}
+	measure(p_ctx, raw ? "Capture Raw" : "Capture TGA");
+	og_capture_end(p_ctx);
+
+	OGCapture *capture = &p_ctx->capture;
+	printf("[CAPTURE]: %lu Captured, %lu Written, %lu Dropped, %.2f ms Per Frame On The Writer\n",
+			(unsigned long)capture->frames_captured, (unsigned long)capture->frames_written,
+			(unsigned long)capture->frames_dropped,
+			capture->frames_written ? capture->write_time * 1000.0 / capture->frames_written : 0.0);
+	if (raw) {
+		printf("[CAPTURE]: ffmpeg -f rawvideo -pixel_format bgra -video_size %ux%u -i capture.bgra capture.mp4\n",
+				p_ctx->win->size.width, p_ctx->win->size.height);
+	}
+
+	og_quit(p_ctx);
+}
+
+void measure(OGContext *og_ctx, const char* label) {
+	static double times[FRAMES];
+	uint32_t count = 0;
+
+	double start = glfwGetTime();
+	while (og_ctx->running && count < FRAMES) {
+		og_poll_events(og_ctx);
+
+		double before = glfwGetTime();
+		og_render(og_ctx, render);
+		times[count++] = (glfwGetTime() - before) * 1000.0;
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	if (!count) {
+		return;
+	}
+
+	double total = 0.0;
+	for (uint32_t i = 0; i < count; i++) {
+		total += times[i];
+	}
+	qsort(times, count, sizeof(double), compare_times);
+
+	printf("[CAPTURE]: %s: %.1f FPS, og_render %.3f ms Avg, %.3f ms p99\n",
+			label, count / elapsed, total / count, times[count * 99 / 100]);
+}
+
+int compare_times(const void *a, const void *b) {
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.1f, 0.1f, 0.14f, 1}};
+	og_clear_screen(og_ctx, background);
+
+	float t = (float)frames * 0.02f;
+	for (uint32_t i = 0; i < CIRCLES; i++) {
+		float a = t + (float)i * 0.37f;
+		float x = WIDTH * 0.5f + cosf(a) * (float)(i % 40) * 14.0f;
+		float y = HEIGHT * 0.5f + sinf(a * 1.3f) * (float)(i % 25) * 13.0f;
+		VkClearColorValue color = {{0.5f + 0.5f * sinf(a), 0.5f + 0.5f * cosf(a), 0.8f, 1}};
+		og_draw_circle(og_ctx, x, y, 12.0f, color);
+	}
+}
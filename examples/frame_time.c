@@ -0,0 +1,50 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 2000
+
+// Renders The Red Window Scene With One And Then Several Frames In Flight
+// And Prints The Average CPU Time Per Frame For Both Runs
+
+void render();
+double measure(uint32_t frames_in_flight);
+
+int main() {
+	double serial_ms = measure(1);
+	double pipelined_ms = measure(OG_DEFAULT_FRAMES_IN_FLIGHT);
+
+	printf("[FRAME TIME]: 1 Frame In Flight: %.3f ms\n", serial_ms);
+	printf("[FRAME TIME]: %d Frames In Flight: %.3f ms\n", OG_DEFAULT_FRAMES_IN_FLIGHT, pipelined_ms);
+}
+
+double measure(uint32_t frames_in_flight) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = { 
+		.vd_layers = false,
+		.app_name = "Frame Time",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.frames_in_flight = frames_in_flight,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	uint32_t frames = 0;
+	double start = glfwGetTime();
+	while (p_ctx->running && frames < FRAMES) {
+		og_poll_events(p_ctx);
+		og_render(p_ctx, render);
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	og_quit(p_ctx);
+	return frames ? elapsed * 1000.0 / frames : 0.0;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{1, 0, 0, 1}};
+	og_clear_screen(og_ctx, color);
+}
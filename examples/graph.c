@@ -0,0 +1,104 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 120
+
+// Draws The Scene At Half Size Into A Transient Image, Blits It Up Into The
+// Backbuffer And Declares A Debug Pass Nothing Reads, Which The Graph Culls.
+// Every Barrier And Layout Transition Between Them Comes From The Graph
+
+void render();
+void upscale(OGContext *og_ctx, VkCommandBuffer cmd_buffer, void* data);
+void debug_overlay(OGContext *og_ctx, VkCommandBuffer cmd_buffer, void* data);
+
+typedef struct {
+	OGGraphResource src;
+} Upscale;
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = true,
+		.app_name = "Graph",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = true,
+		.readback = true,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	OGGraphImageDesc low_res = { .width = WIDTH / 2, .height = HEIGHT / 2 };
+	Upscale upscale_data = {};
+
+	og_graph_begin(p_ctx);
+	OGGraphResource layer = og_graph_image(p_ctx, "Layer", &low_res);
+	OGGraphResource overlay = og_graph_image(p_ctx, "Overlay", NULL);
+	upscale_data.src = layer;
+
+	VkClearColorValue black = {{0, 0, 0, 1}};
+	og_graph_scene(p_ctx, layer, &black);
+
+	OGGraphPass up = og_graph_pass(p_ctx, "Upscale", upscale, &upscale_data);
+	og_graph_read(p_ctx, up, layer, OG_ACCESS_TRANSFER_SRC);
+	og_graph_write(p_ctx, up, OG_GRAPH_BACKBUFFER, OG_ACCESS_TRANSFER_DST);
+
+	OGGraphPass debug = og_graph_pass(p_ctx, "Debug", debug_overlay, NULL);
+	og_graph_write_color(p_ctx, debug, overlay, &black);
+	og_graph_end(p_ctx);
+
+	OGFrameData data = {};
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		og_render(p_ctx, render);
+
+		if (og_read_frame(p_ctx, &data, false)) {
+			const uint8_t* px = data.pixels;
+			mismatches += !(px[0] == 255 && px[1] == 0 && px[2] == 0);
+		}
+	}
+
+	OGRenderGraph *graph = &p_ctx->graph;
+	printf("[GRAPH]: %u Passes, %u Culled\n", graph->pass_count, graph->culled_passes);
+	printf("[GRAPH]: Transient Memory %llu KB (%llu KB Without Aliasing)\n",
+			(unsigned long long)graph->transient_bytes / 1024, (unsigned long long)graph->unaliased_bytes / 1024);
+	printf("[GRAPH]: %u Mismatches\n", mismatches);
+
+	og_quit(p_ctx);
+	return mismatches != 0;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{1, 0, 0, 1}};
+	og_clear_screen(og_ctx, color);
+}
+
+void upscale(OGContext *og_ctx, VkCommandBuffer cmd_buffer, void* data) {
+	Upscale *upscale_data = data;
+	OGGraphResourceNode *src = &og_ctx->graph.resources[upscale_data->src];
+
+	VkImageBlit blit = {};
+	blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	blit.srcSubresource.layerCount = 1;
+	blit.srcOffsets[1].x = (int32_t)src->extent.width;
+	blit.srcOffsets[1].y = (int32_t)src->extent.height;
+	blit.srcOffsets[1].z = 1;
+	blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	blit.dstSubresource.layerCount = 1;
+	blit.dstOffsets[1].x = (int32_t)og_ctx->win->size.width;
+	blit.dstOffsets[1].y = (int32_t)og_ctx->win->size.height;
+	blit.dstOffsets[1].z = 1;
+
+	vkCmdBlitImage(cmd_buffer, src->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			og_ctx->sc_images[og_ctx->img_idx], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+}
+
+// Never Runs, Nothing Reads The Overlay
+void debug_overlay(OGContext *og_ctx, VkCommandBuffer cmd_buffer, void* data) {
+	(void)og_ctx;
+	(void)cmd_buffer;
+	(void)data;
+	printf("[GRAPH]: Debug Pass Should Have Been Culled\n");
+}
@@ -0,0 +1,76 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 120
+
+// Renders Without A Window (Works On Software Drivers Like lavapipe), Checks
+// The Pixels Of Every Finished Frame And Dumps The Last One To headless.ppm
+
+void render();
+void write_ppm(const char* path, OGFrameData* data);
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = { 
+		.vd_layers = true,
+		.app_name = "Headless",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = true,
+		.readback = true,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	OGFrameData data = {};
+	uint32_t frames_read = 0;
+	uint32_t mismatches = 0;
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		og_render(p_ctx, render);
+
+		// Never Blocks, Finished Frames Trickle In A Few Renders Late
+		if (og_read_frame(p_ctx, &data, false)) {
+			const uint8_t* px = data.pixels;
+			mismatches += !(px[0] == 255 && px[1] == 0 && px[2] == 0 && px[3] == 255);
+			frames_read++;
+		}
+	}
+
+	// Drain Whatever Is Still In Flight
+	while (og_read_frame(p_ctx, &data, true)) {
+		frames_read++;
+	}
+
+	if (frames_read) {
+		write_ppm("headless.ppm", &data);
+	}
+	printf("[HEADLESS]: %u Frames Read Back, %u Mismatches\n", frames_read, mismatches);
+
+	og_quit(p_ctx);
+	return mismatches != 0;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{1, 0, 0, 1}};
+	og_clear_screen(og_ctx, color);
+}
+
+void write_ppm(const char* path, OGFrameData* data) {
+	FILE* file = fopen(path, "wb");
+	if (!file) {
+		OG_LOG_ERR("Failed To Open Output Image");
+		return;
+	}
+
+	fprintf(file, "P6\n%u %u\n255\n", data->width, data->height);
+	for (uint32_t y = 0; y < data->height; y++) {
+		const uint8_t* row = (const uint8_t*)data->pixels + y * data->stride;
+		for (uint32_t x = 0; x < data->width; x++) {
+			fwrite(row + x * 4, 1, 3, file);
+		}
+	}
+	fclose(file);
+}
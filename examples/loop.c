@@ -0,0 +1,102 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define BALLS 2000
+#define TICKS 1800 // 30 Seconds At 60 Updates A Second
+
+// Bounces BALLS Balls At A Fixed 60 Updates A Second Through og_run, Whatever The
+// Frame Rate, And Draws Them Interpolated Between Updates. Pass "threaded" To Run
+// The Simulation On Its Own Thread, The Same Seed Ends Up In The Same Place Either Way
+
+typedef struct {
+	float x[BALLS], y[BALLS];
+	float vx[BALLS], vy[BALLS];
+	uint32_t tick;
+} World;
+
+bool update(OGContext *og_ctx, void* snapshot, double dt, void* user);
+void render(OGContext *og_ctx, const void* prev, const void* curr, float alpha, void* user);
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Loop",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	static World world = {};
+	uint32_t seed = 1;
+	for (uint32_t i = 0; i < BALLS; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		world.x[i] = (float)(seed % WIDTH);
+		world.y[i] = (float)((seed >> 12) % HEIGHT);
+		world.vx[i] = (float)((int32_t)(seed >> 20) % 400 - 200);
+		world.vy[i] = 0.0f;
+	}
+
+	OGLoopConfig loop = {
+		.timestep = 1.0 / 60.0,
+		.threaded = argc > 1 && !strcmp(argv[1], "threaded"),
+		.snapshot_size = sizeof(World),
+		.initial = &world,
+		.update = update,
+		.render = render,
+	};
+
+	double start = glfwGetTime();
+	og_run(p_ctx, &loop);
+	double elapsed = glfwGetTime() - start;
+
+	printf("[LOOP]: %llu Updates In %.2f s (%.1f/s), %llu Frames, %.3f s Dropped\n",
+			(unsigned long long)p_ctx->loop.ticks, elapsed, p_ctx->loop.ticks / elapsed,
+			(unsigned long long)p_ctx->frame_number, p_ctx->loop.dropped);
+
+	og_quit(p_ctx);
+	return 0;
+}
+
+// Gravity And Bounces, Only Ever Stepped By The Same dt
+bool update(OGContext *og_ctx, void* snapshot, double dt, void* user) {
+	(void)og_ctx;
+	(void)user;
+	World *world = snapshot;
+	float step = (float)dt;
+
+	for (uint32_t i = 0; i < BALLS; i++) {
+		world->vy[i] += 900.0f * step;
+		world->x[i] += world->vx[i] * step;
+		world->y[i] += world->vy[i] * step;
+
+		if (world->y[i] > HEIGHT) {
+			world->y[i] = HEIGHT;
+			world->vy[i] *= -0.9f;
+		}
+		if (world->x[i] < 0.0f || world->x[i] > WIDTH) {
+			world->x[i] = world->x[i] < 0.0f ? 0.0f : WIDTH;
+			world->vx[i] = -world->vx[i];
+		}
+	}
+	return ++world->tick < TICKS;
+}
+
+void render(OGContext *og_ctx, const void* prev, const void* curr, float alpha, void* user) {
+	(void)user;
+	const World *a = prev;
+	const World *b = curr;
+
+	OGColor background = {{0.08f, 0.08f, 0.1f, 1}};
+	og_clear_screen(og_ctx, background);
+
+	OGColor color = {{0.9f, 0.6f, 0.2f, 1}};
+	for (uint32_t i = 0; i < BALLS; i++) {
+		float x = a->x[i] + (b->x[i] - a->x[i]) * alpha;
+		float y = a->y[i] + (b->y[i] - a->y[i]) * alpha;
+		og_draw_circle(og_ctx, x, y, 4.0f, color);
+	}
+}
@@ -0,0 +1,83 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define SECONDS 10.0
+#define COLUMNS 4
+#define ROWS 5
+#define BUTTON_W 240.0f
+#define BUTTON_H 96.0f
+#define GAP 32.0f
+
+// A Static Menu Whose Highlight Moves Every Half Second. With on_demand Only Those
+// Frames Are Drawn, Each One Redrawing Just The Two Buttons That Changed, And
+// og_poll_events Sleeps In Between Instead Of Spinning
+
+uint32_t selected = 0;
+
+void render();
+
+void button_rect(uint32_t i, float *x, float *y) {
+	float left = (WIDTH - COLUMNS * BUTTON_W - (COLUMNS - 1) * GAP) * 0.5f;
+	float top = (HEIGHT - ROWS * BUTTON_H - (ROWS - 1) * GAP) * 0.5f;
+	*x = left + (float)(i % COLUMNS) * (BUTTON_W + GAP);
+	*y = top + (float)(i / COLUMNS) * (BUTTON_H + GAP);
+}
+
+void invalidate_button(OGContext *og_ctx, uint32_t i) {
+	float x, y;
+	button_rect(i, &x, &y);
+	og_invalidate_rect(og_ctx, (int32_t)x, (int32_t)y, (uint32_t)BUTTON_W, (uint32_t)BUTTON_H);
+}
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "On Demand",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.on_demand = true,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	uint64_t loops = 0;
+	double start = glfwGetTime();
+	double next_move = start + 0.5;
+	while (p_ctx->running && glfwGetTime() - start < SECONDS) {
+		og_poll_events(p_ctx);
+
+		if (glfwGetTime() >= next_move) {
+			invalidate_button(p_ctx, selected);
+			selected = (selected + 1) % (COLUMNS * ROWS);
+			invalidate_button(p_ctx, selected);
+			next_move += 0.5;
+		}
+
+		og_render(p_ctx, render);
+		loops++;
+	}
+
+	OGDamage *damage = &p_ctx->damage;
+	printf("[ON DEMAND]: %lu Loops, %lu Frames Skipped, %lu Drawn Of Which %lu Partial, Incremental Present %s\n",
+			(unsigned long)loops, (unsigned long)damage->frames_skipped, (unsigned long)(loops - damage->frames_skipped),
+			(unsigned long)damage->frames_partial, damage->incremental ? "On" : "Off");
+
+	og_quit(p_ctx);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.08f, 0.09f, 0.12f, 1}};
+	og_clear_screen(og_ctx, background);
+
+	// Everything Is Drawn Every Time, The Scissor Keeps It To What Changed
+	for (uint32_t i = 0; i < COLUMNS * ROWS; i++) {
+		float x, y;
+		button_rect(i, &x, &y);
+		VkClearColorValue color = i == selected ? (VkClearColorValue){{0.95f, 0.6f, 0.2f, 1}} :
+			(VkClearColorValue){{0.25f, 0.28f, 0.35f, 1}};
+		og_draw_rect(og_ctx, x, y, BUTTON_W, BUTTON_H, color);
+	}
+}
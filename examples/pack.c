@@ -0,0 +1,87 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define FRAMES 600
+#define PACK_PATH "./assets.ogpk" // Or Pass One As The First Argument
+#define TEXTURE_NAME "sprite" // Or Pass One As The Second Argument
+
+// Opens An Asset Pack, Loads One Texture Out Of It And Draws It At Shrinking Sizes
+// So Every Level Of Its Baked Mip Chain Gets Sampled. Build A Pack With
+//   make -C .. packer && ../lib/ogpack assets.ogpk sprite=image.pam
+
+OGTexture* texture;
+
+void render();
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Pack",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	double start = glfwGetTime();
+	OGPack *pack = og_open_pack(argc > 1 ? argv[1] : PACK_PATH);
+	if (!pack) {
+		og_quit(p_ctx);
+		return 1;
+	}
+	double opened = glfwGetTime();
+
+	const char *name = argc > 2 ? argv[2] : TEXTURE_NAME;
+	texture = og_load_pack_texture(p_ctx, pack, name);
+	if (!texture) {
+		og_close_pack(pack);
+		og_quit(p_ctx);
+		return 1;
+	}
+	og_upload_wait(p_ctx, texture->upload);
+	double loaded = glfwGetTime();
+
+	// The Texels Were Staged During The Load, Only The Entry Below Still Points Into The Mapping
+
+	const OGPackEntry *entry = og_pack_find(pack, name);
+	printf("[PACK]: %u Entries, Opened In %.3f ms\n", pack->header->entry_count, (opened - start) * 1000.0);
+	printf("[PACK]: %ux%u With %u Mips (%.1f KB) Resident In %.3f ms\n", entry->width, entry->height,
+			entry->mip_levels, entry->size / 1024.0, (loaded - opened) * 1000.0);
+
+	og_close_pack(pack);
+
+	uint32_t frame = 0;
+	while (p_ctx->running && frame < FRAMES) {
+		og_poll_events(p_ctx);
+		og_render(p_ctx, render);
+		frame++;
+	}
+
+	og_destroy_texture(p_ctx, texture);
+	og_quit(p_ctx);
+	return 0;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{0.1f, 0.1f, 0.1f, 1}};
+	og_clear_screen(og_ctx, color);
+
+	float x = 16.0f;
+	float size = 512.0f;
+	while (size >= 2.0f && x + size < WIDTH) {
+		OGSprite sprite = {
+			.x = x + size * 0.5f,
+			.y = HEIGHT * 0.5f,
+			.w = size, .h = size * texture->height / (float)texture->width,
+			.color = {{1, 1, 1, 1}},
+			.texture = texture,
+		};
+		og_draw_sprite(og_ctx, &sprite);
+
+		x += size + 8.0f;
+		size *= 0.5f;
+	}
+}
@@ -0,0 +1,84 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <time.h>
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 500
+#define CHUNKS 64
+#define TILES_PER_CHUNK 2000
+
+// Records The Same Large Scene On One Thread And Then Split Across Every Core
+// With og_record_parallel, And Prints The Average CPU Time Per Frame For Both
+
+void render();
+void record_chunk(OGContext *og_ctx, VkCommandBuffer cmd_buffer, uint32_t chunk, void* data);
+double measure(uint32_t job_threads);
+
+int main() {
+	double serial_ms = measure(0);
+	double parallel_ms = measure(OG_JOBS_AUTO);
+
+	printf("[RECORD]: 1 Thread: %.3f ms\n", serial_ms);
+	printf("[RECORD]: All Cores: %.3f ms\n", parallel_ms);
+}
+
+double measure(uint32_t job_threads) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Parallel",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = true,
+		.job_threads = job_threads,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		og_render(p_ctx, render);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	og_quit(p_ctx);
+
+	double elapsed_ms = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6;
+	return elapsed_ms / FRAMES;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{0.1f, 0.1f, 0.1f, 1}};
+	og_clear_screen(og_ctx, color);
+
+	og_record_parallel(og_ctx, CHUNKS, record_chunk, NULL);
+}
+
+// Each Chunk Owns A Horizontal Band Of Small Tiles, One Command Per Tile
+void record_chunk(OGContext *og_ctx, VkCommandBuffer cmd_buffer, uint32_t chunk, void* data) {
+	(void)data;
+	uint32_t band = og_ctx->win->size.height / CHUNKS;
+
+	for (uint32_t i = 0; i < TILES_PER_CHUNK; i++) {
+		VkClearAttachment clear_attachment = {};
+		clear_attachment.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		clear_attachment.colorAttachment = 0;
+		clear_attachment.clearValue.color.float32[0] = (float)chunk / CHUNKS;
+		clear_attachment.clearValue.color.float32[1] = (float)i / TILES_PER_CHUNK;
+		clear_attachment.clearValue.color.float32[2] = 0.5f;
+		clear_attachment.clearValue.color.float32[3] = 1.0f;
+
+		VkClearRect clear_rect = {};
+		clear_rect.rect.offset.x = (int32_t)((i * 4) % (og_ctx->win->size.width - 4));
+		clear_rect.rect.offset.y = (int32_t)(chunk * band);
+		clear_rect.rect.extent.width = 4;
+		clear_rect.rect.extent.height = band;
+		clear_rect.layerCount = 1;
+
+		vkCmdClearAttachments(cmd_buffer, 1, &clear_attachment, 1, &clear_rect);
+	}
+}
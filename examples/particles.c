@@ -0,0 +1,77 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define FRAMES 1200
+#define MAX_PARTICLES (1 << 20)
+#define FOUNTAINS 4
+#define LIFE 3.0f
+
+// Four Fountains Feeding Up To A Million Particles, Simulated And Compacted On The
+// GPU. Pass "async" To Simulate On A Compute Only Queue Where There Is One. The CPU
+// Side Stays The Same However Many Are Alive, Which Is What The Timing Shows
+
+uint32_t frames = 0;
+
+void render();
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Particles",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.max_particles = MAX_PARTICLES,
+		.async_compute = argc > 1 && !strcmp(argv[1], "async"),
+	};
+
+	og_init(p_ctx, &cfg);
+	og_particle_forces(p_ctx, 0.0f, 300.0f, 0.2f);
+
+	// Enough Per Frame At 60 FPS To Keep The Pool Full Once The First Ones Start Dying
+	uint32_t per_fountain = (uint32_t)(MAX_PARTICLES / (LIFE * 60.0f) / FOUNTAINS);
+
+	double cpu_time = 0.0;
+	double start = glfwGetTime();
+	while (p_ctx->running && frames < FRAMES) {
+		og_poll_events(p_ctx);
+
+		for (uint32_t i = 0; i < FOUNTAINS; i++) {
+			float phase = (float)frames * 0.02f + (float)i * 1.5708f;
+
+			OGParticleEmitter fountain = {
+				.pos = { WIDTH * (0.2f + 0.2f * (float)i), HEIGHT - 40.0f },
+				.spread = { 8.0f, 8.0f },
+				.velocity = { 120.0f * sinf(phase), -520.0f },
+				.velocity_jitter = 140.0f,
+				.life = LIFE,
+				.life_jitter = 1.0f,
+				.size = 3.0f,
+				.size_end = 1.0f,
+				.color = og_particle_color((OGColor){{0.3f + 0.2f * (float)i, 0.5f, 1.0f - 0.2f * (float)i, 0.8f}}),
+			};
+			og_emit_particles(p_ctx, &fountain, per_fountain);
+		}
+
+		double before = glfwGetTime();
+		og_render(p_ctx, render);
+		cpu_time += glfwGetTime() - before;
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	printf("[PARTICLES]: Up To %u Alive, %u Emitted Per Frame, %.1f FPS, %.3f ms CPU In og_render (%s)\n",
+			MAX_PARTICLES, p_ctx->particles.emitted, frames / elapsed, cpu_time * 1000.0 / frames,
+			p_ctx->particles.async ? "Async Compute" : "Graphics Queue");
+
+	og_quit(p_ctx);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.02f, 0.02f, 0.04f, 1}};
+	og_clear_screen(og_ctx, background);
+}
@@ -0,0 +1,58 @@
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+
+#include <time.h>
+
+#define WIDTH 800
+#define HEIGHT 600
+#define CACHE_PATH "./build/pipeline.cache"
+
+// Times og_init Twice, Once Without A Cache File And Once With The One
+// The First og_quit Wrote, And Prints Both Startup Times
+
+double now_ms();
+double measure(bool *warm);
+
+int main() {
+	// Driver Side Disk Caches Would Hide The Cold Cost, Turn The Common Ones Off
+	setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+	setenv("__GL_SHADER_DISK_CACHE", "0", 1);
+
+	remove(CACHE_PATH);
+
+	bool cold_warm = false;
+	bool warm_warm = false;
+	double cold_ms = measure(&cold_warm);
+	double warm_ms = measure(&warm_warm);
+
+	printf("[STARTUP]: Cold Cache: %.3f ms (Loaded: %s)\n", cold_ms, cold_warm ? "Yes" : "No");
+	printf("[STARTUP]: Warm Cache: %.3f ms (Loaded: %s)\n", warm_ms, warm_warm ? "Yes" : "No");
+}
+
+double now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+double measure(bool *warm) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Pipeline Cache",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = true,
+		.pipeline_cache_path = CACHE_PATH,
+	};
+
+	double start = now_ms();
+	og_init(p_ctx, &cfg);
+	double elapsed = now_ms() - start;
+
+	*warm = p_ctx->pipelines.warm;
+
+	og_quit(p_ctx);
+	return elapsed;
+}
@@ -0,0 +1,67 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 600
+#define TRACE_PATH "./build/trace.json"
+
+// Needs The Profiler Built In: make PROFILE=1 TARGET=profile.c
+// Prints Rolling Frame Stats And Writes A Chrome Trace Of The Last Frames
+
+void render();
+
+int main() {
+#ifndef OG_PROFILE
+	OG_LOG_ERR("Build With PROFILE=1 To Run This Example");
+	return 1;
+#else
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Profile",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.headless = true,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	for (uint32_t i = 0; i < FRAMES; i++) {
+		og_render(p_ctx, render);
+	}
+
+	OGProfileStats* stats = &p_ctx->profiler.stats;
+	printf("[CPU FRAME]: Min %.3f ms, Avg %.3f ms, P99 %.3f ms\n",
+			stats->cpu_frame.min_ms, stats->cpu_frame.avg_ms, stats->cpu_frame.p99_ms);
+	printf("[GPU FRAME]: Min %.3f ms, Avg %.3f ms, P99 %.3f ms\n",
+			stats->gpu_frame.min_ms, stats->gpu_frame.avg_ms, stats->gpu_frame.p99_ms);
+
+	og_profile_dump_trace(p_ctx, TRACE_PATH);
+	og_quit(p_ctx);
+	return 0;
+#endif
+}
+
+void render(OGContext *og_ctx) {
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Scene");
+	OG_PROFILE_GPU_BEGIN(og_ctx, "Clear");
+
+	OGColor color = {{0.1f, 0.1f, 0.1f, 1}};
+	og_clear_screen(og_ctx, color);
+
+	OG_PROFILE_GPU_END(og_ctx);
+
+	for (uint32_t i = 0; i < 1000; i++) {
+		OGSprite sprite = {
+			.x = (float)(i % 40) * 20.0f + 10.0f,
+			.y = (float)(i / 40) * 20.0f + 10.0f,
+			.w = 16.0f,
+			.h = 16.0f,
+			.color = {{1, 0.5f, 0, 1}},
+		};
+		og_draw_sprite(og_ctx, &sprite);
+	}
+
+	OG_PROFILE_CPU_END(og_ctx);
+}
@@ -0,0 +1,71 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+#define WIDTH 800
+#define HEIGHT 600
+#define FRAMES 600
+
+// A Debug Overlay Made Of Shapes: A Grid Of Lines, A Ring Of Circles And A
+// Spinning Polygon, Every Frame, Then Reports How Many Shapes Each Frame Drew
+
+float angle = 0.0f;
+
+void render();
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Shapes",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	uint32_t frames = 0;
+	double start = glfwGetTime();
+	while (p_ctx->running && frames < FRAMES) {
+		og_poll_events(p_ctx);
+		og_render(p_ctx, render);
+		angle += 0.01f;
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	printf("[SHAPES]: %u Shapes And %u Vertices Per Frame, %.1f FPS\n",
+			p_ctx->shapes.shapes_drawn, p_ctx->shapes.vertices_drawn, frames / elapsed);
+
+	og_quit(p_ctx);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.1f, 0.1f, 0.1f, 1}};
+	OGColor grid = {{1, 1, 1, 0.15f}};
+	OGColor dot = {{1, 0.6f, 0.1f, 1}};
+	OGColor panel = {{0.2f, 0.4f, 0.9f, 0.8f}};
+	og_clear_screen(og_ctx, background);
+
+	for (float x = 0; x < WIDTH; x += 20.0f) {
+		og_draw_line(og_ctx, x, 0, x, HEIGHT, 1.0f, grid);
+	}
+	for (float y = 0; y < HEIGHT; y += 20.0f) {
+		og_draw_line(og_ctx, 0, y, WIDTH, y, 1.0f, grid);
+	}
+
+	for (uint32_t i = 0; i < 64; i++) {
+		float a = angle + (float)i * 0.0982f;
+		og_draw_circle(og_ctx, WIDTH / 2 + 200.0f * cosf(a), HEIGHT / 2 + 200.0f * sinf(a), 4.0f + (float)(i % 8), dot);
+	}
+
+	float points[5 * 2];
+	for (uint32_t k = 0; k < 5; k++) {
+		points[k * 2] = WIDTH / 2 + 80.0f * cosf(angle * 2.0f + (float)k * 1.2566f);
+		points[k * 2 + 1] = HEIGHT / 2 + 80.0f * sinf(angle * 2.0f + (float)k * 1.2566f);
+	}
+	og_draw_polygon(og_ctx, points, 5, dot);
+
+	og_draw_rect(og_ctx, 10, 10, 180, 60, panel);
+}
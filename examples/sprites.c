@@ -0,0 +1,75 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 800
+#define HEIGHT 600
+#define SPRITES 100000
+#define FRAMES 600
+
+// Throws SPRITES Spinning Quads Over Three Textures Every Frame And Reports
+// The Sustained Sprites Per Second Along With The Draw Calls Per Frame
+
+OGTexture* textures[3];
+float angle = 0.0f;
+
+void render();
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = { 
+		.vd_layers = false,
+		.app_name = "Sprites",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.max_sprites = SPRITES,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	uint8_t pixels[3][4 * 4 * 4];
+	for (uint32_t t = 0; t < 3; t++) {
+		for (uint32_t i = 0; i < 16; i++) {
+			pixels[t][i * 4 + 0] = t == 0 ? 255 : 64;
+			pixels[t][i * 4 + 1] = t == 1 ? 255 : 64;
+			pixels[t][i * 4 + 2] = t == 2 ? 255 : 64;
+			pixels[t][i * 4 + 3] = 255;
+		}
+		textures[t] = og_create_texture(p_ctx, 4, 4, pixels[t]);
+	}
+
+	uint32_t frames = 0;
+	double start = glfwGetTime();
+	while (p_ctx->running && frames < FRAMES) {
+		og_poll_events(p_ctx);
+		og_render(p_ctx, render);
+		angle += 0.01f;
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	printf("[SPRITES]: %.0f Sprites/s, %u Draw Calls Per Frame\n",
+			(double)SPRITES * frames / elapsed, p_ctx->sprites.draw_calls);
+
+	for (uint32_t t = 0; t < 3; t++) {
+		og_destroy_texture(p_ctx, textures[t]);
+	}
+	og_quit(p_ctx);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{0.1f, 0.1f, 0.1f, 1}};
+	og_clear_screen(og_ctx, color);
+
+	// Interleaved Textures On Purpose, The Batcher Sorts Them Back Together
+	for (uint32_t i = 0; i < SPRITES; i++) {
+		OGSprite sprite = {
+			.x = (float)((i * 7919) % WIDTH),
+			.y = (float)((i * 104729) % HEIGHT),
+			.w = 8, .h = 8,
+			.rotation = angle + i * 0.001f,
+			.color = {{1, 1, 1, 1}},
+			.texture = textures[i % 3],
+		};
+		og_draw_sprite(og_ctx, &sprite);
+	}
+}
@@ -0,0 +1,132 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define FRAMES 1200
+#define TILE 256.0f
+#define GRID 32 // GRID x GRID Tiles, Each Using One Of The Pack's Textures
+#define KEEP_RADIUS 1400.0f // Tiles Further From The Camera Are Released
+#define PACK_PATH "./assets.ogpk" // Or Pass One As The First Argument
+
+// Pans A Camera Over A Large Tiled World Whose Textures Come Out Of An Asset Pack.
+// Tiles Are Streamed In Nearest First As The Camera Nears Them And Cancelled Or
+// Released Once It Has Moved On, And The Slowest Frame Shows Whether Streaming Ever
+// Hitched. Any Pack With A Few Textures Works, See examples/pack.c
+
+OGPack* pack;
+const char* names[GRID * GRID];
+OGTexture* tiles[GRID * GRID];
+uint32_t name_count = 0;
+float cam_x = 0.0f, cam_y = 0.0f;
+
+void update_tiles(OGContext *og_ctx);
+void render();
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Stream",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+		.stream_budget = 2 * 1024 * 1024,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	pack = og_open_pack(argc > 1 ? argv[1] : PACK_PATH);
+	if (!pack) {
+		og_quit(p_ctx);
+		return 1;
+	}
+
+	for (uint32_t i = 0; i < pack->header->entry_count && name_count < GRID * GRID; i++) {
+		if (pack->entries[i].type == OG_PACK_TEXTURE) {
+			names[name_count++] = pack->names + pack->entries[i].name;
+		}
+	}
+	if (!name_count) {
+		printf("[STREAM]: The Pack Has No Textures\n");
+		og_close_pack(pack);
+		og_quit(p_ctx);
+		return 1;
+	}
+
+	uint32_t frame = 0;
+	double worst = 0.0;
+	uint64_t bytes = 0;
+	double last = glfwGetTime();
+	while (p_ctx->running && frame < FRAMES) {
+		og_poll_events(p_ctx);
+
+		// A Slow Circle Around The World, Far Enough To Leave Tiles Behind
+		float t = frame * 0.004f;
+		cam_x = GRID * TILE * 0.5f + cosf(t) * GRID * TILE * 0.35f;
+		cam_y = GRID * TILE * 0.5f + sinf(t) * GRID * TILE * 0.35f;
+		update_tiles(p_ctx);
+
+		og_render(p_ctx, render);
+		bytes += p_ctx->stream.bytes_last_frame;
+		frame++;
+
+		double now = glfwGetTime();
+		if (frame > 1 && now - last > worst) {
+			worst = now - last;
+		}
+		last = now;
+	}
+
+	OGStreamer *stream = &p_ctx->stream;
+	printf("[STREAM]: %u Textures Streamed (%.1f MB), %u Requests Cancelled, Slowest Frame %.2f ms\n",
+			stream->textures_streamed, bytes / (1024.0 * 1024.0), stream->requests_cancelled, worst * 1000.0);
+
+	for (uint32_t i = 0; i < GRID * GRID; i++) {
+		if (tiles[i]) {
+			og_stream_cancel(p_ctx, tiles[i]);
+		}
+	}
+	og_quit(p_ctx);
+	og_close_pack(pack);
+	return 0;
+}
+
+// Requests What Came Into Range And Lets Go Of What Fell Out Of It
+void update_tiles(OGContext *og_ctx) {
+	og_stream_focus(og_ctx, cam_x, cam_y);
+
+	for (uint32_t i = 0; i < GRID * GRID; i++) {
+		float x = (i % GRID + 0.5f) * TILE;
+		float y = (i / GRID + 0.5f) * TILE;
+		bool near = hypotf(x - cam_x, y - cam_y) < KEEP_RADIUS;
+
+		if (near && !tiles[i]) {
+			tiles[i] = og_stream_texture_at(og_ctx, pack, names[i % name_count], x, y, 0.0f);
+		} else if (!near && tiles[i]) {
+			og_stream_cancel(og_ctx, tiles[i]);
+			tiles[i] = NULL;
+		}
+	}
+}
+
+void render(OGContext *og_ctx) {
+	OGColor color = {{0.1f, 0.1f, 0.1f, 1}};
+	og_clear_screen(og_ctx, color);
+
+	for (uint32_t i = 0; i < GRID * GRID; i++) {
+		if (!tiles[i]) {
+			continue;
+		}
+
+		OGSprite sprite = {
+			.x = (i % GRID + 0.5f) * TILE - cam_x + WIDTH * 0.5f,
+			.y = (i / GRID + 0.5f) * TILE - cam_y + HEIGHT * 0.5f,
+			.w = TILE - 4.0f, .h = TILE - 4.0f,
+			.color = {{1, 1, 1, 1}},
+			.texture = tiles[i],
+		};
+		og_draw_sprite(og_ctx, &sprite);
+	}
+}
@@ -0,0 +1,79 @@
+#include "origami/og_renderer.h"
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define LABELS 3000
+#define FRAMES 600
+#define FONT_PATH "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf" // Or Pass One As The First Argument
+
+// Draws LABELS Small Labels Whose Numbers Keep Changing Plus A Large Heading Over A
+// Shape Panel. Every String Is Laid Out Once And Replayed From The Run Cache, And
+// All Of It Goes Out In The Same Draw Whatever The Size
+
+OGFont* font;
+uint32_t frame = 0;
+char stats[128] = "";
+
+void render();
+
+int main(int argc, char **argv) {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Text",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	font = og_load_font(p_ctx, argc > 1 ? argv[1] : FONT_PATH);
+	if (!font) {
+		og_quit(p_ctx);
+		return 1;
+	}
+
+	double start = glfwGetTime();
+	while (p_ctx->running && frame < FRAMES) {
+		og_poll_events(p_ctx);
+		og_render(p_ctx, render);
+		frame++;
+
+		OGTextSystem *text = &p_ctx->text;
+		snprintf(stats, sizeof(stats), "%.0f fps  %u glyphs  %llu runs laid out  %u draw calls",
+				frame / (glfwGetTime() - start), text->glyphs_rasterized,
+				(unsigned long long)text->runs_shaped, p_ctx->sprites.draw_calls);
+	}
+
+	OGTextSystem *text = &p_ctx->text;
+	printf("[TEXT]: %.1f%% Of Runs Reused, %u Glyphs Rasterized\n",
+			100.0 * text->runs_reused / (double)(text->runs_reused + text->runs_shaped), text->glyphs_rasterized);
+
+	og_destroy_font(p_ctx, font);
+	og_quit(p_ctx);
+	return 0;
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.08f, 0.08f, 0.1f, 1}};
+	og_clear_screen(og_ctx, background);
+
+	OGColor label_color = {{0.7f, 0.9f, 1, 1}};
+	OGColor panel = {{0.2f, 0.2f, 0.3f, 0.9f}};
+	OGColor white = {{1, 1, 1, 1}};
+
+	// Each Label's Number Only Changes Every Few Frames, So Most Are Cache Hits
+	char label[32];
+	for (uint32_t i = 0; i < LABELS; i++) {
+		snprintf(label, sizeof(label), "#%u  %u", i, (frame / 8 + i) % 100);
+		og_draw_text(og_ctx, font, label, (float)((i % 20) * 64), (float)(80 + (i / 20) * 4), 10.0f, label_color);
+	}
+
+	float w = 0.0f;
+	float h = 0.0f;
+	og_measure_text(og_ctx, font, "Origami", 96.0f, &w, &h);
+	og_draw_rect(og_ctx, (WIDTH - w) * 0.5f - 20.0f, 200.0f, w + 40.0f, h, panel);
+	og_draw_text(og_ctx, font, "Origami", (WIDTH - w) * 0.5f, 200.0f, 96.0f, white);
+	og_draw_text(og_ctx, font, stats, 8.0f, 8.0f, 20.0f, white);
+}
@@ -0,0 +1,101 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define FRAMES 1200
+#define MAP_SIZE 4096
+#define TILE 16.0f
+#define CELLS 4 // Tileset Is CELLS By CELLS
+#define EDITS 8 // Random Tiles Changed Per Frame
+
+// A 4096x4096 Map Of Generated Terrain, Scrolled Diagonally While A Few Tiles Change
+// Every Frame. Only The Chunks In View Are Built, Each Edit Rebuilds One Chunk, And
+// Everything Else Is Drawn From Buffers Uploaded Once
+
+uint32_t frames = 0;
+OGTilemap* map = NULL;
+float cam_x = 0.0f;
+float cam_y = 0.0f;
+
+void render();
+
+int main() {
+	OGContext ctx = {};
+	OGContext* p_ctx = &ctx;
+	OGConfig cfg = {
+		.vd_layers = false,
+		.app_name = "Tilemap",
+		.win_width = WIDTH,
+		.win_height = HEIGHT,
+	};
+
+	og_init(p_ctx, &cfg);
+
+	// Flat Shaded Cells With A Darker Border, Enough To See The Grid
+	uint32_t side = CELLS * (uint32_t)TILE;
+	uint8_t *rgba = malloc(side * side * 4);
+	for (uint32_t y = 0; y < side; y++) {
+		for (uint32_t x = 0; x < side; x++) {
+			uint32_t cell = (y / (uint32_t)TILE) * CELLS + x / (uint32_t)TILE;
+			bool border = x % (uint32_t)TILE == 0 || y % (uint32_t)TILE == 0;
+			uint8_t *px = &rgba[(y * side + x) * 4];
+			px[0] = (uint8_t)((40 + cell * 13) >> border);
+			px[1] = (uint8_t)((90 + cell * 9) >> border);
+			px[2] = (uint8_t)((60 + cell * 5) >> border);
+			px[3] = 255;
+		}
+	}
+	OGTexture *tileset = og_create_texture(p_ctx, side, side, rgba);
+	free(rgba);
+
+	// Rolling Hills Of Cells, A Quarter Of The Map Left Empty
+	map = og_create_tilemap(p_ctx, MAP_SIZE, MAP_SIZE, TILE, tileset, CELLS);
+	uint16_t *row = malloc(MAP_SIZE * sizeof(uint16_t));
+	for (uint32_t y = 0; y < MAP_SIZE; y++) {
+		for (uint32_t x = 0; x < MAP_SIZE; x++) {
+			float h = sinf((float)x * 0.05f) + cosf((float)y * 0.03f) + sinf((float)(x + y) * 0.011f);
+			row[x] = h < -0.8f ? 0 : (uint16_t)(1 + (uint32_t)((h + 3.0f) * 2.5f) % (CELLS * CELLS));
+		}
+		og_set_tiles(map, 0, y, MAP_SIZE, 1, row);
+	}
+	free(row);
+
+	uint64_t rebuilt = 0;
+	double cpu_time = 0.0;
+	double start = glfwGetTime();
+	while (p_ctx->running && frames < FRAMES) {
+		og_poll_events(p_ctx);
+
+		cam_x += 3.0f;
+		cam_y += 2.0f;
+		for (uint32_t i = 0; i < EDITS; i++) {
+			uint32_t x = (uint32_t)(cam_x / TILE) + (uint32_t)rand() % (uint32_t)(WIDTH / TILE);
+			uint32_t y = (uint32_t)(cam_y / TILE) + (uint32_t)rand() % (uint32_t)(HEIGHT / TILE);
+			og_set_tile(map, x, y, (uint16_t)(1 + rand() % (CELLS * CELLS)));
+		}
+
+		double before = glfwGetTime();
+		og_render(p_ctx, render);
+		cpu_time += glfwGetTime() - before;
+		rebuilt += map->chunks_rebuilt;
+		frames++;
+	}
+	double elapsed = glfwGetTime() - start;
+
+	printf("[TILEMAP]: %ux%u Tiles, %u Chunks And %u Tiles In View, %.1f Chunks Rebuilt Per Frame, "
+			"%u Pages, %.1f FPS, %.3f ms CPU In og_render\n",
+			MAP_SIZE, MAP_SIZE, map->chunks_drawn, map->tiles_drawn, (double)rebuilt / frames,
+			map->page_count, frames / elapsed, cpu_time * 1000.0 / frames);
+
+	og_destroy_tilemap(p_ctx, map);
+	og_destroy_texture(p_ctx, tileset);
+	og_quit(p_ctx);
+}
+
+void render(OGContext *og_ctx) {
+	OGColor background = {{0.05f, 0.07f, 0.12f, 1}};
+	og_clear_screen(og_ctx, background);
+	og_draw_tilemap(og_ctx, map, cam_x, cam_y, 1.0f);
+}
@@ -17,6 +17,12 @@
 #define OG_API
 #define OG_INT
 
+#define OG_MAX_FRAMES_IN_FLIGHT 4
+#define OG_DEFAULT_FRAMES_IN_FLIGHT 2
+
+// Defined In og_renderer.h, Declared Here So Every Subsystem Header Can Take One
+typedef struct OGContext OGContext;
+
 // #define OG_DEBUG_STRINGS 1 // Human Readable Debugging
 
 #ifdef OG_DEBUG_STRINGS
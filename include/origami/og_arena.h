@@ -0,0 +1,85 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_ARENA_H__
+#define __OG_ARENA_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#define OG_DEFAULT_FRAME_ARENA_SIZE (1ull * 1024 * 1024)
+#define OG_DEFAULT_FRAME_RING_SIZE (4ull * 1024 * 1024)
+#define OG_ARENA_ALIGN 16 // Enough For Any Scalar Or SSE Vector
+#define OG_FRAME_RING_ALIGN 256 // The Largest minUniformBufferOffsetAlignment Allowed
+#define OG_FRAME_UNIFORM_RANGE 16384 // What The Dynamic Uniform Descriptor Covers, The Guaranteed maxUniformBufferRange
+
+// Bump Allocated Host Memory, Rewound All At Once. What Doesn't Fit Spills Into
+// Its Own malloc Until The Reset, Which Grows The Arena To Fit So It Stops Spilling
+typedef struct {
+	uint8_t* base;
+	size_t size;
+	size_t head;
+
+	void** spills;
+	uint32_t spill_count;
+	uint32_t spill_capacity;
+	size_t spilled; // Bytes Spilled Since The Last Reset
+
+	size_t peak; // Most Handed Out Between Two Resets
+} OGArena;
+
+// Persistently Mapped And Written Front To Back, Positions Only Ever Grow And Wrap
+// Around The Buffer. Each Frame Slot Remembers Where Its Allocations Ended, Once
+// Its Fence Has Signaled Everything Up To There Is Free Again
+typedef struct {
+	OGBuffer buffer; // size Plus OG_FRAME_UNIFORM_RANGE, So A Uniform Range Never Runs Off The End
+	VkDeviceSize size;
+	VkDeviceSize uniform_align; // minUniformBufferOffsetAlignment
+	VkDeviceSize data_align; // minStorageBufferOffsetAlignment, At Least OG_ARENA_ALIGN
+	uint64_t head;
+	uint64_t tail;
+	uint64_t ends[OG_MAX_FRAMES_IN_FLIGHT];
+	uint64_t submitted; // head When The Last Frame Went Out
+
+	// One Dynamic Uniform Buffer Binding Over The Whole Ring
+	VkDescriptorSetLayout set_layout;
+	VkDescriptorPool desc_pool;
+	VkDescriptorSet set;
+
+	bool overflowed; // Only The First Failure Is Logged
+	VkDeviceSize bytes_last_frame;
+} OGFrameRing;
+
+
+// Helper Functions
+OG_INT void __init_arena(OGArena *arena, size_t size);
+OG_INT void* __arena_alloc(OGArena *arena, size_t size);
+OG_INT void __reset_arena(OGArena *arena);
+OG_INT void __free_arena(OGArena *arena);
+OG_INT void* __ring_alloc(OGContext *og_ctx, VkDeviceSize size, VkDeviceSize align, VkDeviceSize *offset);
+
+
+// Internal Functions
+OG_INT void _create_frame_arenas(OGContext *og_ctx, size_t arena_size, VkDeviceSize ring_size);
+OG_INT void _begin_frame_arenas(OGContext *og_ctx);
+OG_INT void _end_frame_arenas(OGContext *og_ctx);
+OG_INT void _destroy_frame_arenas(OGContext *og_ctx);
+
+
+// Origami's API
+
+// Host Memory That Lives Until The Next og_render Starts, Never Freed By Hand.
+// Aligned To OG_ARENA_ALIGN, Only For The Thread Driving og_render
+OG_API void* og_frame_alloc(OGContext *og_ctx, size_t size);
+
+// Mapped Memory The GPU Reads This Frame. Uniforms Are Bound Through The Set From
+// og_frame_uniform_set With dynamic_offset, At Most OG_FRAME_UNIFORM_RANGE Each.
+// og_frame_data Suits Vertices, Indices And Storage, Bound At buffer And offset.
+// NULL When The Ring Is Full, Nothing Written This Frame Is Overwritten
+OG_API void* og_frame_uniform(OGContext *og_ctx, VkDeviceSize size, uint32_t *dynamic_offset);
+OG_API void* og_frame_data(OGContext *og_ctx, VkDeviceSize size, VkBuffer *buffer, VkDeviceSize *offset);
+OG_API VkDescriptorSetLayout og_frame_uniform_layout(OGContext *og_ctx);
+OG_API VkDescriptorSet og_frame_uniform_set(OGContext *og_ctx);
+
+#endif // __OG_ARENA_H__
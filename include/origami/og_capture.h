@@ -0,0 +1,93 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_CAPTURE_H__
+#define __OG_CAPTURE_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define OG_CAPTURE_SLOTS 8 // Readback Buffers, Once All Are Busy Frames Are Dropped Instead Of Waited For
+#define OG_CAPTURE_MAX_PATH 512
+
+typedef enum {
+	OG_CAPTURE_TGA = 0, // One Uncompressed TGA Per Frame, Named path_<frame>.tga
+	OG_CAPTURE_RAW, // Every Frame Back To Back As BGRA Into The File At path
+} OGCaptureFormat;
+
+typedef enum {
+	OG_CAPTURE_FREE = 0,
+	OG_CAPTURE_COPYING, // Copy Recorded, Waiting On Its Frame's Fence
+	OG_CAPTURE_WRITING, // Handed To The Writer Thread
+} OGCaptureState;
+
+typedef struct {
+	OGBuffer buffer; // Persistently Mapped, Regrown When The Backbuffer Grows
+	uint32_t state; // OGCaptureState
+	uint32_t frame_slot; // OGFrame Whose Fence Covers The Copy
+	uint32_t width;
+	uint32_t height;
+	uint64_t frame; // frame_number It Was Copied From
+} OGCaptureSlot;
+
+// Slot States And The Counters Are Guarded By lock, The Rest Belongs To Whichever
+// Thread Is Noted. Slots Are Filled And Written Strictly In Ring Order
+typedef struct {
+	bool enabled; // OGConfig.capture, Swapchain Images Are Created Copyable
+	bool supported; // The Backbuffer Can Actually Be Copied From
+	bool active;
+
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool quit;
+
+	OGCaptureFormat format;
+	char path[OG_CAPTURE_MAX_PATH];
+	bool swizzle; // RGBA Backbuffer, Written Out As BGRA
+	FILE* file; // Raw Only, Opened By og_capture_begin, Written By The Writer
+	uint8_t* row; // Writer, Swizzle Scratch
+	uint32_t row_size;
+	uint32_t raw_width; // Main Thread, Raw Frames All Keep The First One's Size
+	uint32_t raw_height;
+
+	OGCaptureSlot slots[OG_CAPTURE_SLOTS];
+	uint32_t next; // Main Thread, Where The Next Copy Goes
+	uint32_t write_pos; // Writer, The Slot It Waits On
+
+	uint64_t frames_captured;
+	uint64_t frames_written;
+	uint64_t frames_dropped; // Writer Behind, Or A Raw Frame Changed Size
+	uint64_t frames_failed; // Couldn't Be Written
+	double write_time; // Seconds The Writer Spent Encoding
+} OGCapture;
+
+
+// Helper Functions
+OG_INT bool __capture_pixels(OGCapture *capture, FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height);
+OG_INT bool __capture_write(OGCapture *capture, OGCaptureSlot *slot);
+OG_INT void* __capture_main(void* data);
+
+
+// Internal Functions
+OG_INT void _init_capture(OGContext *og_ctx, bool enabled);
+OG_INT void _record_capture(OGContext *og_ctx);
+OG_INT void _retire_captures(OGContext *og_ctx);
+OG_INT void _destroy_capture(OGContext *og_ctx);
+
+
+// Origami's API
+
+// Needs OGConfig.capture (Or Headless). From The Next Frame On, Every Frame Is Copied
+// Into A Readback Buffer, Picked Up Once Its Fence Signals And Encoded On A Writer
+// Thread, So The Render Loop Never Waits On The Disk
+OG_API bool og_capture_begin(OGContext *og_ctx, const char* path, OGCaptureFormat format);
+
+// Waits For Frames Still In Flight And For The Writer To Finish Them
+OG_API void og_capture_end(OGContext *og_ctx);
+
+#endif // __OG_CAPTURE_H__
@@ -0,0 +1,60 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_DAMAGE_H__
+#define __OG_DAMAGE_H__
+
+#include "common.h"
+
+#define OG_MAX_DAMAGE_RECTS 16 // More Collapse Into Their Bounding Box
+#define OG_DAMAGE_MAX_IMAGES 8 // Swapchain Images Tracked, Any Beyond Always Redraw Whole
+#define OG_IDLE_WAIT 0.25 // Longest og_poll_events Sleeps Waiting For Input With Nothing To Draw
+
+typedef struct {
+	VkRect2D rects[OG_MAX_DAMAGE_RECTS];
+	uint32_t count;
+	bool full;
+} OGDamageList;
+
+// What Has To Be Redrawn. Every Swapchain Image Keeps Its Own List Of What Changed
+// Since It Was Last Drawn, Since Each One Still Holds An Older Frame
+typedef struct {
+	bool enabled; // OGConfig.on_demand
+	bool incremental; // VK_KHR_incremental_present Is Enabled
+	OGDamageList pending; // Invalidated Since The Last Frame
+	OGDamageList images[OG_DAMAGE_MAX_IMAGES];
+	OGDamageList presented; // What This Frame Changed On Screen, Handed To The Presentation Engine
+	VkRect2D area; // What This Frame Redraws, The Whole Target Unless partial
+	bool partial;
+	uint64_t upload_seen; // Completed Upload Value When Last Checked
+
+	uint64_t frames_skipped;
+	uint64_t frames_partial;
+} OGDamage;
+
+
+// Helper Functions
+OG_INT void __damage_add(OGDamageList *list, VkRect2D rect);
+OG_INT void __damage_merge(OGDamageList *dst, const OGDamageList *src);
+OG_INT VkRect2D __damage_bounds(const OGDamageList *list);
+
+
+// Internal Functions
+OG_INT void _init_damage(OGContext *og_ctx, bool on_demand);
+OG_INT void _reset_damage(OGContext *og_ctx);
+OG_INT bool _damage_idle(OGContext *og_ctx);
+OG_INT bool _damage_frame_needed(OGContext *og_ctx);
+OG_INT void _prepare_damage(OGContext *og_ctx);
+OG_INT bool _present_regions(OGContext *og_ctx, VkPresentRegionsKHR *regions, VkPresentRegionKHR *region,
+		VkRectLayerKHR *rects);
+
+
+// Origami's API
+
+// Only Matter With OGConfig.on_demand, Where og_render Skips Frames Nothing Invalidated.
+// A Rect Only Redraws That Part, Clipped To The Target, Whole Invalidations Redraw Everything
+OG_API void og_invalidate(OGContext *og_ctx);
+OG_API void og_invalidate_rect(OGContext *og_ctx, int32_t x, int32_t y, uint32_t width, uint32_t height);
+
+#endif // __OG_DAMAGE_H__
@@ -0,0 +1,85 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_ENTITY_H__
+#define __OG_ENTITY_H__
+
+#include "common.h"
+#include "og_sprite.h"
+
+#define OG_ENTITY_INDEX_BITS 24 // Up To 16M Live Entities, The Top Bits Count Reuses
+#define OG_ENTITY_INDEX_MASK ((1u << OG_ENTITY_INDEX_BITS) - 1)
+#define OG_ENTITY_NONE 0xFFFFFFFFu
+
+typedef uint32_t OGEntity;
+
+// Entities Drawn With The Same Texture On The Same Layer, One Contiguous Array Per
+// Component. Indices Are Dense And Shift On Removal, Hold On To OGEntity Instead
+typedef struct {
+	OGTexture* texture; // NULL Draws Plain Colored Quads
+	uint32_t layer;
+
+	float* x; // Center, In World Units
+	float* y;
+	float* rotation;
+	float* scale_x; // Quad Size, In World Units
+	float* scale_y;
+	uint32_t* color; // RGBA8
+	uint32_t* slots; // Back To The Entity's Slot
+
+	uint32_t count;
+	uint32_t capacity;
+} OGEntityGroup;
+
+typedef struct {
+	uint32_t group; // Or OG_ENTITY_NONE Once Destroyed
+	uint32_t index; // Into The Group, Next Free Slot Once Destroyed
+	uint32_t generation;
+} OGEntitySlot;
+
+typedef struct {
+	OGEntityGroup* groups;
+	uint32_t group_count;
+	uint32_t group_capacity;
+
+	OGEntitySlot* slots;
+	uint32_t slot_count;
+	uint32_t slot_capacity;
+	uint32_t free_head;
+	uint32_t live;
+} OGEntityStore;
+
+
+// Helper Functions
+OG_INT OGEntityGroup* __entity_group(OGEntityStore *store, OGTexture *texture, uint32_t layer);
+OG_INT uint32_t __entity_push(OGEntityGroup *group, uint32_t slot);
+OG_INT void __entity_pop(OGEntityStore *store, OGEntityGroup *group, uint32_t index);
+OG_INT OGEntitySlot* __entity_slot(const OGEntityStore *store, OGEntity entity);
+OG_INT void __transform_entities(const OGEntityGroup *group, OGSpriteInstance *dst,
+		float view_x, float view_y, float zoom);
+
+
+// Origami's API
+
+// Standalone Like OGSpatialGrid, `capacity` Only Presizes The Handle Table
+OG_API OGEntityStore* og_create_entity_store(uint32_t capacity);
+OG_API void og_destroy_entity_store(OGEntityStore *store);
+
+// Starts At The Origin, Unrotated, 1x1 And White
+OG_API OGEntity og_entity_create(OGEntityStore *store, OGTexture *texture, uint32_t layer);
+OG_API void og_entity_destroy(OGEntityStore *store, OGEntity entity);
+OG_API bool og_entity_alive(const OGEntityStore *store, OGEntity entity);
+
+// Where The Entity's Components Are Right Now, For Writing Them In Place
+OG_API OGEntityGroup* og_entity_get(OGEntityStore *store, OGEntity entity, uint32_t *index);
+OG_API void og_entity_set_transform(OGEntityStore *store, OGEntity entity, float x, float y,
+		float rotation, float scale_x, float scale_y);
+OG_API void og_entity_set_color(OGEntityStore *store, OGEntity entity, VkClearColorValue color);
+OG_API void og_entity_set_texture(OGEntityStore *store, OGEntity entity, OGTexture *texture, uint32_t layer);
+
+// Transforms Every Live Entity Into Screen Space, (view_x, view_y) Being The World Point
+// At The Top Left Of The Screen, And Writes Them Straight Into The Sprite Batch
+OG_API void og_draw_entities(OGContext *og_ctx, const OGEntityStore *store, float view_x, float view_y, float zoom);
+
+#endif // __OG_ENTITY_H__
@@ -0,0 +1,157 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_GRAPH_H__
+#define __OG_GRAPH_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#define OG_GRAPH_MAX_RESOURCES 64
+#define OG_GRAPH_MAX_PASSES 32
+#define OG_GRAPH_MAX_USES 16 // Reads And Writes Per Pass
+#define OG_GRAPH_MAX_COLOR 4 // Color Attachments Per Pass
+#define OG_GRAPH_BACKBUFFER 0 // Always Resource 0, The Swapchain Or Offscreen Target Of The Frame
+
+typedef uint32_t OGGraphResource;
+typedef uint32_t OGGraphPass;
+
+typedef void (*OGGraphPassFn)(OGContext *og_ctx, VkCommandBuffer cmd_buffer, void* data);
+
+typedef enum {
+	OG_GRAPH_IMAGE,
+	OG_GRAPH_BUFFER,
+} OGGraphResourceType;
+
+// How A Pass Touches A Resource, Everything Else Is Derived From This
+typedef enum {
+	OG_ACCESS_COLOR_WRITE, // Color Attachment, Makes The Pass A Render Pass
+	OG_ACCESS_SAMPLED, // Read By Fragment Shaders
+	OG_ACCESS_TRANSFER_SRC,
+	OG_ACCESS_TRANSFER_DST,
+	OG_ACCESS_VERTEX, // Vertex Or Instance Buffer
+	OG_ACCESS_INDIRECT, // Indirect Draw Arguments
+	OG_ACCESS_STORAGE_READ, // Compute Shaders
+	OG_ACCESS_STORAGE_WRITE,
+} OGGraphAccess;
+
+typedef struct {
+	VkFormat format; // 0 Follows The Backbuffer
+	uint32_t width; // 0 Follows The Backbuffer
+	uint32_t height;
+} OGGraphImageDesc;
+
+typedef struct {
+	OGGraphResource resource;
+	OGGraphAccess access;
+	bool clear; // Color Writes Only
+	VkClearValue clear_value;
+} OGGraphUse;
+
+typedef struct {
+	const char* name;
+	OGGraphPassFn fn; // NULL For The Scene Pass og_render Records
+	void* data;
+	OGGraphUse uses[OG_GRAPH_MAX_USES];
+	uint32_t use_count;
+	bool graphics; // Writes Color, Runs Inside A Render Pass
+	bool live; // Something Kept Uses Its Output
+
+	VkRenderPass render_pass;
+	VkFramebuffer* framebuffers; // One Per Backbuffer Image When It Draws Into It, Otherwise One
+	uint32_t framebuffer_count;
+	VkExtent2D extent;
+	VkClearValue clear_values[OG_GRAPH_MAX_COLOR];
+	uint32_t color_count;
+} OGGraphPassNode;
+
+typedef struct {
+	const char* name;
+	OGGraphResourceType type;
+	OGGraphImageDesc desc;
+	OGBuffer* buffer; // Buffers Are Imported, Never Owned
+
+	bool live;
+	uint32_t first_use; // Live Pass Indices, The Range Its Memory Is Needed For
+	uint32_t last_use;
+	VkImageUsageFlags usage;
+
+	VkImage image;
+	VkImageView view;
+	VkFormat format;
+	VkExtent2D extent;
+	uint32_t alias; // Memory Slot, Shared With Resources Whose Lifetimes Don't Overlap
+
+	// Where The Last Recorded Use Left It
+	VkImageLayout layout;
+	VkPipelineStageFlags write_stage; // Last Write Or Layout Transition
+	VkAccessFlags write_access;
+	VkPipelineStageFlags read_stages; // Already Synchronized With That Write
+} OGGraphResourceNode;
+
+// Memory Shared By Transient Images. Whoever Takes It Over Next, This Frame Or
+// The Next One, Has To Wait For Everything That Touched It Since The Last Handover
+typedef struct {
+	OGAllocation alloc;
+	VkMemoryRequirements reqs;
+	VkPipelineStageFlags stages;
+	VkAccessFlags writes;
+} OGGraphAlias;
+
+typedef struct {
+	OGGraphResourceNode resources[OG_GRAPH_MAX_RESOURCES];
+	uint32_t resource_count;
+	OGGraphPassNode passes[OG_GRAPH_MAX_PASSES];
+	uint32_t pass_count;
+	OGGraphAlias aliases[OG_GRAPH_MAX_RESOURCES];
+	uint32_t alias_count;
+
+	OGGraphPass scene;
+	bool building;
+	bool compiled; // Culling And Render Passes, Redone By og_graph_end
+	bool realized; // Images And Framebuffers, Redone After A Resize
+	bool partial_ok; // Only The Scene Touches The Backbuffer, So It Can Redraw Just A Part
+
+	uint32_t culled_passes;
+	VkDeviceSize transient_bytes; // After Aliasing
+	VkDeviceSize unaliased_bytes; // What The Same Images Would Take Apart
+} OGRenderGraph;
+
+
+// Helper Functions
+OG_INT bool __access_writes(OGGraphAccess access);
+OG_INT VkPipelineStageFlags __access_stage(OGGraphAccess access);
+OG_INT VkAccessFlags __access_flags(OGGraphAccess access);
+OG_INT VkImageLayout __access_layout(OGGraphAccess access);
+OG_INT VkImageUsageFlags __access_usage(OGGraphAccess access);
+OG_INT bool __lifetimes_overlap(OGRenderGraph *graph, OGGraphResourceNode *res, uint32_t alias);
+OG_INT bool __sync_use(OGRenderGraph *graph, OGGraphResourceNode *res, OGGraphAccess access,
+		VkImageMemoryBarrier *image_barrier, VkMemoryBarrier *mem_barrier,
+		VkPipelineStageFlags *src_stages, VkPipelineStageFlags *dst_stages);
+OG_INT OGGraphUse* __add_use(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access);
+
+
+// Internal Functions
+OG_INT void _create_graph(OGContext *og_ctx);
+OG_INT void _destroy_graph(OGContext *og_ctx);
+OG_INT void _compile_graph(OGContext *og_ctx);
+OG_INT void _realize_graph(OGContext *og_ctx);
+OG_INT void _invalidate_graph(OGContext *og_ctx);
+OG_INT void _execute_graph(OGContext *og_ctx, void(*render)());
+
+
+// Origami's API
+OG_API void og_graph_begin(OGContext *og_ctx);
+OG_API OGGraphResource og_graph_image(OGContext *og_ctx, const char* name, const OGGraphImageDesc *desc);
+OG_API OGGraphResource og_graph_buffer(OGContext *og_ctx, const char* name, OGBuffer *buffer);
+OG_API OGGraphPass og_graph_pass(OGContext *og_ctx, const char* name, OGGraphPassFn fn, void* data);
+OG_API OGGraphPass og_graph_scene(OGContext *og_ctx, OGGraphResource target, const VkClearColorValue *clear);
+OG_API void og_graph_write_color(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, const VkClearColorValue *clear);
+OG_API void og_graph_read(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access);
+OG_API void og_graph_write(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access);
+OG_API void og_graph_end(OGContext *og_ctx);
+OG_API VkRenderPass og_graph_render_pass(OGContext *og_ctx, OGGraphPass pass);
+OG_API VkImageView og_graph_image_view(OGContext *og_ctx, OGGraphResource resource);
+
+#endif // __OG_GRAPH_H__
@@ -0,0 +1,104 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_JOBS_H__
+#define __OG_JOBS_H__
+
+#include "common.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define OG_MAX_WORKERS 32
+#define OG_JOBS_AUTO UINT32_MAX // One Worker Per Core Besides The Calling Thread
+#define OG_JOB_QUEUE_SIZE 4096 // Per Thread, Power Of Two, A Full Queue Runs Jobs Inline
+
+// Counts Jobs Still Running, Wait On It With og_job_wait
+typedef struct {
+	atomic_uint pending;
+} OGJobCounter;
+
+typedef struct {
+	void (*fn)(void* data);
+	void* data;
+	OGJobCounter* counter;
+} OGJob;
+
+struct OGJobSystem;
+
+// The Owner Pushes And Pops At The Bottom, Idle Threads Steal From The Top
+typedef struct {
+	pthread_mutex_t lock;
+	OGJob jobs[OG_JOB_QUEUE_SIZE];
+	uint32_t top;
+	uint32_t bottom;
+	uint32_t index;
+	struct OGJobSystem* system;
+} OGJobQueue;
+
+// Secondary Command Buffers One Thread Records Into For One Frame Slot
+typedef struct {
+	VkCommandPool pool;
+	VkCommandBuffer* buffers;
+	uint32_t used;
+	uint32_t capacity;
+} OGThreadCommands;
+
+typedef struct OGJobSystem {
+	pthread_t threads[OG_MAX_WORKERS];
+	uint32_t worker_count; // 0 Means Everything Runs On The Calling Thread
+	OGJobQueue* queues; // worker_count + 1, Slot 0 Belongs To The Thread That Called og_init
+
+	pthread_mutex_t sleep_lock;
+	pthread_cond_t wake;
+	atomic_uint queued; // Pushed And Not Yet Taken
+	atomic_bool quit;
+
+	// Indexed [frame slot * (worker_count + 1) + thread]
+	OGThreadCommands* commands;
+
+	// Secondaries Executed, In Order, At The End Of This Frame's Render Pass
+	VkCommandBuffer* secondaries;
+	uint32_t secondary_count;
+	uint32_t secondary_capacity;
+} OGJobSystem;
+
+// Chunks Record Into Their Own Secondary Inside The Current Render Pass And Start
+// With Nothing Bound, So Each Sets Its Own Pipeline, Viewport And Scissor
+typedef void (*OGRecordFn)(OGContext *og_ctx, VkCommandBuffer cmd_buffer, uint32_t chunk, void* data);
+
+typedef struct {
+	OGContext* ctx;
+	OGRecordFn record;
+	void* data;
+	uint32_t chunk;
+	VkCommandBuffer* out;
+} OGRecordJob;
+
+
+// Helper Functions
+OG_INT uint32_t __thread_index();
+OG_INT bool __take_job(OGJobSystem *jobs, uint32_t self, OGJob *out);
+OG_INT void __run_job(OGJob *job);
+OG_INT void* __worker_main(void* arg);
+OG_INT VkCommandBuffer __begin_secondary(OGContext *og_ctx);
+OG_INT void __push_secondary(OGJobSystem *jobs, VkCommandBuffer cmd_buffer);
+OG_INT void __record_job(void* data);
+
+
+// Internal Functions
+OG_INT void _create_job_system(OGContext *og_ctx, uint32_t worker_count);
+OG_INT void _destroy_job_system(OGContext *og_ctx);
+OG_INT void _jobs_frame_begin(OGContext *og_ctx);
+OG_INT void _jobs_pass_begin(OGContext *og_ctx);
+OG_INT void _jobs_pass_end(OGContext *og_ctx, VkCommandBuffer primary);
+
+
+// Origami's API
+OG_API void og_job_submit(OGContext *og_ctx, void (*fn)(void*), void* data, OGJobCounter *counter);
+OG_API void og_job_wait(OGContext *og_ctx, OGJobCounter *counter);
+OG_API uint32_t og_job_thread_count(OGContext *og_ctx);
+OG_API void og_record_parallel(OGContext *og_ctx, uint32_t chunk_count, OGRecordFn record, void* data);
+
+#endif // __OG_JOBS_H__
@@ -0,0 +1,82 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_LOOP_H__
+#define __OG_LOOP_H__
+
+#include "common.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define OG_DEFAULT_TIMESTEP (1.0 / 60.0)
+#define OG_DEFAULT_MAX_UPDATES 8 // Per Catch Up, Beyond That The Clock Slips Instead
+#define OG_LOOP_BUFFERS 4 // One Being Written, One Shared, Two Being Interpolated
+#define OG_LOOP_FRESH 0x80000000u // Set On The Shared Buffer Until The Render Side Takes It
+
+// update Advances The Simulation By Exactly dt And Leaves What Rendering Needs In
+// snapshot, Which Starts Out As A Copy Of The Previous One. Returning false Ends og_run.
+// With threaded Set It Runs On Its Own Thread, So Input Must Reach It Through The
+// Application's Own Synchronized State
+typedef bool (*OGUpdateFn)(OGContext *og_ctx, void* snapshot, double dt, void* user);
+
+// Called Inside og_render, alpha Goes From 0 At prev To 1 At curr
+typedef void (*OGLoopRenderFn)(OGContext *og_ctx, const void* prev, const void* curr, float alpha, void* user);
+
+typedef struct {
+	double timestep; // Seconds Per Update, 0 Picks OG_DEFAULT_TIMESTEP
+	uint32_t max_updates; // 0 Picks OG_DEFAULT_MAX_UPDATES
+	bool threaded; // Simulation On Its Own Thread, Render Recording Stays On The Caller's
+	size_t snapshot_size; // Bytes Of Render State update Fills In
+	const void* initial; // First Snapshot, NULL Starts Zeroed
+	OGUpdateFn update;
+	OGLoopRenderFn render;
+	void* user;
+} OGLoopConfig;
+
+// Snapshots Change Hands Through One Atomic: The Simulation Swaps Its Finished Buffer
+// Into middle, The Render Side Swaps Its Oldest Out For Whatever Is Fresh There
+typedef struct {
+	OGLoopConfig cfg;
+
+	uint8_t* buffers[OG_LOOP_BUFFERS];
+	double times[OG_LOOP_BUFFERS]; // Real Time Each Snapshot Stands For, Travels With It
+	atomic_uint middle;
+
+	// Simulation Side
+	uint32_t back;
+	uint32_t last; // Published Last, What The Next Snapshot Starts From
+	double start; // Real Time That Simulation Time Zero Lines Up With
+	double sim_time;
+	uint64_t ticks;
+	double dropped; // Seconds Given Up When Too Far Behind
+
+	// Render Side
+	uint32_t prev;
+	uint32_t curr;
+	uint32_t received; // Snapshots Picked Up, Interpolation Starts At Two
+	float alpha;
+
+	pthread_t thread;
+	bool threaded;
+	atomic_bool stop;
+	atomic_bool finished; // update Asked To End
+} OGLoop;
+
+
+// Helper Functions
+OG_INT bool __loop_advance(OGContext *og_ctx, double now);
+OG_INT bool __loop_receive(OGLoop *loop);
+OG_INT void* __loop_main(void* data);
+OG_INT void __loop_render(OGContext *og_ctx);
+
+
+// Origami's API
+
+// Drives og_poll_events And og_render Until The Window Closes Or update Returns false.
+// Updates Run At A Fixed Rate Whatever The Frame Rate, Frames Show The Simulation
+// One Timestep Behind Real Time, Interpolated Between The Two Snapshots Around It
+OG_API void og_run(OGContext *og_ctx, const OGLoopConfig *cfg);
+
+#endif // __OG_LOOP_H__
@@ -0,0 +1,120 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_MEMORY_H__
+#define __OG_MEMORY_H__
+
+#include "common.h"
+
+#define OG_MEMORY_BLOCK_SIZE (64ull * 1024 * 1024)
+
+typedef enum {
+	OG_MEMORY_GPU_ONLY, // Device Local, Never Mapped
+	OG_MEMORY_CPU_TO_GPU, // Mapped, Device Local When The Device Has Such Memory
+	OG_MEMORY_GPU_TO_CPU, // Mapped, Cached When Available, For Readbacks
+	OG_MEMORY_CPU_ONLY, // Mapped Host Memory, For Staging
+} OGMemoryUsage;
+
+typedef enum {
+	OG_ALLOC_FREE_LIST, // First Fit, Freed Ranges Coalesce With Their Neighbours
+	OG_ALLOC_LINEAR, // Bump Pointer, The Block Rewinds Once Everything In It Is Freed
+} OGAllocStrategy;
+
+typedef struct {
+	VkDeviceSize offset;
+	VkDeviceSize size;
+} OGMemRange;
+
+typedef struct {
+	VkDeviceMemory memory;
+	VkDeviceSize size;
+	uint32_t type_idx;
+	OGAllocStrategy strategy;
+	bool dedicated;
+	void* mapped;
+
+	// Free List, Kept Sorted By Offset
+	OGMemRange* free_ranges;
+	uint32_t free_count;
+	uint32_t free_capacity;
+
+	// Linear
+	VkDeviceSize head;
+
+	uint32_t live;
+	VkDeviceSize used;
+	VkDeviceSize wasted;
+} OGMemBlock;
+
+typedef struct {
+	OGMemBlock* block;
+	VkDeviceMemory memory;
+	VkDeviceSize offset; // Aligned, What Gets Bound
+	VkDeviceSize size;
+	VkDeviceSize range_offset; // What Was Carved Out Of The Block, Padding Included
+	VkDeviceSize range_size;
+	void* mapped; // NULL Unless The Memory Is Host Visible
+} OGAllocation;
+
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceSize size;
+	OGAllocation alloc;
+} OGBuffer;
+
+typedef struct {
+	VkImage image;
+	OGAllocation alloc;
+} OGImage;
+
+typedef struct {
+	VkDeviceSize bytes_reserved; // Sum Of All Blocks
+	VkDeviceSize bytes_used; // Handed Out To Resources
+	VkDeviceSize bytes_wasted; // Lost To Alignment Padding
+	uint32_t block_count;
+	uint32_t allocation_count;
+} OGMemoryStats;
+
+typedef struct {
+	VkPhysicalDeviceMemoryProperties mem_props;
+	VkDeviceSize granularity; // bufferImageGranularity
+	VkDeviceSize block_size;
+
+	OGMemBlock** blocks;
+	uint32_t block_count;
+	uint32_t block_capacity;
+	uint32_t allocation_count;
+} OGAllocator;
+
+
+// Helper Functions
+OG_INT uint32_t __pick_memory_type(OGAllocator *allocator, uint32_t type_bits, OGMemoryUsage usage);
+OG_INT OGMemBlock* __create_mem_block(OGContext *og_ctx, uint32_t type_idx, VkDeviceSize size, OGAllocStrategy strategy);
+OG_INT void __destroy_mem_block(OGContext *og_ctx, OGMemBlock *block);
+OG_INT bool __block_alloc(OGMemBlock *block, VkDeviceSize size, VkDeviceSize align, OGAllocation *out);
+OG_INT void __block_free(OGMemBlock *block, OGAllocation *alloc);
+OG_INT bool __create_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGAllocStrategy strategy, OGBuffer *out);
+
+
+// Internal Functions
+OG_INT void _create_allocator(OGContext *og_ctx);
+OG_INT void _destroy_allocator(OGContext *og_ctx);
+OG_INT bool _mem_alloc(OGContext *og_ctx, const VkMemoryRequirements *reqs, OGMemoryUsage usage,
+		OGAllocStrategy strategy, bool optimal_image, OGAllocation *out);
+OG_INT void _mem_free(OGContext *og_ctx, OGAllocation *alloc);
+
+
+// Origami's API
+OG_API bool og_create_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out);
+OG_API bool og_create_transient_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out);
+OG_API void og_destroy_buffer(OGContext *og_ctx, OGBuffer *buffer);
+OG_API bool og_create_image(OGContext *og_ctx, const VkImageCreateInfo *img_create_info,
+		OGMemoryUsage mem_usage, OGImage *out);
+OG_API void og_destroy_image(OGContext *og_ctx, OGImage *image);
+OG_API OGMemoryStats og_memory_stats(OGContext *og_ctx);
+
+#endif // __OG_MEMORY_H__
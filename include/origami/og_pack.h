@@ -0,0 +1,81 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_PACK_H__
+#define __OG_PACK_H__
+
+#include "common.h"
+#include "og_sprite.h"
+
+#define OG_PACK_MAGIC 0x4b50474f // "OGPK"
+#define OG_PACK_VERSION 1
+#define OG_PACK_ALIGN 256 // Every Entry's Data Starts On This, Enough For Any Texel Block Or SPIR-V
+#define OG_PACK_EMPTY 0xFFFFFFFFu // Unused Slot In The Lookup Table
+
+typedef enum {
+	OG_PACK_BLOB = 0,
+	OG_PACK_TEXTURE = 1,
+	OG_PACK_SHADER = 2,
+} OGPackType;
+
+// Everything In The File Is Little Endian And Laid Out As These Structs.
+// The Header Is Followed By The Data, Then The Entries, The Slots And The Names
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entry_count;
+	uint32_t slot_count; // Power Of Two, At Least Twice entry_count
+	uint64_t entries_offset;
+	uint64_t slots_offset; // uint32_t Entry Indices, Open Addressed On The Name Hash
+	uint64_t names_offset; // NUL Terminated Names, Back To Back
+	uint64_t file_size;
+} OGPackHeader;
+
+typedef struct {
+	uint64_t hash; // __fnv1a Of The Name, Without The NUL
+	uint64_t offset; // From The Start Of The File
+	uint64_t size;
+	uint32_t name; // Offset Into The Name Table
+	uint32_t type; // OGPackType
+	uint32_t format; // VkFormat, Textures Only
+	uint32_t width;
+	uint32_t height;
+	uint32_t mip_levels; // Largest First, Each Level Tightly Packed
+} OGPackEntry;
+
+// A Read Only Mapping Of The Whole File, Nothing Is Copied Out Of It On Open
+typedef struct {
+	const uint8_t* base;
+	size_t size;
+	const OGPackHeader* header;
+	const OGPackEntry* entries;
+	const uint32_t* slots;
+	const char* names;
+} OGPack;
+
+
+// Helper Functions
+OG_INT bool __validate_pack(const OGPack *pack);
+
+
+// Internal Functions
+OG_INT bool _upload_pack_texture(OGContext *og_ctx, const OGPack *pack, const OGPackEntry *entry, OGTexture *texture);
+
+
+// Origami's API
+
+// Standalone Like OGSpatialGrid, Keep It Open For As Long As Anything Points Into It
+OG_API OGPack* og_open_pack(const char* path);
+OG_API void og_close_pack(OGPack *pack);
+
+// Constant Time, NULL When The Name Isn't In The Pack
+OG_API const OGPackEntry* og_pack_find(const OGPack *pack, const char* name);
+OG_API const void* og_pack_data(const OGPack *pack, const OGPackEntry *entry);
+OG_API const void* og_pack_blob(const OGPack *pack, const char* name, size_t *size);
+
+// Staged Straight From The Mapping, Sprites Draw White Until The Upload Lands
+OG_API OGTexture* og_load_pack_texture(OGContext *og_ctx, const OGPack *pack, const char* name);
+OG_API VkShaderModule og_load_pack_shader(OGContext *og_ctx, const OGPack *pack, const char* name);
+
+#endif // __OG_PACK_H__
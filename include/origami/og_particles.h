@@ -0,0 +1,127 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_PARTICLES_H__
+#define __OG_PARTICLES_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#define OG_DEFAULT_MAX_PARTICLES (1 << 16)
+#define OG_MAX_EMITS 64 // og_emit_particles Calls Per Frame
+#define OG_PARTICLE_GROUP 256 // Keep In Sync With local_size_x In The Particle Shaders
+#define OG_PARTICLE_MAX_DT 0.1f // Longer Frames Simulate As This, So A Stall Doesn't Scatter Everything
+
+// What The Shaders Read And Write, Keep In Sync With shaders/particle.glsl
+typedef struct {
+	float pos[2];
+	float vel[2];
+	float life; // Seconds Left
+	float max_life;
+	uint32_t size; // Start And End Size As Two Halves
+	uint32_t color; // RGBA8, Fades Out Over Its Life
+} OGParticle;
+
+// Particles Spawn Somewhere In The spread Box Around pos, Moving At velocity Plus
+// Up To velocity_jitter In A Random Direction. Keep In Sync With particle.glsl
+typedef struct {
+	float pos[2];
+	float spread[2];
+	float velocity[2];
+	float velocity_jitter;
+	float life; // Seconds
+	float life_jitter; // Life Varies By Up To Half This Either Way
+	float size; // Pixels, Shrinks Or Grows Toward size_end
+	float size_end;
+	uint32_t color; // RGBA8, See og_particle_color
+	uint32_t first; // Filled In By og_emit_particles
+	uint32_t count;
+} OGParticleEmitter;
+
+// Two Indirect Draws, One Per Particle Buffer. Their instanceCount Is That
+// Buffer's Live Count, So Nothing Has To Copy It Anywhere Before The Draw
+typedef struct {
+	VkDrawIndirectCommand draw[2];
+	VkDispatchIndirectCommand dispatch; // Sized By The Prep Pass For The Simulation
+	uint32_t pad;
+} OGParticleCounters;
+
+typedef struct {
+	float gravity[2];
+	float dt;
+	float drag;
+	uint32_t capacity;
+	uint32_t src_idx;
+	uint32_t emit_base;
+	uint32_t emit_count;
+	uint32_t emit_total;
+	uint32_t seed;
+} OGParticlePush;
+
+typedef struct {
+	VkPipeline emit_pipeline;
+	VkPipeline prep_pipeline;
+	VkPipeline sim_pipeline;
+	VkPipeline draw_pipeline;
+	VkPipelineLayout compute_layout;
+	VkPipelineLayout draw_layout;
+	VkDescriptorSetLayout set_layout;
+	VkDescriptorPool desc_pool;
+	VkDescriptorSet sets[2]; // sets[i] Reads particles[i] And Writes The Other
+
+	// Device Local, Never Seen By The CPU After Creation
+	OGBuffer particles[2];
+	OGBuffer counters;
+	OGBuffer emitters; // Mapped, OG_MAX_EMITS Per Frame Slot
+	uint32_t capacity;
+	uint32_t current; // Which Buffer Holds The Live Particles
+
+	// Queued Since The Last Simulation
+	OGParticleEmitter emits[OG_MAX_EMITS];
+	uint32_t emit_count;
+	uint32_t emit_total;
+
+	float gravity[2];
+	float drag;
+	double last_time;
+	double sim_time; // Seconds Simulated So Far, dt Clamps Included
+	double alive_until; // sim_time By Which Every Particle Emitted So Far Has Died
+	bool active; // Something May Be Alive, Nothing Is Recorded Or Drawn Otherwise
+
+	// Async Compute, Only With A Compute Family Apart From Graphics
+	bool async;
+	uint32_t families[2]; // Graphics And Compute, For Concurrent Sharing
+	VkCommandPool pools[OG_MAX_FRAMES_IN_FLIGHT];
+	VkCommandBuffer cmd_buffers[OG_MAX_FRAMES_IN_FLIGHT];
+	VkSemaphore timeline; // Odd Values Are Simulations Done, Even Ones Frames Done With The Buffers
+	uint64_t sim_value; // What This Frame's Draws Wait On, 0 When Nothing Was Simulated
+	uint64_t frame_value; // What This Frame's Submission Signals
+
+	uint32_t emitted; // Asked For By The Last Simulation, Some May Not Have Fit
+} OGParticleSystem;
+
+
+// Helper Functions
+OG_INT bool __create_particle_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out);
+OG_INT void __record_particles(OGContext *og_ctx, VkCommandBuffer cmd_buffer, float dt);
+
+
+// Internal Functions
+OG_INT void _create_particle_pipelines(OGContext *og_ctx);
+OG_INT void _create_particle_system(OGContext *og_ctx, uint32_t capacity, bool async);
+OG_INT void _simulate_particles(OGContext *og_ctx);
+OG_INT void _draw_particles(OGContext *og_ctx);
+OG_INT void _destroy_particle_system(OGContext *og_ctx);
+
+
+// Origami's API
+
+// Spawned On The GPU At The Start Of The Next Frame, Whatever Doesn't Fit In
+// max_particles Is Dropped There. Particles Draw Between Sprites And Shapes
+OG_API void og_emit_particles(OGContext *og_ctx, const OGParticleEmitter *emitter, uint32_t count);
+OG_API void og_particle_forces(OGContext *og_ctx, float gravity_x, float gravity_y, float drag);
+OG_API uint32_t og_particle_color(VkClearColorValue color);
+
+#endif // __OG_PARTICLES_H__
@@ -0,0 +1,87 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_PIPELINE_H__
+#define __OG_PIPELINE_H__
+
+#include "common.h"
+
+#define OG_PIPELINE_CACHE_MAGIC 0x4350474f // "OGPC"
+#define OG_FNV_OFFSET 0xcbf29ce484222325ull
+#define OG_FNV_PRIME 0x100000001b3ull
+
+// Written In Front Of The Driver's Blob, Which Only Carries The UUID Itself
+typedef struct {
+	uint32_t magic;
+	uint32_t driver_version;
+	uint32_t vendor_id;
+	uint32_t device_id;
+	uint8_t uuid[VK_UUID_SIZE];
+	uint64_t data_size;
+	uint64_t data_hash;
+} OGPipelineCacheHeader;
+
+typedef struct {
+	uint64_t hash; // Of code, Checked First
+	size_t size;
+	uint32_t* code; // Copy Of The SPIR-V, A Hit Needs It To Match Byte For Byte
+	VkShaderModule module;
+} OGShaderEntry;
+
+// Every Field Of A Create Info That Shapes The Pipeline, Laid Out Back To Back
+typedef struct {
+	uint8_t* data;
+	size_t size;
+	size_t capacity;
+} OGPipelineKey;
+
+typedef struct {
+	uint64_t hash; // Of key, Checked First
+	uint8_t* key; // NULL For Descriptions That Can't Be Keyed, Never Matched
+	size_t key_size;
+	VkPipeline pipeline;
+} OGPipelineEntry;
+
+typedef struct {
+	VkPipelineCache cache;
+	const char* path; // NULL Keeps The Cache In Memory Only
+	bool warm; // A Valid Cache Was Loaded From path
+
+	OGShaderEntry* shaders;
+	uint32_t shader_count;
+	uint32_t shader_capacity;
+
+	OGPipelineEntry* pipelines;
+	uint32_t pipeline_count;
+	uint32_t pipeline_capacity;
+
+	// Lookups Served From The Tables Rather Than Built
+	uint32_t shader_hits;
+	uint32_t pipeline_hits;
+} OGPipelineCache;
+
+
+// Helper Functions
+OG_INT uint64_t __fnv1a(uint64_t hash, const void* data, size_t size);
+OG_INT void __key_append(OGPipelineKey *key, const void* data, size_t size);
+OG_INT bool __key_stage(OGPipelineKey *key, const VkPipelineShaderStageCreateInfo *stage);
+OG_INT bool __graphics_pipeline_key(OGPipelineKey *key, const VkGraphicsPipelineCreateInfo *gp_create_info);
+OG_INT bool __compute_pipeline_key(OGPipelineKey *key, const VkComputePipelineCreateInfo *cp_create_info);
+OG_INT VkPipeline __cached_pipeline(OGPipelineCache *pc, const OGPipelineKey *key, uint64_t hash);
+OG_INT void __cache_pipeline(OGPipelineCache *pc, OGPipelineKey *key, uint64_t hash, VkPipeline pipeline);
+OG_INT void* __load_pipeline_cache(OGContext *og_ctx, const char* path, size_t *size);
+
+
+// Internal Functions
+OG_INT void _create_pipeline_cache(OGContext *og_ctx, const char* path);
+OG_INT void _save_pipeline_cache(OGContext *og_ctx);
+OG_INT void _destroy_pipeline_cache(OGContext *og_ctx);
+
+
+// Origami's API
+OG_API VkShaderModule og_get_shader_module(OGContext *og_ctx, const uint32_t *code, size_t size);
+OG_API VkPipeline og_get_graphics_pipeline(OGContext *og_ctx, const VkGraphicsPipelineCreateInfo *gp_create_info);
+OG_API VkPipeline og_get_compute_pipeline(OGContext *og_ctx, const VkComputePipelineCreateInfo *cp_create_info);
+
+#endif // __OG_PIPELINE_H__
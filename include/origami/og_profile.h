@@ -0,0 +1,124 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_PROFILE_H__
+#define __OG_PROFILE_H__
+
+#include "common.h"
+
+// Build With -DOG_PROFILE (make PROFILE=1) To Turn Profiling On, Without It
+// Every Macro Below Expands To Nothing And None Of The Code Is Compiled.
+// The Types Are Always Declared, So OGContext Has One Layout Either Way
+
+#define OG_PROFILE_MAX_SCOPES 64 // GPU Scopes Per Frame
+#define OG_PROFILE_MAX_DEPTH 16
+#define OG_PROFILE_HISTORY 256 // Frames The Rolling Stats Cover
+#define OG_PROFILE_MAX_EVENTS (1 << 16) // Kept For The Trace, Oldest Dropped First
+
+typedef struct {
+	const char* name;
+	double start_ms; // Since The Profiler Was Created
+	double end_ms;
+	uint64_t frame;
+	uint32_t depth;
+	bool gpu;
+} OGProfileEvent;
+
+typedef struct {
+	double last_ms;
+	double min_ms;
+	double avg_ms;
+	double p99_ms;
+} OGProfileStat;
+
+typedef struct {
+	OGProfileStat cpu_frame; // Between Two og_render Calls
+	OGProfileStat gpu_frame; // First To Last Command Of The Frame On The GPU
+	uint64_t frames;
+	uint32_t sprite_binds; // Texture Binds The Last Frame's Sorted Sprite Runs Issued
+	uint32_t sprite_binds_unsorted; // What Replaying Them In Submission Order Would Have Issued
+} OGProfileStats;
+
+// GPU Scopes Recorded Into One Frame Slot, Read Back When The Slot Comes Around Again
+typedef struct {
+	VkQueryPool query_pool;
+	const char* names[OG_PROFILE_MAX_SCOPES];
+	uint32_t depths[OG_PROFILE_MAX_SCOPES];
+	uint32_t scope_count;
+	uint32_t open[OG_PROFILE_MAX_DEPTH];
+	uint32_t open_count;
+	double record_ms; // Anchors The GPU Clock To The CPU One In The Trace
+	uint64_t frame;
+	bool recorded;
+} OGProfileFrame;
+
+typedef struct {
+	OGProfileFrame frames[OG_MAX_FRAMES_IN_FLIGHT];
+	bool gpu_timing; // The Graphics Queue Supports Timestamps
+	double ns_per_tick;
+	uint64_t tick_mask;
+	double epoch_ms;
+	double last_frame_ms;
+	uint64_t frame; // og_render Call CPU Scopes Are Attributed To
+
+	const char* cpu_names[OG_PROFILE_MAX_DEPTH];
+	double cpu_starts[OG_PROFILE_MAX_DEPTH];
+	uint32_t cpu_depth;
+
+	OGProfileEvent* events;
+	uint32_t event_head;
+	uint32_t event_count;
+
+	double cpu_history[OG_PROFILE_HISTORY];
+	double gpu_history[OG_PROFILE_HISTORY];
+	uint64_t cpu_samples;
+	uint64_t gpu_samples;
+
+	OGProfileStats stats;
+} OGProfiler;
+
+#ifdef OG_PROFILE
+
+#define OG_PROFILE_HOOK(call) call
+#define OG_PROFILE_CPU_BEGIN(ctx, name) og_profile_cpu_begin(ctx, name)
+#define OG_PROFILE_CPU_END(ctx) og_profile_cpu_end(ctx)
+#define OG_PROFILE_GPU_BEGIN(ctx, name) og_profile_gpu_begin(ctx, name)
+#define OG_PROFILE_GPU_END(ctx) og_profile_gpu_end(ctx)
+
+
+// Helper Functions
+OG_INT double __profile_now_ms();
+OG_INT void __profile_push_event(OGProfiler *prof, const OGProfileEvent *event);
+OG_INT OGProfileStat __profile_stat(const double *history, uint64_t samples);
+OG_INT int __compare_doubles(const void *a, const void *b);
+
+
+// Internal Functions
+OG_INT void _create_profiler(OGContext *og_ctx);
+OG_INT void _destroy_profiler(OGContext *og_ctx);
+OG_INT void _profile_frame_begin(OGContext *og_ctx);
+OG_INT void _profile_frame_end(OGContext *og_ctx);
+OG_INT void _profile_collect(OGContext *og_ctx);
+OG_INT void _profile_record_begin(OGContext *og_ctx);
+OG_INT void _profile_record_end(OGContext *og_ctx);
+
+
+// Origami's API
+OG_API void og_profile_cpu_begin(OGContext *og_ctx, const char* name);
+OG_API void og_profile_cpu_end(OGContext *og_ctx);
+OG_API void og_profile_gpu_begin(OGContext *og_ctx, const char* name);
+OG_API void og_profile_gpu_end(OGContext *og_ctx);
+OG_API bool og_profile_dump_trace(OGContext *og_ctx, const char* path);
+
+#else
+
+#define OG_PROFILE_HOOK(call)
+#define OG_PROFILE_CPU_BEGIN(ctx, name) ((void)0)
+#define OG_PROFILE_CPU_END(ctx) ((void)0)
+#define OG_PROFILE_GPU_BEGIN(ctx, name) ((void)0)
+#define OG_PROFILE_GPU_END(ctx) ((void)0)
+
+#endif // OG_PROFILE
+
+#endif // __OG_PROFILE_H__
@@ -6,22 +6,92 @@
 #define __OG_RENDERER_H__
 
 #include "common.h"
+#include "og_memory.h"
+#include "og_arena.h"
+#include "og_upload.h"
+#include "og_pipeline.h"
+#include "og_profile.h"
+#include "og_jobs.h"
+#include "og_graph.h"
+#include "og_damage.h"
+#include "og_capture.h"
+#include "og_sprite.h"
+#include "og_shape.h"
+#include "og_particles.h"
+#include "og_tilemap.h"
+#include "og_text.h"
+#include "og_spatial.h"
+#include "og_entity.h"
+#include "og_pack.h"
+#include "og_stream.h"
+#include "og_loop.h"
+
+// Falls Back To FIFO, The Only Mode Every Surface Has, When The Choice Isn't Supported
+typedef enum {
+	OG_PRESENT_DEFAULT = 0, // Mailbox Where Available, Otherwise FIFO
+	OG_PRESENT_IMMEDIATE, // Lowest Latency, Tears
+	OG_PRESENT_MAILBOX, // Low Latency Without Tearing, Renders Frames That Are Never Shown
+	OG_PRESENT_FIFO, // VSync, Lowest Power
+	OG_PRESENT_FIFO_RELAXED, // VSync, Tears Instead Of Waiting When A Frame Is Late
+} OGPresentMode;
 
 typedef struct {
 	bool vd_layers;
 	const char* app_name;
 	uint32_t win_width;
 	uint32_t win_height;
+	uint32_t frames_in_flight; // 0 Picks OG_DEFAULT_FRAMES_IN_FLIGHT
+	bool headless; // Render Into Engine Owned Images, No Window Or Surface
+	bool readback; // Copy Finished Frames Into Host Memory, See og_read_frame
+	uint32_t max_sprites; // Per Frame, 0 Picks OG_DEFAULT_MAX_SPRITES
+	uint32_t max_shape_vertices; // Per Frame, 0 Picks OG_DEFAULT_MAX_SHAPE_VERTICES
+	uint64_t upload_ring_size; // Bytes Of Staging, 0 Picks OG_DEFAULT_UPLOAD_RING_SIZE
+	const char* pipeline_cache_path; // Loaded In og_init, Written In og_quit, NULL Skips The Disk
+	uint32_t job_threads; // Workers Besides The Calling Thread, 0 Records Inline, OG_JOBS_AUTO Uses Every Core
+	OGPresentMode present_mode;
+	uint32_t swapchain_images; // 0 Picks One More Than The Surface Minimum, Fewer Means Less Queued Latency
+	uint32_t max_fps; // Frame Cap Applied In og_poll_events, 0 Is Uncapped
+	uint64_t stream_budget; // Streamed Bytes Uploaded Per Frame, 0 Picks OG_DEFAULT_STREAM_BUDGET
+	uint64_t frame_arena_size; // Host Bytes Per Frame Before Spilling, 0 Picks OG_DEFAULT_FRAME_ARENA_SIZE
+	uint64_t frame_ring_size; // Bytes Of Transient GPU Data Across All Frames In Flight, 0 Picks OG_DEFAULT_FRAME_RING_SIZE
+	uint32_t max_particles; // Alive At Once, 0 Picks OG_DEFAULT_MAX_PARTICLES
+	bool async_compute; // Simulate Particles On A Compute Only Queue When The Device Has One
+	bool on_demand; // og_render Skips Frames Nothing Invalidated, See og_invalidate
+	bool capture; // Swapchain Images Can Be Copied Out, See og_capture_begin
 } OGConfig;
 
+// A Finished Frame In Host Memory, Valid Until The Next og_render
+typedef struct {
+	const void* pixels;
+	uint32_t width;
+	uint32_t height;
+	uint32_t stride;
+	VkFormat format;
+	uint64_t frame;
+} OGFrameData;
+
 
 typedef struct {
 	VkExtent2D size;
 	GLFWwindow* screen;
 } Win;
 
+// Everything One Frame Slot Needs, Reused Once Its Fence Signals
 typedef struct {
+	VkCommandPool command_pool;
+	VkCommandBuffer cmd_buffer;
+
+	VkFence in_flight_fence;
+	VkSemaphore acquire_img_semaphore;
+
+	OGBuffer readback;
+	bool readback_pending;
+	uint64_t frame_number;
+} OGFrame;
+
+struct OGContext {
 	Win* win;
+	OGAllocator allocator;
 
 	VkInstance instance;
 	VkDebugUtilsMessengerEXT debug_messenger;
@@ -32,26 +102,69 @@ typedef struct {
 	VkPhysicalDevice physical_device;
 	VkDevice logical_device;
 	VkSwapchainKHR swapchain;
-	VkRenderPass render_pass;
-	VkFramebuffer framebuffers[5];
-	VkImageView sc_img_views[5];
+	VkRenderPass render_pass; // Only Describes The Backbuffer Format For Pipeline Creation
+	VkImageView* sc_img_views;
 
 	VkQueue graphics_queue;
-	VkImage sc_images[5];
-	VkCommandPool command_pool;
+	VkQueue transfer_queue; // Same As graphics_queue Without A Dedicated Family
+	VkQueue compute_queue; // Same As graphics_queue Without A Compute Only Family
+	VkImage* sc_images;
+	VkSemaphore* sc_submit_semaphores; // Per Image, A Present Can Still Be Waiting On One After Its Frame Slot Is Reused
+	OGImage* offscreen; // Only Used By Headless Targets, Backs sc_images
+	uint32_t sc_img_count;
 	VkCommandBuffer curr_cmd_buffer;
+	VkRenderPass curr_render_pass; // Of The Graph Pass Being Recorded
+	VkFramebuffer curr_framebuffer;
+	VkExtent2D curr_extent;
+	VkRect2D curr_scissor; // What Draws May Touch, Smaller Than curr_extent On Partial Frames
+	VkCommandPool one_shot_pool;
 
-	VkSemaphore acquire_img_semaphore;
-	VkSemaphore submit_semaphore;
+	OGFrame frames[OG_MAX_FRAMES_IN_FLIGHT];
+	uint32_t frame_count;
+	uint32_t frame_idx;
+	uint64_t frame_number;
 
 	uint32_t img_idx;
 	uint32_t graphics_idx;
+	uint32_t transfer_idx;
+	uint32_t compute_idx;
+	bool headless;
+	bool readback;
+	bool async_compute;
+	bool descriptor_indexing; // Textures Share One Bindless Array, See OGTextureRegistry
 	bool running;
-} OGContext;
+
+	OGPresentMode present_mode;
+	uint32_t swapchain_images;
+	bool swapchain_dirty; // Resized Or Out Of Date, Rebuilt At The Start Of The Next Frame
+	uint32_t max_fps;
+	double next_frame_time;
+
+	OGArena frame_arena;
+	OGFrameRing frame_ring;
+	OGUploader upload;
+	OGPipelineCache pipelines;
+	OGJobSystem jobs;
+	OGRenderGraph graph;
+	OGDamage damage;
+	OGCapture capture;
+	OGProfiler profiler; // Only Filled In With OG_PROFILE
+	OGSpriteBatch sprites;
+	OGShapeBatch shapes;
+	OGParticleSystem particles;
+	OGTileRenderer tiles;
+	OGTextSystem text;
+	OGStreamer stream;
+	OGLoop loop;
+};
 
 // Helper Functions
-OG_INT static VKAPI_ATTR VkBool32 VKAPI_CALL __debug_callback();
-OG_INT void __alloc_cmd_buffer(OGContext *og_ctx);
+OG_INT VkCommandBuffer __begin_one_shot(OGContext *og_ctx);
+OG_INT void __end_one_shot(OGContext *og_ctx, VkCommandBuffer cmd_buffer);
+OG_INT double __now_seconds();
+OG_INT void __framebuffer_size_callback(GLFWwindow *window, int width, int height);
+OG_INT void __window_refresh_callback(GLFWwindow *window);
+OG_INT VkPresentModeKHR __pick_present_mode(OGContext *og_ctx);
 
 
 // Internal Functions
@@ -63,11 +176,17 @@ OG_INT void _handle_default_events(OGContext *og_ctx);
 OG_INT void _choose_physical_device(OGContext *og_ctx);
 OG_INT void _create_logical_device(OGContext *og_ctx);
 OG_INT void _create_swapchain(OGContext *og_ctx);
-OG_INT void _create_framebuffer(OGContext *og_ctx);
+OG_INT bool _recreate_swapchain(OGContext *og_ctx);
+OG_INT void _destroy_targets(OGContext *og_ctx);
+OG_INT void _wait_frames(OGContext *og_ctx);
+OG_INT void _pace_frame(OGContext *og_ctx);
+OG_INT void _create_offscreen_targets(OGContext *og_ctx);
+OG_INT void _create_readback_buffers(OGContext *og_ctx);
 OG_INT void _create_pipeline(OGContext *og_ctx);
 OG_INT void _create_command_pool(OGContext *og_ctx);
 OG_INT void _create_sync_objects(OGContext *og_ctx);
 OG_INT void _create_render_pass(OGContext *og_ctx);
+OG_INT void _record_scene(OGContext *og_ctx, void(*render)());
 
 
 // Origami's API
@@ -80,6 +199,8 @@ OG_API void og_init(OGContext *og_ctx, OGConfig *og_cfg);
 OG_API void og_poll_events(OGContext *og_ctx);
 OG_API void og_clear_screen(OGContext *og_ctx, OGColor color);
 OG_API void og_render(OGContext *og_ctx, void(*render)());
+OG_API bool og_read_frame(OGContext *og_ctx, OGFrameData *out, bool wait);
+OG_API void og_resize(OGContext *og_ctx, uint32_t width, uint32_t height);
 OG_API void og_quit(OGContext *og_ctx);
 
 #endif // __OG_RENDERER_H__
@@ -0,0 +1,77 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_SHAPE_H__
+#define __OG_SHAPE_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#define OG_DEFAULT_MAX_SHAPE_VERTICES (1 << 18)
+#define OG_SHAPE_MIN_SEGMENTS 8
+#define OG_SHAPE_MAX_SEGMENTS 256 // Circles Use A Power Of Two In Between
+#define OG_SHAPE_TOLERANCE 0.25f // Pixels A Circle's Edge May Be Off By
+
+// What The Vertex Shader Reads, Keep In Sync With shape.vert
+typedef struct {
+	float pos[2];
+	uint32_t color; // RGBA8
+} OGShapeVertex;
+
+typedef struct {
+	VkPipeline pipeline;
+	VkPipelineLayout layout;
+
+	// Persistently Mapped, One Per Frame Slot, Filled Once On Flush
+	OGBuffer vertex_buffers[OG_MAX_FRAMES_IN_FLIGHT];
+	OGBuffer index_buffers[OG_MAX_FRAMES_IN_FLIGHT];
+
+	// Everything Drawn This Frame, In Call Order
+	OGShapeVertex* vertices;
+	uint32_t* indices;
+	uint32_t vertex_count;
+	uint32_t index_count;
+	uint32_t vertex_capacity;
+	uint32_t index_capacity;
+	bool overflowed;
+
+	// Unit Circles, Each Segment Count's Points Start At (segments - OG_SHAPE_MIN_SEGMENTS)
+	float unit_x[2 * OG_SHAPE_MAX_SEGMENTS];
+	float unit_y[2 * OG_SHAPE_MAX_SEGMENTS];
+
+	uint32_t shapes; // Queued This Frame
+	uint32_t shapes_drawn; // Submitted By The Last Flush
+	uint32_t vertices_drawn;
+} OGShapeBatch;
+
+
+// Helper Functions
+OG_INT bool __reserve_shape(OGShapeBatch *batch, uint32_t vertex_count, uint32_t index_count);
+OG_INT void __write_vertices(OGShapeVertex *dst, const float *xs, const float *ys, uint32_t count, uint32_t color);
+OG_INT void __write_quad(OGShapeVertex *dst, float x, float y, float ax, float ay, float bx, float by, uint32_t color);
+OG_INT void __write_points(OGShapeVertex *dst, const float *points, uint32_t count, uint32_t color);
+OG_INT void __write_fan(uint32_t *dst, uint32_t center, uint32_t first, uint32_t triangles, bool closed);
+OG_INT void __write_circle(OGShapeVertex *dst, const float *unit_x, const float *unit_y,
+		uint32_t segments, float x, float y, float radius, uint32_t color);
+OG_INT uint32_t __circle_segments(float radius);
+OG_INT void __init_shape_arena(OGShapeBatch *batch, uint32_t max_vertices);
+
+
+// Internal Functions
+OG_INT void _create_shape_pipeline(OGContext *og_ctx);
+OG_INT void _create_shape_batch(OGContext *og_ctx, uint32_t max_vertices);
+OG_INT void _flush_shapes(OGContext *og_ctx);
+OG_INT void _reset_shapes(OGContext *og_ctx);
+OG_INT void _destroy_shape_batch(OGContext *og_ctx);
+
+
+// Origami's API
+
+// Shapes Are Drawn Over The Frame's Sprites In The Order They Were Queued
+OG_API void og_draw_rect(OGContext *og_ctx, float x, float y, float w, float h, VkClearColorValue color);
+OG_API void og_draw_line(OGContext *og_ctx, float x0, float y0, float x1, float y1, float thickness, VkClearColorValue color);
+OG_API void og_draw_circle(OGContext *og_ctx, float x, float y, float radius, VkClearColorValue color);
+OG_API void og_draw_polygon(OGContext *og_ctx, const float *points, uint32_t count, VkClearColorValue color);
+
+#endif // __OG_SHAPE_H__
@@ -0,0 +1,72 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_SPATIAL_H__
+#define __OG_SPATIAL_H__
+
+#include "common.h"
+
+#define OG_SPATIAL_LARGE 0xFFFFFFFFu // Bucket Of Items Wider Or Taller Than A Cell
+#define OG_SPATIAL_FREE 0xFFFFFFFEu // Bucket Of Removed Items
+
+typedef uint32_t OGSpatialHandle;
+
+typedef struct {
+	float min_x, min_y, max_x, max_y;
+	uint32_t user; // Handed Back By Queries
+	int32_t cell_x; // Cell Holding Its Center
+	int32_t cell_y;
+	uint32_t bucket; // Or OG_SPATIAL_LARGE / OG_SPATIAL_FREE
+	uint32_t slot; // Position In The Bucket, Next Free Item Once Removed
+} OGSpatialItem;
+
+typedef struct {
+	uint32_t* items;
+	uint32_t count;
+	uint32_t capacity;
+} OGSpatialBucket;
+
+// Loose Spatial Hash: Each Item Sits In The One Cell Holding Its Center, Queries
+// Widen By Half A Cell To Catch Items Hanging Over. Cells Hash Into A Fixed Number
+// Of Buckets, So The World Has No Bounds
+typedef struct {
+	float cell_size;
+	float inv_cell_size;
+
+	OGSpatialItem* items;
+	uint32_t item_count; // Slots Ever Used, Live Or Free
+	uint32_t item_capacity;
+	uint32_t free_head;
+	uint32_t live;
+
+	OGSpatialBucket* buckets;
+	uint32_t bucket_mask;
+	OGSpatialBucket large;
+
+	uint32_t tested; // Items Looked At By The Last Query
+} OGSpatialGrid;
+
+
+// Helper Functions
+OG_INT uint32_t __spatial_bucket(const OGSpatialGrid *grid, int32_t cell_x, int32_t cell_y);
+OG_INT void __spatial_link(OGSpatialGrid *grid, OGSpatialHandle handle);
+OG_INT void __spatial_unlink(OGSpatialGrid *grid, OGSpatialHandle handle);
+
+
+// Origami's API
+
+// `cell_size` Around The Typical Object Size Works Best, `capacity` Only Presizes
+OG_API OGSpatialGrid* og_create_spatial_grid(float cell_size, uint32_t capacity);
+OG_API void og_destroy_spatial_grid(OGSpatialGrid *grid);
+
+OG_API OGSpatialHandle og_spatial_insert(OGSpatialGrid *grid, float min_x, float min_y, float max_x, float max_y, uint32_t user);
+OG_API void og_spatial_move(OGSpatialGrid *grid, OGSpatialHandle handle, float min_x, float min_y, float max_x, float max_y);
+OG_API void og_spatial_remove(OGSpatialGrid *grid, OGSpatialHandle handle);
+
+// Writes The `user` Value Of Up To `max_out` Items Overlapping The Rectangle, Each
+// Once, And Returns How Many Overlap In Total
+OG_API uint32_t og_spatial_query(OGSpatialGrid *grid, float min_x, float min_y, float max_x, float max_y,
+		uint32_t *out, uint32_t max_out);
+
+#endif // __OG_SPATIAL_H__
@@ -0,0 +1,131 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_SPRITE_H__
+#define __OG_SPRITE_H__
+
+#include "common.h"
+#include "og_memory.h"
+#include "og_upload.h"
+
+#define OG_DEFAULT_MAX_SPRITES (1 << 17)
+#define OG_MAX_TEXTURES 1024 // Without Descriptor Indexing, One Set Each
+#define OG_BINDLESS_TEXTURES 4096 // With It, Keep In Sync With shaders/sprite_bindless.frag
+#define OG_OVERLAY_LAYER 0x80000000u // This Layer And Up Draw Over Shapes, Text Uses It
+
+typedef struct {
+	OGImage image;
+	VkImageView view;
+	VkDescriptorSet set; // The Registry's Shared Set When Bindless
+	uint32_t width;
+	uint32_t height;
+	uint32_t id; // Registry Slot, Small And Dense. Used In Batch Sort Keys And Indexes The Bindless Array
+	OGUploadToken upload; // Sprites Fall Back To White Until This Completes
+	uint32_t stream; // Request Slot Plus One While Streaming In, See og_stream.h
+} OGTexture;
+
+typedef struct {
+	float x, y; // Center In Pixels
+	float w, h;
+	float rotation; // Radians
+	float u0, v0, u1, v1; // All Zero Samples The Whole Texture
+	VkClearColorValue color;
+	OGTexture* texture; // NULL Draws A Plain Colored Quad
+	uint32_t layer; // Lower Layers Are Drawn First
+} OGSprite;
+
+// What The Vertex Shader Reads Per Instance, Keep In Sync With sprite.vert
+typedef struct {
+	float pos[2];
+	float size[2];
+	float uv[4];
+	uint32_t color; // RGBA8
+	float rotation;
+	float sdf; // 1 Reads The Texture As A Distance Field, See og_text.h
+	uint32_t texture; // OGTexture.id, Only Read When Bindless
+} OGSpriteInstance;
+
+// Sort Key, Layer In The High Half So It Always Wins, Then Texture. The Batch Has
+// One Pipeline For Sprites And Text Alike, So Nothing Else Needs A Field. Order
+// Within A Key Is Kept By The Sort Being Stable
+#define OG_SPRITE_KEY(layer, texture_id) (((uint64_t)(layer) << 32) | (uint32_t)(texture_id))
+
+// A Contiguous Range Of Instances Sharing One Texture And Layer
+typedef struct {
+	uint64_t key;
+	OGTexture* texture;
+	uint32_t first;
+	uint32_t count;
+} OGSpriteRun;
+
+// Hands Out Texture Slots, Reusing Those Freed By og_destroy_texture. With Descriptor
+// Indexing Every Texture Is Written Into One Update After Bind Array, So Textures Can
+// Be Added While Frames Are In Flight And A Whole Batch Draws Under One Bind
+typedef struct {
+	bool bindless;
+	VkDescriptorSet set; // The Array, Bindless Only
+	uint32_t capacity; // OG_BINDLESS_TEXTURES When Bindless, Otherwise Unbounded
+
+	uint32_t next_id; // Slots Handed Out So Far
+	uint32_t* free_ids;
+	uint32_t free_count;
+	uint32_t free_capacity;
+	uint32_t live;
+} OGTextureRegistry;
+
+typedef struct {
+	VkPipeline pipeline;
+	VkPipelineLayout layout;
+	VkDescriptorSetLayout set_layout;
+	VkDescriptorPool desc_pool;
+	VkSampler sampler;
+	OGTexture* white;
+
+	// Persistently Mapped, One Per Frame Slot
+	OGBuffer instance_buffers[OG_MAX_FRAMES_IN_FLIGHT];
+	uint32_t capacity;
+
+	// Recorded This Frame, Sorted And Copied Into The Mapped Buffer On Flush
+	OGSpriteInstance* instances;
+	uint32_t count;
+	OGSpriteRun* runs;
+	OGSpriteRun* sorted_runs;
+	uint32_t run_count;
+	uint32_t flushed_runs; // Sorted Runs Already Drawn This Frame
+	uint32_t run_capacity;
+	bool overflowed;
+
+	OGTextureRegistry registry;
+	uint32_t draw_calls; // Issued By The Last Flush
+	uint32_t binds; // Texture Binds Issued By The Last Flush
+	uint32_t binds_unsorted; // Texture Changes Between The Last Flush's Runs In Submission Order
+	uint32_t sprites_drawn; // Submitted By The Last Flush
+} OGSpriteBatch;
+
+
+// Helper Functions
+OG_INT uint32_t __pack_color(VkClearColorValue color);
+OG_INT void __sort_runs(OGSpriteBatch *batch);
+OG_INT void __init_sprite_arena(OGSpriteBatch *batch, uint32_t max_sprites);
+
+
+// Internal Functions
+OG_INT void _create_sprite_pipeline(OGContext *og_ctx);
+OG_INT void _create_sprite_batch(OGContext *og_ctx, uint32_t max_sprites);
+OG_INT bool _create_texture(OGContext *og_ctx, OGTexture *texture, uint32_t width, uint32_t height,
+		VkFormat format, uint32_t mip_levels);
+OG_INT bool _acquire_texture_id(OGContext *og_ctx, OGTexture *texture);
+OG_INT void _release_texture_id(OGContext *og_ctx, OGTexture *texture);
+OG_INT void _create_texture_set(OGContext *og_ctx, OGTexture *texture);
+OG_INT OGSpriteInstance* _reserve_sprites(OGContext *og_ctx, OGTexture *texture, uint32_t layer, uint32_t count);
+OG_INT void _flush_sprites(OGContext *og_ctx, bool overlay);
+OG_INT void _destroy_sprite_batch(OGContext *og_ctx);
+
+
+// Origami's API
+OG_API OGTexture* og_create_texture(OGContext *og_ctx, uint32_t width, uint32_t height, const void* rgba);
+OG_API void og_destroy_texture(OGContext *og_ctx, OGTexture *texture);
+OG_API void og_draw_sprite(OGContext *og_ctx, const OGSprite *sprite);
+
+#endif // __OG_SPRITE_H__
@@ -0,0 +1,108 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_STREAM_H__
+#define __OG_STREAM_H__
+
+#include "common.h"
+#include "og_sprite.h"
+#include "og_pack.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define OG_DEFAULT_STREAM_BUDGET (4ull * 1024 * 1024) // Bytes Handed To The GPU Per Frame
+#define OG_STREAM_NONE 0xFFFFFFFFu
+#define OG_STREAM_PENDING UINT64_MAX // Upload Token Of A Placeholder, Never Completes
+#define OG_STREAM_ABORT_STRIDE (1u << 20) // Bytes Read Between Checks For A Cancel
+
+typedef enum {
+	OG_STREAM_FREE = 0,
+	OG_STREAM_QUEUED, // In The Heap, Waiting For The Reader
+	OG_STREAM_READING, // Being Paged In On The Streaming Thread
+	OG_STREAM_READY, // Paged In, Waiting For Room In A Frame's Budget
+	OG_STREAM_FAILED, // Couldn't Be Created, Stays White Until Cancelled
+} OGStreamState;
+
+typedef struct {
+	OGTexture* texture; // Handed Out Right Away, Drawn White Until Resident
+	const OGPack* pack;
+	const OGPackEntry* entry;
+
+	float hint; // Explicit Priority, Lower Streams Sooner
+	float x, y; // Where It Is In The World, Only Used When positioned
+	bool positioned;
+	float key; // hint Plus Distance To The Focus, What The Heap Orders By
+
+	uint32_t state; // OGStreamState
+	uint32_t heap_idx; // While Queued, Next Free Slot Once Freed
+	bool cancelled; // Freed By The Next Pump, Once The Reader Is Done With It
+} OGStreamRequest;
+
+// Everything Here Is Guarded By lock, Except What Only The Main Thread Touches
+typedef struct {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool quit;
+	bool running; // The Thread Was Started
+	atomic_bool abort; // Cancels The Read In Progress
+	uint32_t reading; // Slot On The Streaming Thread, Or OG_STREAM_NONE
+	size_t page_size;
+
+	// Slots Only Grow On The Main Thread, The Reader Indexes Them Under The Lock
+	OGStreamRequest* requests;
+	uint32_t request_count;
+	uint32_t request_capacity;
+	uint32_t free_head;
+	uint32_t pending; // Main Thread, Requests Queued, Being Read Or Ready, Failed Ones Don't Count
+
+	uint32_t* heap; // Queued Slots, Min Heap On key
+	uint32_t heap_count;
+	uint32_t heap_capacity;
+
+	uint32_t* ready; // Paged In, In The Order They Were Read
+	uint32_t ready_count;
+	uint32_t ready_capacity;
+
+	float focus_x, focus_y;
+	uint64_t budget;
+
+	uint64_t bytes_last_frame; // Handed To The GPU By The Last Pump
+	uint32_t textures_streamed;
+	uint32_t requests_cancelled;
+} OGStreamer;
+
+
+// Helper Functions
+OG_INT void __stream_swap(OGStreamer *streamer, uint32_t a, uint32_t b);
+OG_INT void __stream_sift_up(OGStreamer *streamer, uint32_t pos);
+OG_INT void __stream_sift_down(OGStreamer *streamer, uint32_t pos);
+OG_INT void __stream_heap_remove(OGStreamer *streamer, uint32_t pos);
+OG_INT void __stream_free(OGStreamer *streamer, uint32_t slot);
+OG_INT OGTexture* __stream_push(OGContext *og_ctx, const OGPack *pack, const char* name,
+		bool positioned, float x, float y, float priority);
+OG_INT bool __stream_read(OGStreamer *streamer, const uint8_t *data, size_t size);
+OG_INT void* __stream_main(void* data);
+
+
+// Internal Functions
+OG_INT void _create_streamer(OGContext *og_ctx, uint64_t budget);
+OG_INT void _pump_streamer(OGContext *og_ctx);
+OG_INT void _destroy_streamer(OGContext *og_ctx);
+
+
+// Origami's API
+
+// The Texture Comes Back At Once And Draws White Until Its Texels Land. Streamed
+// Textures Are Released With og_stream_cancel, Whether Or Not They Arrived, And
+// The Pack Has To Stay Open Until Everything Streamed From It Is Resident
+OG_API OGTexture* og_stream_texture(OGContext *og_ctx, const OGPack *pack, const char* name, float priority);
+OG_API OGTexture* og_stream_texture_at(OGContext *og_ctx, const OGPack *pack, const char* name,
+		float x, float y, float priority);
+OG_API void og_stream_prioritize(OGContext *og_ctx, OGTexture *texture, float priority);
+OG_API void og_stream_focus(OGContext *og_ctx, float x, float y);
+OG_API void og_stream_cancel(OGContext *og_ctx, OGTexture *texture);
+
+#endif // __OG_STREAM_H__
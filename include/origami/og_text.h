@@ -0,0 +1,143 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_TEXT_H__
+#define __OG_TEXT_H__
+
+#include "common.h"
+#include "og_memory.h"
+#include "og_arena.h"
+#include "og_sprite.h"
+
+#define OG_TEXT_ATLAS_SIZE 1024 // R8, Square
+#define OG_GLYPH_SDF_SIZE 32 // Pixels Per Em Glyphs Are Rasterized At, Drawn At Any Size
+#define OG_GLYPH_SDF_RANGE 4 // Pixels Of Distance Either Side Of The Outline
+#define OG_FONT_GLYPH_SLOTS 1024 // Per Font, Power Of Two
+#define OG_TEXT_RUN_SLOTS 8192 // Shaped Run Cache, Power Of Two
+#define OG_TEXT_RUN_WAYS 8 // Slots A String May Land In, The Least Recently Used Is Evicted
+#define OG_TEXT_UPLOAD_SIZE (256 * 1024) // Glyph Bytes Staged Per Frame
+#define OG_TEXT_GLYPHS_PER_FRAME 32 // New Glyphs Rasterized Per Frame, The Rest Wait A Frame
+
+typedef enum {
+	OG_GLYPH_EMPTY, // Slot Unused
+	OG_GLYPH_UNPLACED, // Known But Not In The Atlas Yet, Retried On Next Use
+	OG_GLYPH_BLANK, // Nothing To Draw, Whitespace Or Missing From The Font
+	OG_GLYPH_READY,
+} OGGlyphState;
+
+typedef struct {
+	uint32_t codepoint;
+	uint32_t index; // Into The Font's Glyph Table
+	OGGlyphState state;
+	float advance; // Ems
+
+	// Quad In Ems Relative To The Pen, y Down, And Where It Sits In The Atlas
+	float x0, y0, x1, y1;
+	float u0, v0, u1, v1;
+} OGGlyph;
+
+// Only What Drawing Needs From A TrueType File: Metrics, cmap And glyf Outlines
+typedef struct {
+	uint8_t* data;
+	uint32_t size;
+
+	uint32_t cmap; // Offset Of The Unicode Subtable
+	uint16_t cmap_format; // 4 Or 12
+	uint32_t loca;
+	uint32_t glyf;
+	uint32_t hmtx;
+	uint16_t hmetric_count;
+	uint16_t glyph_count;
+	bool long_loca;
+
+	float units_per_em;
+	float ascent; // Ems
+	float descent;
+	float line_gap;
+
+	OGGlyph glyphs[OG_FONT_GLYPH_SLOTS]; // Open Addressing By Codepoint
+	uint32_t glyphs_used;
+} OGFont;
+
+typedef struct {
+	float x0, y0, x1, y1; // Ems, Top Left Of The Run At The Origin
+	float u0, v0, u1, v1;
+} OGGlyphQuad;
+
+// A String Laid Out Once And Replayed Every Frame It Is Drawn Again
+typedef struct {
+	uint64_t hash;
+	OGFont* font;
+	char* text;
+	uint32_t length;
+	uint32_t text_capacity;
+
+	OGGlyphQuad* quads;
+	uint32_t count;
+	uint32_t capacity;
+	float width; // Ems, Longest Line
+	float height;
+	bool complete; // False While Any Glyph Is Still Unplaced
+	uint64_t last_used;
+} OGTextRun;
+
+typedef struct {
+	OGTexture* atlas; // Sampled Through The Sprite Batch
+
+	// Shelf Packing, Rows Of Glyphs Left To Right, Top To Bottom
+	uint32_t shelf_x;
+	uint32_t shelf_y;
+	uint32_t shelf_height;
+	bool atlas_full;
+
+	// Rasterized Since The Last Frame, Copied Into The Atlas When The Next One Is Recorded
+	uint8_t* pending;
+	uint32_t pending_size;
+	VkBufferImageCopy* pending_copies;
+	uint32_t pending_count;
+	uint32_t pending_capacity;
+	OGBuffer staging[OG_MAX_FRAMES_IN_FLIGHT];
+
+	// Flattened Outline Of The Glyph Being Rasterized, x0 y0 x1 y1 Per Edge
+	float* edges;
+	uint32_t edge_count;
+	uint32_t edge_capacity;
+
+	OGTextRun* runs; // OG_TEXT_RUN_SLOTS, Set Associative By Hash
+	uint64_t run_clock;
+	uint32_t glyphs_rasterized;
+	uint64_t runs_shaped;
+	uint64_t runs_reused;
+} OGTextSystem;
+
+
+// Helper Functions
+OG_INT bool __parse_font(OGFont *font);
+OG_INT uint32_t __font_glyph_index(const OGFont *font, uint32_t codepoint);
+OG_INT void __font_outline(OGTextSystem *text, OGArena *scratch, const OGFont *font, uint32_t index, float dx, float dy, uint32_t depth);
+OG_INT void __rasterize_sdf(const float *edges, uint32_t edge_count, float origin_x, float origin_y,
+		uint8_t *dst, uint32_t width, uint32_t height);
+OG_INT OGGlyph* __get_glyph(OGContext *og_ctx, OGFont *font, uint32_t codepoint);
+OG_INT OGTextRun* __get_run(OGContext *og_ctx, OGFont *font, const char *str);
+
+
+// Internal Functions
+OG_INT void _create_text_system(OGContext *og_ctx);
+OG_INT void _flush_glyphs(OGContext *og_ctx);
+OG_INT void _destroy_text_system(OGContext *og_ctx);
+
+
+// Origami's API
+
+// TrueType Outlines Only (glyf), No Kerning Or Complex Shaping. NULL On Failure
+OG_API OGFont* og_load_font(OGContext *og_ctx, const char* path);
+OG_API void og_destroy_font(OGContext *og_ctx, OGFont *font);
+
+// (x, y) Is The Top Left Of The First Line, `size` Its Em Height In Pixels. '\n' Starts A
+// New Line. Drawn On OG_OVERLAY_LAYER, Over Sprites And Shapes, Through The Sprite Batch
+OG_API void og_draw_text(OGContext *og_ctx, OGFont *font, const char* str, float x, float y,
+		float size, VkClearColorValue color);
+OG_API void og_measure_text(OGContext *og_ctx, OGFont *font, const char* str, float size, float *w, float *h);
+
+#endif // __OG_TEXT_H__
@@ -0,0 +1,103 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_TILEMAP_H__
+#define __OG_TILEMAP_H__
+
+#include "common.h"
+#include "og_memory.h"
+#include "og_upload.h"
+#include "og_sprite.h"
+
+#define OG_TILEMAP_CHUNK 32 // Tiles Per Chunk Side, At Most 256 For OG_TILE_PACK
+#define OG_TILEMAP_CHUNK_TILES (OG_TILEMAP_CHUNK * OG_TILEMAP_CHUNK)
+#define OG_TILEMAP_PAGE_CHUNKS 128 // Chunks Sharing One Device Buffer
+#define OG_TILEMAP_MAX_REBUILDS 64 // Per og_draw_tilemap, The Rest Wait For Later Frames
+#define OG_TILEMAP_NONE 0xFFFFFFFFu
+
+// One Instance Per Non Empty Tile, Keep In Sync With shaders/tile.vert
+#define OG_TILE_PACK(x, y, cell) ((uint32_t)(x) | ((uint32_t)(y) << 8) | ((uint32_t)(cell) << 16))
+
+// Keep In Sync With shaders/tile.vert
+typedef struct {
+	float scale[2];
+	float offset[2];
+	float origin[2];
+	float tile_size;
+	uint32_t columns;
+	float cell[2];
+	float inset[2];
+	uint32_t tileset;
+} OGTilePush;
+
+// Two Halves In Its Page, One Drawn While The Other Takes A Rebuild. The Halves
+// Swap Once The Upload Completes, So A Frame In Flight Never Sees A Write
+typedef struct {
+	uint32_t slot; // Index Across Every Page, OG_TILEMAP_NONE Until It First Has Tiles
+	uint32_t counts[2]; // Instances In Each Half
+	uint64_t drawn[2]; // frame_number Plus One Each Half Was Last Drawn In, 0 If Never
+	OGUploadToken upload; // Filling The Half Not Shown
+	uint8_t shown;
+	bool pending; // Swap To The Other Half Once upload Completes
+	bool dirty; // Tiles Changed Since The Last Rebuild
+} OGTilemapChunk;
+
+typedef struct {
+	uint32_t width; // In Tiles
+	uint32_t height;
+	float tile_size; // World Pixels
+	uint16_t* tiles; // Row Major, 0 Is Empty And Anything Else Is Tileset Cell Plus One
+
+	OGTexture* tileset;
+	uint32_t columns;
+
+	OGTilemapChunk* chunks; // Row Major Too
+	uint32_t chunks_x;
+	uint32_t chunks_y;
+
+	// Device Local, Written Only Through The Uploader
+	OGBuffer* pages;
+	uint32_t page_count;
+	uint32_t slot_count; // Chunk Slots Handed Out So Far
+
+	uint32_t chunks_drawn; // By The Last og_draw_tilemap
+	uint32_t chunks_rebuilt;
+	uint32_t tiles_drawn;
+} OGTilemap;
+
+typedef struct {
+	VkPipeline pipeline;
+	VkPipelineLayout layout;
+} OGTileRenderer;
+
+
+// Helper Functions
+OG_INT bool __create_tile_page(OGContext *og_ctx, OGBuffer *out);
+OG_INT bool __rebuild_chunk(OGContext *og_ctx, OGTilemap *map, uint32_t cx, uint32_t cy);
+
+
+// Internal Functions
+OG_INT void _create_tile_renderer(OGContext *og_ctx);
+OG_INT void _destroy_tile_renderer(OGContext *og_ctx);
+
+
+// Origami's API
+
+// The Tileset Is A Grid Of tile_size Cells, `columns` Across. No Geometry Exists
+// Until A Chunk First Comes Into View
+OG_API OGTilemap* og_create_tilemap(OGContext *og_ctx, uint32_t width, uint32_t height, float tile_size,
+		OGTexture *tileset, uint32_t columns);
+OG_API void og_destroy_tilemap(OGContext *og_ctx, OGTilemap *map);
+
+// Only Marks The Chunk Dirty, It Is Rebuilt The Next Time It Is Drawn
+OG_API void og_set_tile(OGTilemap *map, uint32_t x, uint32_t y, uint16_t tile);
+OG_API uint16_t og_get_tile(const OGTilemap *map, uint32_t x, uint32_t y);
+OG_API void og_set_tiles(OGTilemap *map, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *tiles);
+
+// Draws The Chunks Overlapping The View With cam_x, cam_y At The Top Left Corner,
+// Rebuilding Those That Are Dirty. Recorded Straight Away, So Call It From The
+// Render Callback And It Lands Under Sprites, Particles And Shapes
+OG_API void og_draw_tilemap(OGContext *og_ctx, OGTilemap *map, float cam_x, float cam_y, float zoom);
+
+#endif // __OG_TILEMAP_H__
@@ -0,0 +1,81 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#ifndef __OG_UPLOAD_H__
+#define __OG_UPLOAD_H__
+
+#include "common.h"
+#include "og_memory.h"
+
+#define OG_DEFAULT_UPLOAD_RING_SIZE (16ull * 1024 * 1024)
+#define OG_UPLOAD_BATCHES 4
+#define OG_UPLOAD_ALIGN 16
+#define OG_UPLOAD_MAX_MIPS 16 // Enough For 32768x32768
+
+// Timeline Value The Copy Completes At, Zero Means Nothing To Wait For
+typedef uint64_t OGUploadToken;
+
+// One Submission Worth Of Copies, Recorded Between Flushes
+typedef struct {
+	VkCommandPool command_pool;
+	VkCommandBuffer cmd_buffer;
+	uint64_t value; // Signaled On The Timeline Once Every Copy In Here Is Done
+	uint64_t ring_end; // Ring Position The Batch Releases Up To On Completion
+	bool recording;
+	bool in_flight;
+	uint32_t copy_count;
+
+	// Uploads Too Big For The Ring Get Their Own Staging, Freed On Completion
+	OGBuffer* oversized;
+	uint32_t oversized_count;
+	uint32_t oversized_capacity;
+} OGUploadBatch;
+
+typedef struct {
+	VkQueue queue;
+	uint32_t family;
+	uint32_t families[2]; // Graphics And Transfer, For Concurrent Sharing
+	bool concurrent; // Families Differ, Resources Must Be Shared Across Both
+
+	// Persistently Mapped Staging Ring, Positions Only Ever Grow
+	OGBuffer ring;
+	VkDeviceSize ring_size;
+	uint64_t head;
+	uint64_t tail;
+
+	OGUploadBatch batches[OG_UPLOAD_BATCHES];
+	uint32_t batch_idx;
+
+	VkSemaphore timeline;
+	uint64_t last_value; // Highest Value Handed To A Batch
+	uint64_t submitted; // Highest Value Already Submitted
+	uint64_t completed; // Highest Value Seen Signaled
+} OGUploader;
+
+
+// Helper Functions
+OG_INT OGUploadBatch* __upload_batch(OGContext *og_ctx);
+OG_INT OGUploadBatch* __upload_stage(OGContext *og_ctx, const void* data, VkDeviceSize size,
+		VkBuffer *src, VkDeviceSize *src_offset);
+OG_INT void __retire_uploads(OGContext *og_ctx);
+OG_INT VkDeviceSize __image_level_size(VkFormat format, uint32_t width, uint32_t height);
+
+
+// Internal Functions
+OG_INT void _create_uploader(OGContext *og_ctx, VkDeviceSize ring_size);
+OG_INT void _destroy_uploader(OGContext *og_ctx);
+
+
+// Origami's API
+OG_API OGUploadToken og_upload_buffer(OGContext *og_ctx, VkBuffer dst, VkDeviceSize dst_offset,
+		const void* data, VkDeviceSize size);
+OG_API OGUploadToken og_upload_image(OGContext *og_ctx, VkImage dst, uint32_t width, uint32_t height,
+		const void* rgba);
+OG_API OGUploadToken og_upload_image_mips(OGContext *og_ctx, VkImage dst, VkFormat format,
+		uint32_t width, uint32_t height, uint32_t mip_levels, const void* data);
+OG_API OGUploadToken og_upload_flush(OGContext *og_ctx);
+OG_API bool og_upload_done(OGContext *og_ctx, OGUploadToken token);
+OG_API void og_upload_wait(OGContext *og_ctx, OGUploadToken token);
+
+#endif // __OG_UPLOAD_H__
@@ -9,5 +9,24 @@
 #define __ORIGAMI_H_
 
 #include "og_renderer.h"
+#include "og_memory.h"
+#include "og_arena.h"
+#include "og_upload.h"
+#include "og_pipeline.h"
+#include "og_profile.h"
+#include "og_jobs.h"
+#include "og_graph.h"
+#include "og_damage.h"
+#include "og_capture.h"
+#include "og_sprite.h"
+#include "og_shape.h"
+#include "og_particles.h"
+#include "og_tilemap.h"
+#include "og_text.h"
+#include "og_spatial.h"
+#include "og_entity.h"
+#include "og_pack.h"
+#include "og_stream.h"
+#include "og_loop.h"
 
 #endif // __ORIGAMI_H_
@@ -0,0 +1,53 @@
+// Shared By The Particle Shaders, Keep In Sync With og_particles.h
+
+struct Particle {
+	vec2 pos;
+	vec2 vel;
+	float life; // Seconds Left
+	float max_life;
+	uint size; // Start And End, packHalf2x16
+	uint color; // RGBA8, Fades Out With life
+};
+
+struct Emitter {
+	vec2 pos;
+	vec2 spread;
+	vec2 velocity;
+	float velocity_jitter;
+	float life;
+	float life_jitter;
+	float size;
+	float size_end;
+	uint color;
+	uint first;
+	uint count;
+};
+
+struct DrawArgs {
+	uint vertex_count;
+	uint instance_count; // Doubles As The Live Count Of Its Buffer
+	uint first_vertex;
+	uint first_instance;
+};
+
+layout(std430, set = 0, binding = 0) buffer Src { Particle src[]; };
+layout(std430, set = 0, binding = 1) buffer Dst { Particle dst[]; };
+layout(std430, set = 0, binding = 2) buffer Counters {
+	DrawArgs draw[2];
+	uint dispatch_x;
+	uint dispatch_y;
+	uint dispatch_z;
+};
+layout(std430, set = 0, binding = 3) readonly buffer Emitters { Emitter emitters[]; };
+
+layout(push_constant) uniform Push {
+	vec2 gravity;
+	float dt;
+	float drag;
+	uint capacity;
+	uint src_idx; // Which draw[] Counts src
+	uint emit_base;
+	uint emit_count;
+	uint emit_total;
+	uint seed;
+} pc;
@@ -0,0 +1,41 @@
+#version 450
+
+struct Particle {
+	vec2 pos;
+	vec2 vel;
+	float life;
+	float max_life;
+	uint size;
+	uint color;
+};
+
+// What The Simulation Just Wrote, One Instance Each
+layout(std430, set = 0, binding = 1) readonly buffer Dst { Particle particles[]; };
+
+// Pixels To Clip Space
+layout(push_constant) uniform Push {
+	vec2 scale;
+	vec2 offset;
+} pc;
+
+layout(location = 0) out vec2 out_uv;
+layout(location = 1) out vec4 out_color;
+
+const vec2 corners[6] = vec2[](
+	vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5),
+	vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5)
+);
+
+void main() {
+	Particle p = particles[gl_InstanceIndex];
+	vec2 corner = corners[gl_VertexIndex];
+
+	float t = 1.0 - p.life / p.max_life;
+	vec2 sizes = unpackHalf2x16(p.size);
+	vec2 world = p.pos + corner * mix(sizes.x, sizes.y, t);
+
+	gl_Position = vec4(world * pc.scale + pc.offset, 0.0, 1.0);
+	out_uv = corner * 2.0;
+	out_color = unpackUnorm4x8(p.color);
+	out_color.a *= 1.0 - t;
+}
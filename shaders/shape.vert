@@ -0,0 +1,18 @@
+#version 450
+
+// Per Vertex, Keep In Sync With OGShapeVertex
+layout(location = 0) in vec2 in_pos;
+layout(location = 1) in vec4 in_color;
+
+// Pixels To Clip Space
+layout(push_constant) uniform Push {
+	vec2 scale;
+	vec2 offset;
+} pc;
+
+layout(location = 0) out vec4 out_color;
+
+void main() {
+	gl_Position = vec4(in_pos * pc.scale + pc.offset, 0.0, 1.0);
+	out_color = in_color;
+}
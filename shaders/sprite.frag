@@ -0,0 +1,15 @@
+#version 450
+
+#include "sprite.glsl"
+
+layout(set = 0, binding = 0) uniform sampler2D tex;
+
+layout(location = 0) in vec2 in_uv;
+layout(location = 1) in vec4 in_color;
+layout(location = 2) flat in float in_sdf;
+
+layout(location = 0) out vec4 out_color;
+
+void main() {
+	out_color = shade(texture(tex, in_uv), in_color, in_sdf);
+}
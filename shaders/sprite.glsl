@@ -0,0 +1,13 @@
+// Shared By sprite.frag And sprite_bindless.frag, Which Only Differ In Where The Texel Comes From
+
+vec4 shade(vec4 texel, vec4 color, float sdf) {
+	// Glyphs Store Distance To The Edge In R, 0.5 On The Outline. Smoothing Over
+	// One Screen Pixel's Worth Of Distance Keeps Edges Crisp At Any Scale
+	if (sdf > 0.5) {
+		float dist = texel.r;
+		float width = fwidth(dist);
+		float alpha = smoothstep(0.5 - width, 0.5 + width, dist);
+		return vec4(color.rgb, color.a * alpha);
+	}
+	return texel * color;
+}
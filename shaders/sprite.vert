@@ -0,0 +1,41 @@
+#version 450
+
+// Per Instance, Keep In Sync With OGSpriteInstance
+layout(location = 0) in vec2 in_pos;
+layout(location = 1) in vec2 in_size;
+layout(location = 2) in vec4 in_uv;
+layout(location = 3) in vec4 in_color;
+layout(location = 4) in float in_rotation;
+layout(location = 5) in float in_sdf;
+layout(location = 6) in uint in_texture;
+
+// Pixels To Clip Space
+layout(push_constant) uniform Push {
+	vec2 scale;
+	vec2 offset;
+} pc;
+
+layout(location = 0) out vec2 out_uv;
+layout(location = 1) out vec4 out_color;
+layout(location = 2) flat out float out_sdf;
+layout(location = 3) flat out uint out_texture; // Only Read By sprite_bindless.frag
+
+const vec2 corners[6] = vec2[](
+	vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5),
+	vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5)
+);
+
+void main() {
+	vec2 corner = corners[gl_VertexIndex];
+	vec2 local = corner * in_size;
+
+	float s = sin(in_rotation);
+	float c = cos(in_rotation);
+	vec2 world = in_pos + vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+	gl_Position = vec4(world * pc.scale + pc.offset, 0.0, 1.0);
+	out_uv = mix(in_uv.xy, in_uv.zw, corner + 0.5);
+	out_color = in_color;
+	out_sdf = in_sdf;
+	out_texture = in_texture;
+}
@@ -0,0 +1,19 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+#include "sprite.glsl"
+
+// Every Texture, Keep The Size In Sync With OG_BINDLESS_TEXTURES
+layout(set = 0, binding = 0) uniform sampler2D textures[4096];
+
+layout(location = 0) in vec2 in_uv;
+layout(location = 1) in vec4 in_color;
+layout(location = 2) flat in float in_sdf;
+layout(location = 3) flat in uint in_texture;
+
+layout(location = 0) out vec4 out_color;
+
+// One Draw Mixes Textures, So The Index Varies Across The Draw
+void main() {
+	out_color = shade(texture(textures[nonuniformEXT(in_texture)], in_uv), in_color, in_sdf);
+}
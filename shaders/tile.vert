@@ -0,0 +1,42 @@
+#version 450
+
+// Per Instance, Keep In Sync With OG_TILE_PACK: X And Y Within The Chunk In The
+// Low Two Bytes, Tileset Cell In The High Half
+layout(location = 0) in uint in_tile;
+
+// Keep In Sync With OGTilePush
+layout(push_constant) uniform Push {
+	vec2 scale; // World Pixels To Clip Space, Camera And Zoom Included
+	vec2 offset;
+	vec2 origin; // Chunk Corner In World Pixels
+	float tile_size;
+	uint columns; // Tileset Cells Per Row
+	vec2 cell; // One Tileset Cell In UV
+	vec2 inset; // Half A Texel, Keeps Filtering From Reaching Into Neighbours
+	uint tileset; // Its Registry Slot, Only Read By sprite_bindless.frag
+} pc;
+
+layout(location = 0) out vec2 out_uv;
+layout(location = 1) out vec4 out_color;
+layout(location = 2) flat out float out_sdf;
+layout(location = 3) flat out uint out_texture;
+
+const vec2 corners[6] = vec2[](
+	vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+	vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0)
+);
+
+void main() {
+	vec2 corner = corners[gl_VertexIndex];
+	vec2 tile = vec2(in_tile & 0xFFu, (in_tile >> 8) & 0xFFu);
+	uint cell = in_tile >> 16;
+
+	vec2 world = pc.origin + (tile + corner) * pc.tile_size;
+	gl_Position = vec4(world * pc.scale + pc.offset, 0.0, 1.0);
+
+	vec2 uv0 = vec2(cell % pc.columns, cell / pc.columns) * pc.cell;
+	out_uv = mix(uv0 + pc.inset, uv0 + pc.cell - pc.inset, corner);
+	out_color = vec4(1.0);
+	out_sdf = 0.0;
+	out_texture = pc.tileset;
+}
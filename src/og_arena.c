@@ -0,0 +1,228 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_arena.h"
+
+#define OG_ALIGN_UP(val, align) \
+	(((val) + (align) - 1) & ~((uint64_t)(align) - 1))
+
+OG_INT void __init_arena(OGArena *arena, size_t size) {
+	memset(arena, 0, sizeof(OGArena));
+	arena->size = OG_ALIGN_UP(size ? size : OG_ARENA_ALIGN, OG_ARENA_ALIGN);
+	arena->base = malloc(arena->size);
+}
+
+OG_INT void* __arena_alloc(OGArena *arena, size_t size) {
+	size_t offset = OG_ALIGN_UP(arena->head, OG_ARENA_ALIGN);
+	void *ptr = NULL;
+
+	if (offset + size <= arena->size) {
+		arena->head = offset + size;
+		ptr = arena->base + offset;
+	} else {
+		// malloc Already Aligns To OG_ARENA_ALIGN
+		if (arena->spill_count == arena->spill_capacity) {
+			arena->spill_capacity = arena->spill_capacity ? arena->spill_capacity * 2 : 8;
+			arena->spills = realloc(arena->spills, arena->spill_capacity * sizeof(void*));
+		}
+		ptr = malloc(size ? size : 1);
+		arena->spills[arena->spill_count++] = ptr;
+		arena->spilled += OG_ALIGN_UP(size, OG_ARENA_ALIGN);
+	}
+
+	if (arena->head + arena->spilled > arena->peak) {
+		arena->peak = arena->head + arena->spilled;
+	}
+	return ptr;
+}
+
+// Nothing Handed Out Survives This, So The Base Can Move When It Has To Grow
+OG_INT void __reset_arena(OGArena *arena) {
+	if (arena->spill_count) {
+		for (uint32_t i = 0; i < arena->spill_count; i++) {
+			free(arena->spills[i]);
+		}
+
+		size_t size = arena->size;
+		while (size < arena->peak) {
+			size *= 2;
+		}
+		free(arena->base);
+		arena->base = malloc(size);
+		arena->size = size;
+	}
+
+	arena->head = 0;
+	arena->spill_count = 0;
+	arena->spilled = 0;
+}
+
+OG_INT void __free_arena(OGArena *arena) {
+	__reset_arena(arena);
+	free(arena->base);
+	free(arena->spills);
+	memset(arena, 0, sizeof(OGArena));
+}
+
+// Allocations Never Straddle The End Of The Ring, One That Would Starts Over At The Front
+OG_INT void* __ring_alloc(OGContext *og_ctx, VkDeviceSize size, VkDeviceSize align, VkDeviceSize *offset) {
+	OGFrameRing *ring = &og_ctx->frame_ring;
+	if (!ring->buffer.alloc.mapped) {
+		return NULL;
+	}
+
+	uint64_t start = OG_ALIGN_UP(ring->head, align);
+	if (start % ring->size + size > ring->size) {
+		start = (start / ring->size + 1) * ring->size;
+	}
+
+	if (size > ring->size || start + size - ring->tail > ring->size) {
+		if (!ring->overflowed) {
+			OG_LOG_ERR("Frame Ring Full, Raise OGConfig.frame_ring_size");
+			ring->overflowed = true;
+		}
+		return NULL;
+	}
+
+	ring->head = start + size;
+	*offset = start % ring->size;
+	return (uint8_t*)ring->buffer.alloc.mapped + *offset;
+}
+
+
+OG_INT void _create_frame_arenas(OGContext *og_ctx, size_t arena_size, VkDeviceSize ring_size) {
+	__init_arena(&og_ctx->frame_arena, arena_size);
+
+	OGFrameRing *ring = &og_ctx->frame_ring;
+	memset(ring, 0, sizeof(OGFrameRing));
+
+	// Every Alignment Divides OG_FRAME_RING_ALIGN, So Aligning A Position Aligns Its Offset Too
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(og_ctx->physical_device, &pd_props);
+	ring->uniform_align = pd_props.limits.minUniformBufferOffsetAlignment;
+	ring->data_align = pd_props.limits.minStorageBufferOffsetAlignment;
+	if (ring->data_align < OG_ARENA_ALIGN) {
+		ring->data_align = OG_ARENA_ALIGN;
+	}
+	ring->size = OG_ALIGN_UP(ring_size, OG_FRAME_RING_ALIGN);
+
+	if (!og_create_buffer(og_ctx, ring->size + OG_FRAME_UNIFORM_RANGE,
+				VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+				OG_MEMORY_CPU_TO_GPU, &ring->buffer)) {
+		OG_LOG_ERR("Frame Ring Buffer Creation Failed");
+		return;
+	}
+
+	VkDescriptorSetLayoutBinding uniform_binding = {};
+	uniform_binding.binding = 0;
+	uniform_binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	uniform_binding.descriptorCount = 1;
+	uniform_binding.stageFlags = VK_SHADER_STAGE_ALL;
+
+	VkDescriptorSetLayoutCreateInfo dsl_create_info = {};
+	dsl_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	dsl_create_info.bindingCount = 1;
+	dsl_create_info.pBindings = &uniform_binding;
+
+	OG_CHECK_VK(vkCreateDescriptorSetLayout(og_ctx->logical_device, &dsl_create_info,
+				NULL, &ring->set_layout), "Frame Ring Descriptor Set Layout Creation Failed");
+
+	VkDescriptorPoolSize pool_size = {};
+	pool_size.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	pool_size.descriptorCount = 1;
+
+	VkDescriptorPoolCreateInfo dp_create_info = {};
+	dp_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	dp_create_info.maxSets = 1;
+	dp_create_info.poolSizeCount = 1;
+	dp_create_info.pPoolSizes = &pool_size;
+
+	OG_CHECK_VK(vkCreateDescriptorPool(og_ctx->logical_device, &dp_create_info,
+				NULL, &ring->desc_pool), "Frame Ring Descriptor Pool Creation Failed");
+
+	VkDescriptorSetAllocateInfo ds_alloc_info = {};
+	ds_alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	ds_alloc_info.descriptorPool = ring->desc_pool;
+	ds_alloc_info.descriptorSetCount = 1;
+	ds_alloc_info.pSetLayouts = &ring->set_layout;
+
+	OG_CHECK_VK(vkAllocateDescriptorSets(og_ctx->logical_device, &ds_alloc_info,
+				&ring->set), "Frame Ring Descriptor Set Allocation Failed");
+
+	// Written Once, Each Draw Only Moves The Window With Its Dynamic Offset
+	VkDescriptorBufferInfo desc_buf_info = {};
+	desc_buf_info.buffer = ring->buffer.buffer;
+	desc_buf_info.offset = 0;
+	desc_buf_info.range = OG_FRAME_UNIFORM_RANGE;
+
+	VkWriteDescriptorSet desc_write = {};
+	desc_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	desc_write.dstSet = ring->set;
+	desc_write.dstBinding = 0;
+	desc_write.descriptorCount = 1;
+	desc_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	desc_write.pBufferInfo = &desc_buf_info;
+
+	vkUpdateDescriptorSets(og_ctx->logical_device, 1, &desc_write, 0, NULL);
+}
+
+// Called Once This Slot's Fence Has Signaled. Slots Retire In Order, So Everything
+// Up To Where This One Ended Is Done With
+OG_INT void _begin_frame_arenas(OGContext *og_ctx) {
+	OGFrameRing *ring = &og_ctx->frame_ring;
+
+	__reset_arena(&og_ctx->frame_arena);
+	ring->tail = ring->ends[og_ctx->frame_idx];
+}
+
+OG_INT void _end_frame_arenas(OGContext *og_ctx) {
+	OGFrameRing *ring = &og_ctx->frame_ring;
+
+	ring->ends[og_ctx->frame_idx] = ring->head;
+	ring->bytes_last_frame = ring->head - ring->submitted;
+	ring->submitted = ring->head;
+}
+
+OG_INT void _destroy_frame_arenas(OGContext *og_ctx) {
+	OGFrameRing *ring = &og_ctx->frame_ring;
+
+	vkDestroyDescriptorPool(og_ctx->logical_device, ring->desc_pool, NULL);
+	vkDestroyDescriptorSetLayout(og_ctx->logical_device, ring->set_layout, NULL);
+	og_destroy_buffer(og_ctx, &ring->buffer);
+
+	__free_arena(&og_ctx->frame_arena);
+}
+
+
+OG_API void* og_frame_alloc(OGContext *og_ctx, size_t size) {
+	return __arena_alloc(&og_ctx->frame_arena, size);
+}
+
+OG_API void* og_frame_uniform(OGContext *og_ctx, VkDeviceSize size, uint32_t *dynamic_offset) {
+	if (size > OG_FRAME_UNIFORM_RANGE) {
+		OG_LOG_ERR("Frame Uniform Larger Than OG_FRAME_UNIFORM_RANGE");
+		return NULL;
+	}
+
+	VkDeviceSize offset = 0;
+	void *ptr = __ring_alloc(og_ctx, size, og_ctx->frame_ring.uniform_align, &offset);
+	*dynamic_offset = (uint32_t)offset;
+	return ptr;
+}
+
+OG_API void* og_frame_data(OGContext *og_ctx, VkDeviceSize size, VkBuffer *buffer, VkDeviceSize *offset) {
+	*buffer = og_ctx->frame_ring.buffer.buffer;
+	*offset = 0;
+	return __ring_alloc(og_ctx, size, og_ctx->frame_ring.data_align, offset);
+}
+
+OG_API VkDescriptorSetLayout og_frame_uniform_layout(OGContext *og_ctx) {
+	return og_ctx->frame_ring.set_layout;
+}
+
+OG_API VkDescriptorSet og_frame_uniform_set(OGContext *og_ctx) {
+	return og_ctx->frame_ring.set;
+}
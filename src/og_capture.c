@@ -0,0 +1,338 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_capture.h"
+
+// Backbuffers Are Stored BGRA, Which Both Formats Expect, So Usually This Is One fwrite
+OG_INT bool __capture_pixels(OGCapture *capture, FILE *file, const uint8_t *pixels, uint32_t width, uint32_t height) {
+	size_t stride = (size_t)width * 4;
+	if (!capture->swizzle) {
+		return fwrite(pixels, stride, height, file) == height;
+	}
+
+	if (capture->row_size < stride) {
+		capture->row = realloc(capture->row, stride);
+		capture->row_size = (uint32_t)stride;
+	}
+
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t *src = pixels + y * stride;
+		for (uint32_t x = 0; x < width * 4; x += 4) {
+			capture->row[x + 0] = src[x + 2];
+			capture->row[x + 1] = src[x + 1];
+			capture->row[x + 2] = src[x + 0];
+			capture->row[x + 3] = src[x + 3];
+		}
+		if (fwrite(capture->row, stride, 1, file) != 1) {
+			return false;
+		}
+	}
+	return true;
+}
+
+OG_INT bool __capture_write(OGCapture *capture, OGCaptureSlot *slot) {
+	const uint8_t *pixels = slot->buffer.alloc.mapped;
+
+	if (capture->format == OG_CAPTURE_RAW) {
+		return __capture_pixels(capture, capture->file, pixels, slot->width, slot->height);
+	}
+
+	char name[OG_CAPTURE_MAX_PATH + 32];
+	snprintf(name, sizeof(name), "%s_%08llu.tga", capture->path, (unsigned long long)slot->frame);
+	FILE *file = fopen(name, "wb");
+	if (!file) {
+		return false;
+	}
+
+	// Uncompressed True Color, Rows Top To Bottom. Alpha Bits Are Left At 0 So
+	// Viewers Ignore Whatever The Swapchain Left In That Channel
+	uint8_t header[18] = {};
+	header[2] = 2;
+	header[12] = (uint8_t)(slot->width & 0xFF);
+	header[13] = (uint8_t)(slot->width >> 8);
+	header[14] = (uint8_t)(slot->height & 0xFF);
+	header[15] = (uint8_t)(slot->height >> 8);
+	header[16] = 32;
+	header[17] = 0x20;
+
+	bool ok = fwrite(header, sizeof(header), 1, file) == 1 &&
+		__capture_pixels(capture, file, pixels, slot->width, slot->height);
+	return fclose(file) == 0 && ok;
+}
+
+// Writes Slots In The Order They Were Filled, Without Holding The Lock While On Disk
+OG_INT void* __capture_main(void* data) {
+	OGCapture *capture = data;
+
+	pthread_mutex_lock(&capture->lock);
+	for (;;) {
+		OGCaptureSlot *slot = &capture->slots[capture->write_pos];
+		if (slot->state != OG_CAPTURE_WRITING) {
+			if (capture->quit) {
+				break;
+			}
+			pthread_cond_wait(&capture->wake, &capture->lock);
+			continue;
+		}
+		pthread_mutex_unlock(&capture->lock);
+
+		double start = __now_seconds();
+		bool ok = __capture_write(capture, slot);
+		double elapsed = __now_seconds() - start;
+
+		pthread_mutex_lock(&capture->lock);
+		slot->state = OG_CAPTURE_FREE;
+		capture->write_time += elapsed;
+		if (ok) {
+			capture->frames_written++;
+		} else {
+			capture->frames_failed++;
+		}
+		capture->write_pos = (capture->write_pos + 1) % OG_CAPTURE_SLOTS;
+	}
+	pthread_mutex_unlock(&capture->lock);
+	return NULL;
+}
+
+
+// Headless Targets Are Always Copyable, Windows Find Out When The Swapchain Is Made
+OG_INT void _init_capture(OGContext *og_ctx, bool enabled) {
+	memset(&og_ctx->capture, 0, sizeof(OGCapture));
+	og_ctx->capture.enabled = enabled;
+	og_ctx->capture.supported = og_ctx->headless;
+}
+
+// The Graph Left The Backbuffer In TRANSFER_SRC. It Is Copied Into The Next Slot And
+// Put Back In PRESENT_SRC. When That Slot Is Still Busy The Writer Is Behind, And
+// The Frame Is Dropped Rather Than Waited For
+OG_INT void _record_capture(OGContext *og_ctx) {
+	OGCapture *capture = &og_ctx->capture;
+	if (!capture->active) {
+		return;
+	}
+
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+	VkImage image = og_ctx->sc_images[og_ctx->img_idx];
+	uint32_t width = og_ctx->win->size.width;
+	uint32_t height = og_ctx->win->size.height;
+	OGCaptureSlot *slot = &capture->slots[capture->next];
+
+	pthread_mutex_lock(&capture->lock);
+	bool take = slot->state == OG_CAPTURE_FREE;
+	pthread_mutex_unlock(&capture->lock);
+
+	// A Raw File Has No Per Frame Header, So Every Frame Must Keep The First One's Size
+	if (take && capture->format == OG_CAPTURE_RAW) {
+		if (!capture->raw_width) {
+			capture->raw_width = width;
+			capture->raw_height = height;
+		}
+		take = width == capture->raw_width && height == capture->raw_height;
+	}
+
+	VkDeviceSize size = (VkDeviceSize)width * height * 4;
+	if (take && slot->buffer.size < size) {
+		og_destroy_buffer(og_ctx, &slot->buffer);
+		if (!og_create_buffer(og_ctx, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+					OG_MEMORY_GPU_TO_CPU, &slot->buffer)) {
+			OG_LOG_ERR("Capture Buffer Creation Failed");
+			take = false;
+		}
+	}
+
+	if (take) {
+		VkBufferImageCopy copy_region = {};
+		copy_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copy_region.imageSubresource.layerCount = 1;
+		copy_region.imageExtent.width = width;
+		copy_region.imageExtent.height = height;
+		copy_region.imageExtent.depth = 1;
+
+		vkCmdCopyImageToBuffer(cmd_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+				slot->buffer.buffer, 1, &copy_region);
+
+		VkMemoryBarrier host_barrier = {};
+		host_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+		vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &host_barrier, 0, NULL, 0, NULL);
+
+		slot->frame_slot = og_ctx->frame_idx;
+		slot->width = width;
+		slot->height = height;
+		slot->frame = og_ctx->frame_number;
+
+		pthread_mutex_lock(&capture->lock);
+		slot->state = OG_CAPTURE_COPYING;
+		capture->frames_captured++;
+		pthread_mutex_unlock(&capture->lock);
+		capture->next = (capture->next + 1) % OG_CAPTURE_SLOTS;
+	} else {
+		pthread_mutex_lock(&capture->lock);
+		capture->frames_dropped++;
+		pthread_mutex_unlock(&capture->lock);
+	}
+
+	// Headless Targets Stay In TRANSFER_SRC, Which Is Where The Next Frame Expects Them
+	if (og_ctx->headless) {
+		return;
+	}
+
+	VkImageMemoryBarrier present_barrier = {};
+	present_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	present_barrier.srcAccessMask = 0;
+	present_barrier.dstAccessMask = 0;
+	present_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	present_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	present_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	present_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	present_barrier.image = image;
+	present_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	present_barrier.subresourceRange.levelCount = 1;
+	present_barrier.subresourceRange.layerCount = 1;
+
+	vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			0, 0, NULL, 0, NULL, 1, &present_barrier);
+}
+
+// Runs Right After This Slot's Fence Wait, So Copies It Recorded Have Landed
+OG_INT void _retire_captures(OGContext *og_ctx) {
+	OGCapture *capture = &og_ctx->capture;
+	if (!capture->active) {
+		return;
+	}
+
+	bool handed = false;
+	pthread_mutex_lock(&capture->lock);
+	for (uint32_t i = 0; i < OG_CAPTURE_SLOTS; i++) {
+		OGCaptureSlot *slot = &capture->slots[i];
+		if (slot->state == OG_CAPTURE_COPYING && slot->frame_slot == og_ctx->frame_idx) {
+			slot->state = OG_CAPTURE_WRITING;
+			handed = true;
+		}
+	}
+	if (handed) {
+		pthread_cond_signal(&capture->wake);
+	}
+	pthread_mutex_unlock(&capture->lock);
+}
+
+OG_INT void _destroy_capture(OGContext *og_ctx) {
+	og_capture_end(og_ctx);
+}
+
+
+OG_API bool og_capture_begin(OGContext *og_ctx, const char* path, OGCaptureFormat format) {
+	OGCapture *capture = &og_ctx->capture;
+
+	if (capture->active) {
+		OG_LOG_ERR("A Capture Is Already Running");
+		return false;
+	}
+	if (!capture->supported) {
+		OG_LOG_ERR("Capture Needs OGConfig.capture And A Surface That Allows Copies");
+		return false;
+	}
+	if (strlen(path) >= OG_CAPTURE_MAX_PATH) {
+		OG_LOG_ERR("Capture Path Too Long");
+		return false;
+	}
+
+	switch (og_ctx->surf_format.format) {
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+			capture->swizzle = false;
+			break;
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+			capture->swizzle = true;
+			break;
+		default:
+			OG_LOG_ERR("Capture Only Supports 8 Bit RGBA And BGRA Backbuffers");
+			return false;
+	}
+
+	capture->file = NULL;
+	if (format == OG_CAPTURE_RAW) {
+		capture->file = fopen(path, "wb");
+		if (!capture->file) {
+			OG_LOG_ERR("Capture File Could Not Be Opened");
+			return false;
+		}
+	}
+
+	strcpy(capture->path, path);
+	capture->format = format;
+	capture->raw_width = 0;
+	capture->raw_height = 0;
+	capture->next = 0;
+	capture->write_pos = 0;
+	capture->quit = false;
+	capture->frames_captured = 0;
+	capture->frames_written = 0;
+	capture->frames_dropped = 0;
+	capture->frames_failed = 0;
+	capture->write_time = 0.0;
+
+	pthread_mutex_init(&capture->lock, NULL);
+	pthread_cond_init(&capture->wake, NULL);
+
+	if (pthread_create(&capture->thread, NULL, __capture_main, capture)) {
+		OG_LOG_ERR("Capture Thread Creation Failed");
+		pthread_mutex_destroy(&capture->lock);
+		pthread_cond_destroy(&capture->wake);
+		if (capture->file) {
+			fclose(capture->file);
+			capture->file = NULL;
+		}
+		return false;
+	}
+
+	// The Graph Leaves The Backbuffer Copyable From The Next Frame On
+	capture->active = true;
+	return true;
+}
+
+OG_API void og_capture_end(OGContext *og_ctx) {
+	OGCapture *capture = &og_ctx->capture;
+	if (!capture->active) {
+		return;
+	}
+
+	// Whatever Is Still Copying Lands Once The Frames In Flight Are Done
+	_wait_frames(og_ctx);
+
+	pthread_mutex_lock(&capture->lock);
+	for (uint32_t i = 0; i < OG_CAPTURE_SLOTS; i++) {
+		if (capture->slots[i].state == OG_CAPTURE_COPYING) {
+			capture->slots[i].state = OG_CAPTURE_WRITING;
+		}
+	}
+	capture->quit = true;
+	pthread_cond_broadcast(&capture->wake);
+	pthread_mutex_unlock(&capture->lock);
+	pthread_join(capture->thread, NULL);
+
+	if (capture->file) {
+		if (fclose(capture->file)) {
+			OG_LOG_ERR("Capture File Could Not Be Written");
+		}
+		capture->file = NULL;
+	}
+
+	for (uint32_t i = 0; i < OG_CAPTURE_SLOTS; i++) {
+		og_destroy_buffer(og_ctx, &capture->slots[i].buffer);
+		capture->slots[i].state = OG_CAPTURE_FREE;
+	}
+
+	free(capture->row);
+	capture->row = NULL;
+	capture->row_size = 0;
+	pthread_mutex_destroy(&capture->lock);
+	pthread_cond_destroy(&capture->wake);
+	capture->active = false;
+}
@@ -0,0 +1,188 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_damage.h"
+
+// Once Full The Rects Stop Mattering, And Past OG_MAX_DAMAGE_RECTS They Collapse Into One
+OG_INT void __damage_add(OGDamageList *list, VkRect2D rect) {
+	if (list->full || !rect.extent.width || !rect.extent.height) {
+		return;
+	}
+
+	if (list->count == OG_MAX_DAMAGE_RECTS) {
+		list->rects[0] = __damage_bounds(list);
+		list->count = 1;
+	}
+	list->rects[list->count++] = rect;
+}
+
+OG_INT void __damage_merge(OGDamageList *dst, const OGDamageList *src) {
+	if (src->full) {
+		dst->full = true;
+		dst->count = 0;
+		return;
+	}
+	for (uint32_t i = 0; i < src->count; i++) {
+		__damage_add(dst, src->rects[i]);
+	}
+}
+
+OG_INT VkRect2D __damage_bounds(const OGDamageList *list) {
+	VkRect2D bounds = {};
+	if (!list->count) {
+		return bounds;
+	}
+
+	int32_t x0 = list->rects[0].offset.x;
+	int32_t y0 = list->rects[0].offset.y;
+	int32_t x1 = x0 + (int32_t)list->rects[0].extent.width;
+	int32_t y1 = y0 + (int32_t)list->rects[0].extent.height;
+
+	for (uint32_t i = 1; i < list->count; i++) {
+		const VkRect2D *r = &list->rects[i];
+		x0 = r->offset.x < x0 ? r->offset.x : x0;
+		y0 = r->offset.y < y0 ? r->offset.y : y0;
+		x1 = r->offset.x + (int32_t)r->extent.width > x1 ? r->offset.x + (int32_t)r->extent.width : x1;
+		y1 = r->offset.y + (int32_t)r->extent.height > y1 ? r->offset.y + (int32_t)r->extent.height : y1;
+	}
+
+	bounds.offset.x = x0;
+	bounds.offset.y = y0;
+	bounds.extent.width = (uint32_t)(x1 - x0);
+	bounds.extent.height = (uint32_t)(y1 - y0);
+	return bounds;
+}
+
+
+OG_INT void _init_damage(OGContext *og_ctx, bool on_demand) {
+	memset(&og_ctx->damage, 0, sizeof(OGDamage));
+	og_ctx->damage.enabled = on_demand;
+	_reset_damage(og_ctx);
+}
+
+// New Or Resized Targets Hold Nothing Yet, So Everything Is Drawn Again
+OG_INT void _reset_damage(OGContext *og_ctx) {
+	OGDamage *damage = &og_ctx->damage;
+
+	damage->pending.full = true;
+	for (uint32_t i = 0; i < OG_DAMAGE_MAX_IMAGES; i++) {
+		damage->images[i].full = true;
+	}
+}
+
+// Nothing To Draw And Nothing On Its Way That Could Change That
+OG_INT bool _damage_idle(OGContext *og_ctx) {
+	OGDamage *damage = &og_ctx->damage;
+
+	return damage->enabled && !damage->pending.full && !damage->pending.count &&
+		!og_ctx->particles.active && og_ctx->upload.completed == og_ctx->upload.last_value &&
+		!og_ctx->stream.pending && !og_ctx->text.pending_count;
+}
+
+// Called Before Anything Is Waited On Or Acquired, So A Skipped Frame Costs Nothing
+OG_INT bool _damage_frame_needed(OGContext *og_ctx) {
+	OGDamage *damage = &og_ctx->damage;
+	if (!damage->enabled) {
+		return true;
+	}
+
+	// Landed Uploads Can Change What Is Drawn, And Live Particles Move Every Frame.
+	// Glyphs Rasterized Last Frame Only Reach The Atlas In The Next One, So Text
+	// Drawn With Them Was Blank And Needs That Frame. Where It Was Isn't Kept
+	if (og_ctx->upload.completed != damage->upload_seen) {
+		damage->upload_seen = og_ctx->upload.completed;
+		damage->pending.full = true;
+	}
+	if (og_ctx->particles.active || og_ctx->text.pending_count) {
+		damage->pending.full = true;
+	}
+
+	if (!damage->pending.full && !damage->pending.count) {
+		damage->frames_skipped++;
+		return false;
+	}
+	return true;
+}
+
+// Once The Image Is Known, Redraws What Changed Since It Was Last Drawn. Partial
+// Frames Need The Scene To Be The Only Pass Touching The Backbuffer, And A Window
+OG_INT void _prepare_damage(OGContext *og_ctx) {
+	OGDamage *damage = &og_ctx->damage;
+
+	damage->partial = false;
+	damage->area.offset.x = 0;
+	damage->area.offset.y = 0;
+	damage->area.extent = og_ctx->win->size;
+
+	if (!damage->enabled) {
+		return;
+	}
+
+	uint32_t image_count = og_ctx->sc_img_count < OG_DAMAGE_MAX_IMAGES ? og_ctx->sc_img_count : OG_DAMAGE_MAX_IMAGES;
+	for (uint32_t i = 0; i < image_count; i++) {
+		__damage_merge(&damage->images[i], &damage->pending);
+	}
+
+	if (og_ctx->img_idx < OG_DAMAGE_MAX_IMAGES) {
+		OGDamageList *image = &og_ctx->damage.images[og_ctx->img_idx];
+		if (!image->full && image->count && og_ctx->graph.partial_ok && !og_ctx->headless) {
+			damage->partial = true;
+			damage->area = __damage_bounds(image);
+			damage->frames_partial++;
+		}
+		memset(image, 0, sizeof(OGDamageList));
+	}
+
+	damage->presented = damage->pending;
+	memset(&damage->pending, 0, sizeof(OGDamageList));
+}
+
+// Only This Frame's Own Changes, The Presentation Engine Already Has The Frame Before
+OG_INT bool _present_regions(OGContext *og_ctx, VkPresentRegionsKHR *regions, VkPresentRegionKHR *region,
+		VkRectLayerKHR *rects) {
+	OGDamage *damage = &og_ctx->damage;
+	if (!damage->enabled || !damage->incremental || damage->presented.full || !damage->presented.count) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < damage->presented.count; i++) {
+		rects[i].offset = damage->presented.rects[i].offset;
+		rects[i].extent = damage->presented.rects[i].extent;
+		rects[i].layer = 0;
+	}
+
+	region->rectangleCount = damage->presented.count;
+	region->pRectangles = rects;
+
+	regions->sType = VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR;
+	regions->swapchainCount = 1;
+	regions->pRegions = region;
+	return true;
+}
+
+
+OG_API void og_invalidate(OGContext *og_ctx) {
+	og_ctx->damage.pending.full = true;
+	og_ctx->damage.pending.count = 0;
+}
+
+OG_API void og_invalidate_rect(OGContext *og_ctx, int32_t x, int32_t y, uint32_t width, uint32_t height) {
+	int64_t x0 = x < 0 ? 0 : x;
+	int64_t y0 = y < 0 ? 0 : y;
+	int64_t x1 = (int64_t)x + width;
+	int64_t y1 = (int64_t)y + height;
+	x1 = x1 > og_ctx->win->size.width ? og_ctx->win->size.width : x1;
+	y1 = y1 > og_ctx->win->size.height ? og_ctx->win->size.height : y1;
+	if (x1 <= x0 || y1 <= y0) {
+		return;
+	}
+
+	VkRect2D rect = {};
+	rect.offset.x = (int32_t)x0;
+	rect.offset.y = (int32_t)y0;
+	rect.extent.width = (uint32_t)(x1 - x0);
+	rect.extent.height = (uint32_t)(y1 - y0);
+	__damage_add(&og_ctx->damage.pending, rect);
+}
@@ -0,0 +1,297 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_entity.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define OG_ENTITY_SIMD
+#endif
+
+OG_INT OGEntityGroup* __entity_group(OGEntityStore *store, OGTexture *texture, uint32_t layer) {
+	for (uint32_t i = 0; i < store->group_count; i++) {
+		if (store->groups[i].texture == texture && store->groups[i].layer == layer) {
+			return &store->groups[i];
+		}
+	}
+
+	if (store->group_count == store->group_capacity) {
+		store->group_capacity = store->group_capacity ? store->group_capacity * 2 : 8;
+		store->groups = realloc(store->groups, store->group_capacity * sizeof(OGEntityGroup));
+	}
+
+	OGEntityGroup *group = &store->groups[store->group_count++];
+	memset(group, 0, sizeof(OGEntityGroup));
+	group->texture = texture;
+	group->layer = layer;
+	return group;
+}
+
+// Appends Default Components, Returns The New Index
+OG_INT uint32_t __entity_push(OGEntityGroup *group, uint32_t slot) {
+	if (group->count == group->capacity) {
+		group->capacity = group->capacity ? group->capacity * 2 : 64;
+		group->x = realloc(group->x, group->capacity * sizeof(float));
+		group->y = realloc(group->y, group->capacity * sizeof(float));
+		group->rotation = realloc(group->rotation, group->capacity * sizeof(float));
+		group->scale_x = realloc(group->scale_x, group->capacity * sizeof(float));
+		group->scale_y = realloc(group->scale_y, group->capacity * sizeof(float));
+		group->color = realloc(group->color, group->capacity * sizeof(uint32_t));
+		group->slots = realloc(group->slots, group->capacity * sizeof(uint32_t));
+	}
+
+	uint32_t index = group->count++;
+	group->x[index] = 0.0f;
+	group->y[index] = 0.0f;
+	group->rotation[index] = 0.0f;
+	group->scale_x[index] = 1.0f;
+	group->scale_y[index] = 1.0f;
+	group->color[index] = 0xFFFFFFFFu;
+	group->slots[index] = slot;
+	return index;
+}
+
+// Swap Remove, The Group's Last Entity Moves Into The Hole
+OG_INT void __entity_pop(OGEntityStore *store, OGEntityGroup *group, uint32_t index) {
+	uint32_t last = --group->count;
+	if (index == last) {
+		return;
+	}
+
+	group->x[index] = group->x[last];
+	group->y[index] = group->y[last];
+	group->rotation[index] = group->rotation[last];
+	group->scale_x[index] = group->scale_x[last];
+	group->scale_y[index] = group->scale_y[last];
+	group->color[index] = group->color[last];
+	group->slots[index] = group->slots[last];
+	store->slots[group->slots[index]].index = index;
+}
+
+// NULL For Stale Or Destroyed Handles
+OG_INT OGEntitySlot* __entity_slot(const OGEntityStore *store, OGEntity entity) {
+	uint32_t idx = entity & OG_ENTITY_INDEX_MASK;
+	if (idx >= store->slot_count) {
+		return NULL;
+	}
+
+	OGEntitySlot *slot = &store->slots[idx];
+	if (slot->group == OG_ENTITY_NONE || (slot->generation & 0xFF) != entity >> OG_ENTITY_INDEX_BITS) {
+		return NULL;
+	}
+	return slot;
+}
+
+// Straight From The Component Arrays Into Sprite Instances, Four At A Time With
+// SSE2: The Screen Space Position And Size Of Four Entities Are Computed As Columns,
+// Transposed Into Rows And Stored As Each Instance's pos And size In One Go
+OG_INT void __transform_entities(const OGEntityGroup *group, OGSpriteInstance *dst,
+		float view_x, float view_y, float zoom) {
+	uint32_t i = 0;
+
+#if defined(OG_ENTITY_SIMD)
+	const __m128 vx = _mm_set1_ps(view_x);
+	const __m128 vy = _mm_set1_ps(view_y);
+	const __m128 scale = _mm_set1_ps(zoom);
+	const __m128 uv = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+
+	for (; i + 4 <= group->count; i += 4) {
+		__m128 pos_x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(group->x + i), vx), scale);
+		__m128 pos_y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(group->y + i), vy), scale);
+		__m128 size_x = _mm_mul_ps(_mm_loadu_ps(group->scale_x + i), scale);
+		__m128 size_y = _mm_mul_ps(_mm_loadu_ps(group->scale_y + i), scale);
+		_MM_TRANSPOSE4_PS(pos_x, pos_y, size_x, size_y);
+
+		// pos And size Are The First Four Floats Of An Instance
+		OGSpriteInstance *out = dst + i;
+		_mm_storeu_ps((float*)&out[0], pos_x);
+		_mm_storeu_ps((float*)&out[1], pos_y);
+		_mm_storeu_ps((float*)&out[2], size_x);
+		_mm_storeu_ps((float*)&out[3], size_y);
+
+		for (uint32_t k = 0; k < 4; k++) {
+			_mm_storeu_ps(out[k].uv, uv);
+			out[k].color = group->color[i + k];
+			out[k].rotation = group->rotation[i + k];
+			out[k].sdf = 0.0f;
+		}
+	}
+#endif
+
+	for (; i < group->count; i++) {
+		OGSpriteInstance *out = &dst[i];
+		out->pos[0] = (group->x[i] - view_x) * zoom;
+		out->pos[1] = (group->y[i] - view_y) * zoom;
+		out->size[0] = group->scale_x[i] * zoom;
+		out->size[1] = group->scale_y[i] * zoom;
+		out->uv[0] = 0.0f;
+		out->uv[1] = 0.0f;
+		out->uv[2] = 1.0f;
+		out->uv[3] = 1.0f;
+		out->color = group->color[i];
+		out->rotation = group->rotation[i];
+		out->sdf = 0.0f;
+	}
+}
+
+
+OG_API OGEntityStore* og_create_entity_store(uint32_t capacity) {
+	OGEntityStore *store = calloc(1, sizeof(OGEntityStore));
+	store->slot_capacity = capacity ? capacity : 1024;
+	store->slots = malloc(store->slot_capacity * sizeof(OGEntitySlot));
+	store->free_head = OG_ENTITY_NONE;
+	return store;
+}
+
+OG_API void og_destroy_entity_store(OGEntityStore *store) {
+	for (uint32_t i = 0; i < store->group_count; i++) {
+		OGEntityGroup *group = &store->groups[i];
+		free(group->x);
+		free(group->y);
+		free(group->rotation);
+		free(group->scale_x);
+		free(group->scale_y);
+		free(group->color);
+		free(group->slots);
+	}
+
+	free(store->groups);
+	free(store->slots);
+	free(store);
+}
+
+OG_API OGEntity og_entity_create(OGEntityStore *store, OGTexture *texture, uint32_t layer) {
+	uint32_t idx = store->free_head;
+
+	if (idx != OG_ENTITY_NONE) {
+		store->free_head = store->slots[idx].index;
+	} else {
+		if (store->slot_count == OG_ENTITY_INDEX_MASK) {
+			OG_LOG_ERR("Entity Store Full");
+			return OG_ENTITY_NONE;
+		}
+		if (store->slot_count == store->slot_capacity) {
+			store->slot_capacity *= 2;
+			store->slots = realloc(store->slots, store->slot_capacity * sizeof(OGEntitySlot));
+		}
+		idx = store->slot_count++;
+		store->slots[idx].generation = 0;
+	}
+
+	OGEntityGroup *group = __entity_group(store, texture, layer);
+	OGEntitySlot *slot = &store->slots[idx];
+	slot->group = (uint32_t)(group - store->groups);
+	slot->index = __entity_push(group, idx);
+	store->live++;
+
+	return (slot->generation & 0xFF) << OG_ENTITY_INDEX_BITS | idx;
+}
+
+OG_API void og_entity_destroy(OGEntityStore *store, OGEntity entity) {
+	OGEntitySlot *slot = __entity_slot(store, entity);
+	if (!slot) {
+		return;
+	}
+
+	__entity_pop(store, &store->groups[slot->group], slot->index);
+
+	// A New Generation Turns Handles Still Held Elsewhere Stale
+	slot->group = OG_ENTITY_NONE;
+	slot->generation++;
+	slot->index = store->free_head;
+	store->free_head = entity & OG_ENTITY_INDEX_MASK;
+	store->live--;
+}
+
+OG_API bool og_entity_alive(const OGEntityStore *store, OGEntity entity) {
+	return __entity_slot(store, entity) != NULL;
+}
+
+OG_API OGEntityGroup* og_entity_get(OGEntityStore *store, OGEntity entity, uint32_t *index) {
+	OGEntitySlot *slot = __entity_slot(store, entity);
+	if (!slot) {
+		return NULL;
+	}
+
+	*index = slot->index;
+	return &store->groups[slot->group];
+}
+
+OG_API void og_entity_set_transform(OGEntityStore *store, OGEntity entity, float x, float y,
+		float rotation, float scale_x, float scale_y) {
+	uint32_t index = 0;
+	OGEntityGroup *group = og_entity_get(store, entity, &index);
+	if (!group) {
+		return;
+	}
+
+	group->x[index] = x;
+	group->y[index] = y;
+	group->rotation[index] = rotation;
+	group->scale_x[index] = scale_x;
+	group->scale_y[index] = scale_y;
+}
+
+OG_API void og_entity_set_color(OGEntityStore *store, OGEntity entity, VkClearColorValue color) {
+	uint32_t index = 0;
+	OGEntityGroup *group = og_entity_get(store, entity, &index);
+	if (group) {
+		group->color[index] = __pack_color(color);
+	}
+}
+
+// Moves The Entity Into The Group For Its New Texture And Layer, Keeping Its Handle
+OG_API void og_entity_set_texture(OGEntityStore *store, OGEntity entity, OGTexture *texture, uint32_t layer) {
+	OGEntitySlot *slot = __entity_slot(store, entity);
+	if (!slot) {
+		return;
+	}
+
+	OGEntityGroup *from = &store->groups[slot->group];
+	if (from->texture == texture && from->layer == layer) {
+		return;
+	}
+
+	// May Grow The Group Array, So Only Indices Survive This
+	uint32_t from_idx = slot->group;
+	OGEntityGroup *to = __entity_group(store, texture, layer);
+	uint32_t to_idx = (uint32_t)(to - store->groups);
+	from = &store->groups[from_idx];
+
+	uint32_t src = slot->index;
+	uint32_t dst = __entity_push(to, entity & OG_ENTITY_INDEX_MASK);
+	to->x[dst] = from->x[src];
+	to->y[dst] = from->y[src];
+	to->rotation[dst] = from->rotation[src];
+	to->scale_x[dst] = from->scale_x[src];
+	to->scale_y[dst] = from->scale_y[src];
+	to->color[dst] = from->color[src];
+
+	__entity_pop(store, from, src);
+	slot->group = to_idx;
+	slot->index = dst;
+}
+
+OG_API void og_draw_entities(OGContext *og_ctx, const OGEntityStore *store, float view_x, float view_y, float zoom) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+
+	for (uint32_t g = 0; g < store->group_count; g++) {
+		const OGEntityGroup *group = &store->groups[g];
+		if (!group->count) {
+			continue;
+		}
+
+		OGTexture *texture = group->texture ? group->texture : batch->white;
+		if (texture->upload > og_ctx->upload.completed) {
+			texture = batch->white;
+		}
+
+		OGSpriteInstance *dst = _reserve_sprites(og_ctx, texture, group->layer, group->count);
+		if (!dst) {
+			return;
+		}
+		__transform_entities(group, dst, view_x, view_y, zoom);
+	}
+}
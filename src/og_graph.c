@@ -0,0 +1,769 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_graph.h"
+#include "origami/common.h"
+
+#define OG_WRITE_ACCESS (VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)
+
+OG_INT bool __access_writes(OGGraphAccess access) {
+	return access == OG_ACCESS_COLOR_WRITE || access == OG_ACCESS_TRANSFER_DST || access == OG_ACCESS_STORAGE_WRITE;
+}
+
+OG_INT VkPipelineStageFlags __access_stage(OGGraphAccess access) {
+	switch (access) {
+		case OG_ACCESS_COLOR_WRITE: return VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		case OG_ACCESS_SAMPLED: return VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		case OG_ACCESS_TRANSFER_SRC: return VK_PIPELINE_STAGE_TRANSFER_BIT;
+		case OG_ACCESS_TRANSFER_DST: return VK_PIPELINE_STAGE_TRANSFER_BIT;
+		case OG_ACCESS_VERTEX: return VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+		case OG_ACCESS_INDIRECT: return VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+		case OG_ACCESS_STORAGE_READ: return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		case OG_ACCESS_STORAGE_WRITE: return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+	}
+	return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+}
+
+OG_INT VkAccessFlags __access_flags(OGGraphAccess access) {
+	switch (access) {
+		case OG_ACCESS_COLOR_WRITE: return VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		case OG_ACCESS_SAMPLED: return VK_ACCESS_SHADER_READ_BIT;
+		case OG_ACCESS_TRANSFER_SRC: return VK_ACCESS_TRANSFER_READ_BIT;
+		case OG_ACCESS_TRANSFER_DST: return VK_ACCESS_TRANSFER_WRITE_BIT;
+		case OG_ACCESS_VERTEX: return VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+		case OG_ACCESS_INDIRECT: return VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		case OG_ACCESS_STORAGE_READ: return VK_ACCESS_SHADER_READ_BIT;
+		case OG_ACCESS_STORAGE_WRITE: return VK_ACCESS_SHADER_WRITE_BIT;
+	}
+	return 0;
+}
+
+// Buffers Have No Layout, They Stay UNDEFINED
+OG_INT VkImageLayout __access_layout(OGGraphAccess access) {
+	switch (access) {
+		case OG_ACCESS_COLOR_WRITE: return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		case OG_ACCESS_SAMPLED: return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		case OG_ACCESS_TRANSFER_SRC: return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		case OG_ACCESS_TRANSFER_DST: return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		case OG_ACCESS_STORAGE_READ: return VK_IMAGE_LAYOUT_GENERAL;
+		case OG_ACCESS_STORAGE_WRITE: return VK_IMAGE_LAYOUT_GENERAL;
+		default: return VK_IMAGE_LAYOUT_UNDEFINED;
+	}
+}
+
+OG_INT VkImageUsageFlags __access_usage(OGGraphAccess access) {
+	switch (access) {
+		case OG_ACCESS_COLOR_WRITE: return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+		case OG_ACCESS_SAMPLED: return VK_IMAGE_USAGE_SAMPLED_BIT;
+		case OG_ACCESS_TRANSFER_SRC: return VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+		case OG_ACCESS_TRANSFER_DST: return VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+		case OG_ACCESS_STORAGE_READ: return VK_IMAGE_USAGE_STORAGE_BIT;
+		case OG_ACCESS_STORAGE_WRITE: return VK_IMAGE_USAGE_STORAGE_BIT;
+		default: return 0;
+	}
+}
+
+OG_INT bool __lifetimes_overlap(OGRenderGraph *graph, OGGraphResourceNode *res, uint32_t alias) {
+	for (uint32_t i = 1; i < graph->resource_count; i++) {
+		OGGraphResourceNode *other = &graph->resources[i];
+		if (other == res || other->alias != alias) {
+			continue;
+		}
+		if (res->first_use <= other->last_use && other->first_use <= res->last_use) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Works Out What Has To Happen Before res Can Be Used As access, Folds It Into
+// The Pass's Barrier And Moves res Into Its New State. True When image_barrier Was Filled
+OG_INT bool __sync_use(OGRenderGraph *graph, OGGraphResourceNode *res, OGGraphAccess access,
+		VkImageMemoryBarrier *image_barrier, VkMemoryBarrier *mem_barrier,
+		VkPipelineStageFlags *src_stages, VkPipelineStageFlags *dst_stages) {
+	VkPipelineStageFlags stage = __access_stage(access);
+	VkAccessFlags flags = __access_flags(access);
+	bool writes = __access_writes(access);
+
+	OGGraphAlias *alias = NULL;
+	VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+	bool transition = false;
+
+	if (res->type == OG_GRAPH_IMAGE) {
+		layout = __access_layout(access);
+		transition = res->layout != layout;
+
+		if (res != &graph->resources[OG_GRAPH_BACKBUFFER]) {
+			alias = &graph->aliases[res->alias];
+
+			// First Use This Frame, The Memory Is Taken Over From Whoever Had It Last
+			if (res->layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+				res->write_stage = alias->stages;
+				res->write_access = alias->writes;
+				res->read_stages = 0;
+				alias->stages = 0;
+				alias->writes = 0;
+			}
+		}
+	}
+
+	// Writes And Layout Changes Wait On Everything Before Them, Reads Only On The
+	// Last Write And Only Once Per Stage
+	VkPipelineStageFlags src = 0;
+	VkAccessFlags src_access = 0;
+	if (writes || transition) {
+		src = res->write_stage | res->read_stages;
+		src_access = res->write_access;
+	} else if (res->write_stage && !(res->read_stages & stage)) {
+		src = res->write_stage;
+		src_access = res->write_access;
+	}
+
+	if (transition) {
+		image_barrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_barrier->srcAccessMask = src_access;
+		image_barrier->dstAccessMask = flags;
+		image_barrier->oldLayout = res->layout;
+		image_barrier->newLayout = layout;
+		image_barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		image_barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		image_barrier->image = res->image;
+		image_barrier->subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		image_barrier->subresourceRange.levelCount = 1;
+		image_barrier->subresourceRange.layerCount = 1;
+	} else if (src) {
+		mem_barrier->srcAccessMask |= src_access;
+		mem_barrier->dstAccessMask |= flags;
+	}
+
+	if (transition || src) {
+		*src_stages |= src ? src : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		*dst_stages |= stage;
+	}
+
+	if (writes || transition) {
+		res->write_stage = stage;
+		res->write_access = writes ? flags & OG_WRITE_ACCESS : 0;
+		res->read_stages = writes ? 0 : stage;
+	} else {
+		res->read_stages |= stage;
+	}
+	res->layout = layout;
+
+	if (alias) {
+		alias->stages |= stage;
+		alias->writes |= flags & OG_WRITE_ACCESS;
+	}
+	return transition;
+}
+
+OG_INT OGGraphUse* __add_use(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access) {
+	OGRenderGraph *graph = &og_ctx->graph;
+
+	if (!graph->building || pass >= graph->pass_count || resource >= graph->resource_count) {
+		OG_LOG_ERR("Render Graph Use Outside og_graph_begin/og_graph_end");
+		return NULL;
+	}
+
+	OGGraphPassNode *node = &graph->passes[pass];
+	if (node->use_count == OG_GRAPH_MAX_USES) {
+		OG_LOG_ERR("Render Graph Pass Has Too Many Uses");
+		return NULL;
+	}
+
+	OGGraphUse *use = &node->uses[node->use_count++];
+	memset(use, 0, sizeof(OGGraphUse));
+	use->resource = resource;
+	use->access = access;
+	return use;
+}
+
+
+// Until Something Else Is Declared The Graph Is Just The Scene, Cleared White
+OG_INT void _create_graph(OGContext *og_ctx) {
+	memset(&og_ctx->graph, 0, sizeof(OGRenderGraph));
+
+	VkClearColorValue white = {{1, 1, 1, 1}};
+	og_graph_begin(og_ctx);
+	og_graph_scene(og_ctx, OG_GRAPH_BACKBUFFER, &white);
+	og_graph_end(og_ctx);
+}
+
+OG_INT void _destroy_graph(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	_invalidate_graph(og_ctx);
+
+	for (uint32_t i = 0; i < graph->pass_count; i++) {
+		if (graph->passes[i].render_pass) {
+			vkDestroyRenderPass(og_ctx->logical_device, graph->passes[i].render_pass, NULL);
+			graph->passes[i].render_pass = VK_NULL_HANDLE;
+		}
+	}
+	graph->compiled = false;
+}
+
+// Culls Passes Nothing Kept Depends On, Then Derives Every Attachment's Load And
+// Store Op From Who Uses It Before And After And Builds The Render Passes
+OG_INT void _compile_graph(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+
+	// The Backbuffer And Imported Buffers Are Seen Outside The Graph, Everything Else
+	// Only Matters If A Live Pass Reads It
+	for (uint32_t i = 0; i < graph->resource_count; i++) {
+		OGGraphResourceNode *res = &graph->resources[i];
+		res->live = i == OG_GRAPH_BACKBUFFER || res->type == OG_GRAPH_BUFFER;
+		res->first_use = UINT32_MAX;
+		res->last_use = 0;
+		res->usage = 0;
+	}
+
+	graph->culled_passes = 0;
+	for (uint32_t p = graph->pass_count; p-- > 0;) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		pass->graphics = false;
+		pass->live = p == graph->scene;
+
+		for (uint32_t u = 0; u < pass->use_count; u++) {
+			OGGraphUse *use = &pass->uses[u];
+			pass->graphics |= use->access == OG_ACCESS_COLOR_WRITE;
+			if (__access_writes(use->access) && graph->resources[use->resource].live) {
+				pass->live = true;
+			}
+		}
+
+		if (!pass->live) {
+			graph->culled_passes++;
+			continue;
+		}
+
+		// Walking Backwards, Whatever A Live Pass Touches Keeps Its Producers Alive
+		for (uint32_t u = 0; u < pass->use_count; u++) {
+			graph->resources[pass->uses[u].resource].live = true;
+		}
+	}
+
+	for (uint32_t p = 0; p < graph->pass_count; p++) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		if (!pass->live) {
+			continue;
+		}
+
+		for (uint32_t u = 0; u < pass->use_count; u++) {
+			OGGraphResourceNode *res = &graph->resources[pass->uses[u].resource];
+			if (res->first_use == UINT32_MAX) {
+				res->first_use = p;
+			}
+			res->last_use = p;
+			res->usage |= __access_usage(pass->uses[u].access);
+		}
+	}
+
+	OGGraphResourceNode *backbuffer = &graph->resources[OG_GRAPH_BACKBUFFER];
+	graph->partial_ok = backbuffer->first_use == graph->scene && backbuffer->last_use == graph->scene;
+
+	for (uint32_t p = 0; p < graph->pass_count; p++) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		if (!pass->live || !pass->graphics) {
+			continue;
+		}
+
+		VkAttachmentDescription attachments[OG_GRAPH_MAX_COLOR] = {};
+		VkAttachmentReference color_refs[OG_GRAPH_MAX_COLOR] = {};
+		pass->color_count = 0;
+
+		for (uint32_t u = 0; u < pass->use_count; u++) {
+			OGGraphUse *use = &pass->uses[u];
+			if (use->access != OG_ACCESS_COLOR_WRITE) {
+				continue;
+			}
+			if (pass->color_count == OG_GRAPH_MAX_COLOR) {
+				OG_LOG_ERR("Render Graph Pass Has Too Many Color Attachments");
+				break;
+			}
+
+			OGGraphResourceNode *res = &graph->resources[use->resource];
+			bool earlier = res->first_use < p;
+			bool later = res->last_use > p || use->resource == OG_GRAPH_BACKBUFFER;
+
+			// Contents Are Only Loaded When An Earlier Pass Made Them And Only
+			// Stored When A Later Pass, Or The Screen, Looks At Them
+			VkAttachmentDescription *attachment = &attachments[pass->color_count];
+			attachment->format = res->desc.format ? res->desc.format : og_ctx->surf_format.format;
+			attachment->samples = VK_SAMPLE_COUNT_1_BIT;
+			attachment->loadOp = use->clear ? VK_ATTACHMENT_LOAD_OP_CLEAR :
+				earlier ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachment->storeOp = later ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			attachment->stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachment->stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+			// Layouts Are Changed By The Graph's Own Barriers, Never By The Pass
+			attachment->initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			attachment->finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+			color_refs[pass->color_count].attachment = pass->color_count;
+			color_refs[pass->color_count].layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			pass->clear_values[pass->color_count] = use->clear_value;
+			pass->color_count++;
+		}
+
+		VkSubpassDescription subpass_desc = {};
+		subpass_desc.colorAttachmentCount = pass->color_count;
+		subpass_desc.pColorAttachments = color_refs;
+
+		VkRenderPassCreateInfo rp_create_info = {};
+		rp_create_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		rp_create_info.pAttachments = attachments;
+		rp_create_info.attachmentCount = pass->color_count;
+		rp_create_info.pSubpasses = &subpass_desc;
+		rp_create_info.subpassCount = 1;
+
+		OG_CHECK_VK(vkCreateRenderPass(og_ctx->logical_device,
+					&rp_create_info, NULL, &pass->render_pass), "Render Pass Creation Failed");
+	}
+
+	graph->compiled = true;
+}
+
+// Creates The Transient Images For The Current Size. Images Whose Live Ranges
+// Don't Overlap Share One Allocation, Largest First So Small Ones Fill In Behind
+OG_INT void _realize_graph(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	VkExtent2D backbuffer = og_ctx->win->size;
+
+	uint32_t order[OG_GRAPH_MAX_RESOURCES];
+	VkMemoryRequirements reqs[OG_GRAPH_MAX_RESOURCES] = {};
+	uint32_t image_count = 0;
+
+	graph->alias_count = 0;
+	graph->transient_bytes = 0;
+	graph->unaliased_bytes = 0;
+
+	for (uint32_t i = 1; i < graph->resource_count; i++) {
+		OGGraphResourceNode *res = &graph->resources[i];
+		res->alias = UINT32_MAX;
+		if (res->type != OG_GRAPH_IMAGE || !res->live) {
+			continue;
+		}
+
+		res->format = res->desc.format ? res->desc.format : og_ctx->surf_format.format;
+		res->extent = backbuffer;
+		if (res->desc.width && res->desc.height) {
+			res->extent.width = res->desc.width;
+			res->extent.height = res->desc.height;
+		}
+
+		VkImageCreateInfo img_create_info = {};
+		img_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		img_create_info.imageType = VK_IMAGE_TYPE_2D;
+		img_create_info.format = res->format;
+		img_create_info.extent.width = res->extent.width;
+		img_create_info.extent.height = res->extent.height;
+		img_create_info.extent.depth = 1;
+		img_create_info.mipLevels = 1;
+		img_create_info.arrayLayers = 1;
+		img_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+		img_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+		img_create_info.usage = res->usage;
+		img_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		img_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+		OG_CHECK_VK(vkCreateImage(og_ctx->logical_device, &img_create_info,
+					NULL, &res->image), "Transient Image Creation Failed");
+		vkGetImageMemoryRequirements(og_ctx->logical_device, res->image, &reqs[i]);
+		graph->unaliased_bytes += reqs[i].size;
+
+		uint32_t at = image_count++;
+		while (at > 0 && reqs[order[at - 1]].size < reqs[i].size) {
+			order[at] = order[at - 1];
+			at--;
+		}
+		order[at] = i;
+	}
+
+	for (uint32_t n = 0; n < image_count; n++) {
+		OGGraphResourceNode *res = &graph->resources[order[n]];
+		VkMemoryRequirements *req = &reqs[order[n]];
+
+		uint32_t slot = UINT32_MAX;
+		for (uint32_t a = 0; a < graph->alias_count && slot == UINT32_MAX; a++) {
+			if ((graph->aliases[a].reqs.memoryTypeBits & req->memoryTypeBits) && !__lifetimes_overlap(graph, res, a)) {
+				slot = a;
+			}
+		}
+
+		if (slot == UINT32_MAX) {
+			slot = graph->alias_count++;
+			graph->aliases[slot].reqs = *req;
+		} else {
+			OGGraphAlias *alias = &graph->aliases[slot];
+			alias->reqs.memoryTypeBits &= req->memoryTypeBits;
+			if (req->size > alias->reqs.size) alias->reqs.size = req->size;
+			if (req->alignment > alias->reqs.alignment) alias->reqs.alignment = req->alignment;
+		}
+		res->alias = slot;
+	}
+
+	for (uint32_t a = 0; a < graph->alias_count; a++) {
+		OGGraphAlias *alias = &graph->aliases[a];
+		if (!_mem_alloc(og_ctx, &alias->reqs, OG_MEMORY_GPU_ONLY, OG_ALLOC_FREE_LIST, true, &alias->alloc)) {
+			OG_LOG_ERR("Transient Image Memory Allocation Failed");
+		}
+		alias->stages = 0;
+		alias->writes = 0;
+		graph->transient_bytes += alias->reqs.size;
+	}
+
+	for (uint32_t n = 0; n < image_count; n++) {
+		OGGraphResourceNode *res = &graph->resources[order[n]];
+		OGGraphAlias *alias = &graph->aliases[res->alias];
+
+		OG_CHECK_VK(vkBindImageMemory(og_ctx->logical_device, res->image,
+					alias->alloc.memory, alias->alloc.offset), "Transient Image Bind Failed");
+
+		VkImageViewCreateInfo iv_create_info = {};
+		iv_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		iv_create_info.image = res->image;
+		iv_create_info.format = res->format;
+		iv_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+		iv_create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		iv_create_info.subresourceRange.layerCount = 1;
+		iv_create_info.subresourceRange.levelCount = 1;
+
+		OG_CHECK_VK(vkCreateImageView(og_ctx->logical_device, &iv_create_info,
+					NULL, &res->view), "Image View Creation Failed");
+	}
+
+	// Passes Drawing Into The Backbuffer Need A Framebuffer For Each Of Its Images
+	for (uint32_t p = 0; p < graph->pass_count; p++) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		if (!pass->live || !pass->graphics) {
+			continue;
+		}
+
+		uint32_t colors[OG_GRAPH_MAX_COLOR] = {};
+		uint32_t color_count = 0;
+		bool backbuffer_target = false;
+
+		for (uint32_t u = 0; u < pass->use_count && color_count < OG_GRAPH_MAX_COLOR; u++) {
+			if (pass->uses[u].access == OG_ACCESS_COLOR_WRITE) {
+				colors[color_count++] = pass->uses[u].resource;
+				backbuffer_target |= pass->uses[u].resource == OG_GRAPH_BACKBUFFER;
+			}
+		}
+
+		pass->extent = colors[0] == OG_GRAPH_BACKBUFFER ? backbuffer : graph->resources[colors[0]].extent;
+		pass->framebuffer_count = backbuffer_target ? og_ctx->sc_img_count : 1;
+		pass->framebuffers = malloc(pass->framebuffer_count * sizeof(VkFramebuffer));
+
+		for (uint32_t f = 0; f < pass->framebuffer_count; f++) {
+			VkImageView views[OG_GRAPH_MAX_COLOR];
+			for (uint32_t c = 0; c < color_count; c++) {
+				views[c] = colors[c] == OG_GRAPH_BACKBUFFER ? og_ctx->sc_img_views[f] : graph->resources[colors[c]].view;
+			}
+
+			VkFramebufferCreateInfo fb_create_info = {};
+			fb_create_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+			fb_create_info.width = pass->extent.width;
+			fb_create_info.height = pass->extent.height;
+			fb_create_info.renderPass = pass->render_pass;
+			fb_create_info.layers = 1;
+			fb_create_info.attachmentCount = color_count;
+			fb_create_info.pAttachments = views;
+
+			OG_CHECK_VK(vkCreateFramebuffer(og_ctx->logical_device, &fb_create_info,
+						NULL, &pass->framebuffers[f]), "Framebuffer Creation Failed");
+		}
+	}
+
+	graph->realized = true;
+}
+
+// Callers Make Sure No Frame In Flight Still Uses The Images
+OG_INT void _invalidate_graph(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (!graph->realized) {
+		return;
+	}
+
+	for (uint32_t p = 0; p < graph->pass_count; p++) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		for (uint32_t f = 0; f < pass->framebuffer_count; f++) {
+			vkDestroyFramebuffer(og_ctx->logical_device, pass->framebuffers[f], NULL);
+		}
+		free(pass->framebuffers);
+		pass->framebuffers = NULL;
+		pass->framebuffer_count = 0;
+	}
+
+	for (uint32_t i = 1; i < graph->resource_count; i++) {
+		OGGraphResourceNode *res = &graph->resources[i];
+		if (res->image) {
+			vkDestroyImageView(og_ctx->logical_device, res->view, NULL);
+			vkDestroyImage(og_ctx->logical_device, res->image, NULL);
+			res->view = VK_NULL_HANDLE;
+			res->image = VK_NULL_HANDLE;
+		}
+	}
+
+	for (uint32_t a = 0; a < graph->alias_count; a++) {
+		_mem_free(og_ctx, &graph->aliases[a].alloc);
+	}
+	graph->alias_count = 0;
+	graph->realized = false;
+}
+
+// Records Every Live Pass In Order, Each Behind One Merged Barrier, And Leaves The
+// Backbuffer Ready To Present (Or Read Back When Headless)
+OG_INT void _execute_graph(OGContext *og_ctx, void(*render)()) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+
+	if (!graph->realized) {
+		_realize_graph(og_ctx);
+	}
+
+	// Contents Never Carry Over Between Frames, Only The Memory Hazards Do. Partial
+	// Frames Are The Exception, They Keep What The Image Held Outside The Damage
+	OGGraphResourceNode *backbuffer = &graph->resources[OG_GRAPH_BACKBUFFER];
+	backbuffer->image = og_ctx->sc_images[og_ctx->img_idx];
+	backbuffer->layout = og_ctx->damage.partial ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_UNDEFINED;
+	backbuffer->write_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+	backbuffer->write_access = 0;
+	backbuffer->read_stages = 0;
+
+	for (uint32_t i = 1; i < graph->resource_count; i++) {
+		graph->resources[i].layout = VK_IMAGE_LAYOUT_UNDEFINED;
+	}
+
+	for (uint32_t p = 0; p < graph->pass_count; p++) {
+		OGGraphPassNode *pass = &graph->passes[p];
+		if (!pass->live) {
+			continue;
+		}
+
+		OG_PROFILE_GPU_BEGIN(og_ctx, pass->name);
+
+		VkImageMemoryBarrier image_barriers[OG_GRAPH_MAX_USES] = {};
+		uint32_t image_barrier_count = 0;
+		VkMemoryBarrier mem_barrier = {};
+		mem_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		VkPipelineStageFlags src_stages = 0;
+		VkPipelineStageFlags dst_stages = 0;
+
+		for (uint32_t u = 0; u < pass->use_count; u++) {
+			OGGraphUse *use = &pass->uses[u];
+			if (__sync_use(graph, &graph->resources[use->resource], use->access,
+						&image_barriers[image_barrier_count], &mem_barrier, &src_stages, &dst_stages)) {
+				image_barrier_count++;
+			}
+		}
+
+		if (src_stages) {
+			bool global = mem_barrier.srcAccessMask || mem_barrier.dstAccessMask;
+			vkCmdPipelineBarrier(cmd_buffer, src_stages, dst_stages, 0,
+					global ? 1 : 0, &mem_barrier, 0, NULL, image_barrier_count, image_barriers);
+		}
+
+		if (pass->graphics) {
+			VkFramebuffer framebuffer = pass->framebuffers[pass->framebuffer_count > 1 ? og_ctx->img_idx : 0];
+
+			VkRenderPassBeginInfo rp_begin_info = {};
+			rp_begin_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			rp_begin_info.renderPass = pass->render_pass;
+			rp_begin_info.renderArea.extent = pass->extent;
+
+			// Load And Store Ops Only Reach Inside The Render Area, The Rest Is Left Alone
+			if (p == graph->scene && og_ctx->damage.partial) {
+				rp_begin_info.renderArea = og_ctx->damage.area;
+			}
+			rp_begin_info.framebuffer = framebuffer;
+			rp_begin_info.pClearValues = pass->clear_values;
+			rp_begin_info.clearValueCount = pass->color_count;
+
+			// With Workers The Scene Is Recorded Into Secondaries
+			VkSubpassContents contents = p == graph->scene && og_ctx->jobs.worker_count ?
+				VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+
+			og_ctx->curr_render_pass = pass->render_pass;
+			og_ctx->curr_framebuffer = framebuffer;
+			og_ctx->curr_extent = pass->extent;
+			og_ctx->curr_scissor = rp_begin_info.renderArea;
+			vkCmdBeginRenderPass(cmd_buffer, &rp_begin_info, contents);
+		}
+
+		if (p == graph->scene) {
+			_record_scene(og_ctx, render);
+		} else if (pass->fn) {
+			pass->fn(og_ctx, cmd_buffer, pass->data);
+		}
+
+		if (pass->graphics) {
+			vkCmdEndRenderPass(cmd_buffer);
+		}
+
+		OG_PROFILE_GPU_END(og_ctx);
+	}
+
+	// A Captured Frame Is Copied Out First, And The Capture Puts It In PRESENT_SRC After
+	bool copy_out = og_ctx->headless || og_ctx->capture.active;
+
+	VkImageMemoryBarrier final_barrier = {};
+	final_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	final_barrier.srcAccessMask = backbuffer->write_access;
+	final_barrier.dstAccessMask = copy_out ? VK_ACCESS_TRANSFER_READ_BIT : 0;
+	final_barrier.oldLayout = backbuffer->layout;
+	final_barrier.newLayout = copy_out ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	final_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	final_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	final_barrier.image = backbuffer->image;
+	final_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	final_barrier.subresourceRange.levelCount = 1;
+	final_barrier.subresourceRange.layerCount = 1;
+
+	VkPipelineStageFlags src_stages = backbuffer->write_stage | backbuffer->read_stages;
+	vkCmdPipelineBarrier(cmd_buffer, src_stages,
+			copy_out ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			0, 0, NULL, 0, NULL, 1, &final_barrier);
+}
+
+
+// Starts A New Graph, Waiting First For Frames Still Using The Current One.
+// Resources And Passes Are Declared In Order, Passes Run In The Order Declared
+OG_API void og_graph_begin(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+
+	if (graph->compiled) {
+		_wait_frames(og_ctx);
+		_destroy_graph(og_ctx);
+	}
+
+	graph->resource_count = 1;
+	graph->pass_count = 0;
+	graph->scene = UINT32_MAX;
+	graph->building = true;
+
+	OGGraphResourceNode *backbuffer = &graph->resources[OG_GRAPH_BACKBUFFER];
+	memset(backbuffer, 0, sizeof(OGGraphResourceNode));
+	backbuffer->name = "Backbuffer";
+	backbuffer->type = OG_GRAPH_IMAGE;
+	backbuffer->desc.format = og_ctx->surf_format.format;
+}
+
+// A Transient Image The Graph Owns, Recreated With The Backbuffer Unless It Has A Fixed Size
+OG_API OGGraphResource og_graph_image(OGContext *og_ctx, const char* name, const OGGraphImageDesc *desc) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (!graph->building || graph->resource_count == OG_GRAPH_MAX_RESOURCES) {
+		OG_LOG_ERR("Render Graph Image Could Not Be Declared");
+		return OG_GRAPH_BACKBUFFER;
+	}
+
+	OGGraphResourceNode *res = &graph->resources[graph->resource_count];
+	memset(res, 0, sizeof(OGGraphResourceNode));
+	res->name = name;
+	res->type = OG_GRAPH_IMAGE;
+	if (desc) {
+		res->desc = *desc;
+	}
+	return graph->resource_count++;
+}
+
+// Buffers Stay Owned By The Caller, The Graph Only Orders Access To Them
+OG_API OGGraphResource og_graph_buffer(OGContext *og_ctx, const char* name, OGBuffer *buffer) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (!graph->building || graph->resource_count == OG_GRAPH_MAX_RESOURCES) {
+		OG_LOG_ERR("Render Graph Buffer Could Not Be Declared");
+		return OG_GRAPH_BACKBUFFER;
+	}
+
+	OGGraphResourceNode *res = &graph->resources[graph->resource_count];
+	memset(res, 0, sizeof(OGGraphResourceNode));
+	res->name = name;
+	res->type = OG_GRAPH_BUFFER;
+	res->buffer = buffer;
+	return graph->resource_count++;
+}
+
+// fn Runs With The Frame's Command Buffer, Inside A Render Pass When The Pass
+// Writes Color. It Must Not Record Barriers, The Graph Already Has
+OG_API OGGraphPass og_graph_pass(OGContext *og_ctx, const char* name, OGGraphPassFn fn, void* data) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (!graph->building || graph->pass_count == OG_GRAPH_MAX_PASSES) {
+		OG_LOG_ERR("Render Graph Pass Could Not Be Declared");
+		return 0;
+	}
+
+	OGGraphPassNode *pass = &graph->passes[graph->pass_count];
+	memset(pass, 0, sizeof(OGGraphPassNode));
+	pass->name = name;
+	pass->fn = fn;
+	pass->data = data;
+	return graph->pass_count++;
+}
+
+// Where og_render's Callback And The Sprite Batch Draw. Pipelines Are Built For
+// The Backbuffer Format, So A Different Target Has To Keep That Format
+OG_API OGGraphPass og_graph_scene(OGContext *og_ctx, OGGraphResource target, const VkClearColorValue *clear) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (graph->scene != UINT32_MAX) {
+		OG_LOG_ERR("Render Graph Already Has A Scene Pass");
+		return graph->scene;
+	}
+
+	VkFormat format = graph->resources[target].desc.format;
+	if (format && format != og_ctx->surf_format.format) {
+		OG_LOG_ERR("Render Graph Scene Target Must Use The Backbuffer Format");
+	}
+
+	graph->scene = og_graph_pass(og_ctx, "Scene", NULL, NULL);
+	og_graph_write_color(og_ctx, graph->scene, target, clear);
+	return graph->scene;
+}
+
+// A NULL clear Keeps What Earlier Passes Drew, Or Leaves It Undefined If None Did
+OG_API void og_graph_write_color(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, const VkClearColorValue *clear) {
+	OGGraphUse *use = __add_use(og_ctx, pass, resource, OG_ACCESS_COLOR_WRITE);
+	if (use && clear) {
+		use->clear = true;
+		use->clear_value.color = *clear;
+	}
+}
+
+OG_API void og_graph_read(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access) {
+	if (__access_writes(access)) {
+		OG_LOG_ERR("Render Graph Read Declared With A Write Access");
+	}
+	__add_use(og_ctx, pass, resource, access);
+}
+
+OG_API void og_graph_write(OGContext *og_ctx, OGGraphPass pass, OGGraphResource resource, OGGraphAccess access) {
+	if (!__access_writes(access)) {
+		OG_LOG_ERR("Render Graph Write Declared With A Read Access");
+	}
+	__add_use(og_ctx, pass, resource, access);
+}
+
+// Without A Scene Pass One Is Added Last, Drawing Over The Backbuffer
+OG_API void og_graph_end(OGContext *og_ctx) {
+	OGRenderGraph *graph = &og_ctx->graph;
+	if (graph->scene == UINT32_MAX) {
+		og_graph_scene(og_ctx, OG_GRAPH_BACKBUFFER, NULL);
+	}
+
+	graph->building = false;
+	_compile_graph(og_ctx);
+}
+
+// For Creating Pipelines, Valid Until The Next og_graph_begin
+OG_API VkRenderPass og_graph_render_pass(OGContext *og_ctx, OGGraphPass pass) {
+	return og_ctx->graph.passes[pass].render_pass;
+}
+
+// Changes Whenever The Targets Are Rebuilt, Fetch It While Recording
+OG_API VkImageView og_graph_image_view(OGContext *og_ctx, OGGraphResource resource) {
+	if (resource == OG_GRAPH_BACKBUFFER) {
+		return og_ctx->sc_img_views[og_ctx->img_idx];
+	}
+	return og_ctx->graph.resources[resource].view;
+}
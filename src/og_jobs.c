@@ -0,0 +1,346 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+#include "origami/og_jobs.h"
+#include "origami/common.h"
+
+#include <sched.h>
+#include <unistd.h>
+
+// 0 For The Thread That Called og_init (And Any Other Outside Thread)
+static _Thread_local uint32_t thread_idx = 0;
+
+OG_INT uint32_t __thread_index() {
+	return thread_idx;
+}
+
+// Newest Own Job First While It Is Still Warm In Cache, Otherwise The Oldest
+// Job Of The Next Thread Along That Has Any
+OG_INT bool __take_job(OGJobSystem *jobs, uint32_t self, OGJob *out) {
+	uint32_t queue_count = jobs->worker_count + 1;
+
+	for (uint32_t i = 0; i < queue_count; i++) {
+		OGJobQueue *queue = &jobs->queues[(self + i) % queue_count];
+		bool taken = false;
+
+		pthread_mutex_lock(&queue->lock);
+		if (queue->bottom != queue->top) {
+			if (i == 0) {
+				*out = queue->jobs[--queue->bottom & (OG_JOB_QUEUE_SIZE - 1)];
+			} else {
+				*out = queue->jobs[queue->top++ & (OG_JOB_QUEUE_SIZE - 1)];
+			}
+			atomic_fetch_sub(&jobs->queued, 1);
+			taken = true;
+		}
+		pthread_mutex_unlock(&queue->lock);
+
+		if (taken) {
+			return true;
+		}
+	}
+	return false;
+}
+
+OG_INT void __run_job(OGJob *job) {
+	job->fn(job->data);
+	if (job->counter) {
+		atomic_fetch_sub(&job->counter->pending, 1);
+	}
+}
+
+OG_INT void* __worker_main(void* arg) {
+	OGJobQueue *queue = arg;
+	OGJobSystem *jobs = queue->system;
+	thread_idx = queue->index;
+
+	OGJob job = {};
+	while (!atomic_load(&jobs->quit)) {
+		if (__take_job(jobs, queue->index, &job)) {
+			__run_job(&job);
+			continue;
+		}
+
+		// Submitters Signal Under The Same Lock, So A Push Can't Slip In Unseen
+		pthread_mutex_lock(&jobs->sleep_lock);
+		while (!atomic_load(&jobs->queued) && !atomic_load(&jobs->quit)) {
+			pthread_cond_wait(&jobs->wake, &jobs->sleep_lock);
+		}
+		pthread_mutex_unlock(&jobs->sleep_lock);
+	}
+	return NULL;
+}
+
+// From The Calling Thread's Pool For This Frame Slot, Allocated On First Use And Reused After
+OG_INT VkCommandBuffer __begin_secondary(OGContext *og_ctx) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+	OGThreadCommands *cmds = &jobs->commands[og_ctx->frame_idx * (jobs->worker_count + 1) + __thread_index()];
+
+	if (cmds->used == cmds->capacity) {
+		uint32_t capacity = cmds->capacity ? cmds->capacity * 2 : 8;
+		cmds->buffers = realloc(cmds->buffers, capacity * sizeof(VkCommandBuffer));
+
+		VkCommandBufferAllocateInfo cmd_alloc_info = {};
+		cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		cmd_alloc_info.commandBufferCount = capacity - cmds->capacity;
+		cmd_alloc_info.commandPool = cmds->pool;
+		cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+		OG_CHECK_VK(vkAllocateCommandBuffers(og_ctx->logical_device, &cmd_alloc_info,
+					cmds->buffers + cmds->capacity), "Secondary Command Buffer Allocation Failed");
+		cmds->capacity = capacity;
+	}
+
+	VkCommandBuffer cmd_buffer = cmds->buffers[cmds->used++];
+
+	VkCommandBufferInheritanceInfo inheritance_info = {};
+	inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	inheritance_info.renderPass = og_ctx->curr_render_pass;
+	inheritance_info.subpass = 0;
+	inheritance_info.framebuffer = og_ctx->curr_framebuffer;
+
+	VkCommandBufferBeginInfo cb_begin_info = {};
+	cb_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cb_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+	cb_begin_info.pInheritanceInfo = &inheritance_info;
+
+	OG_CHECK_VK(vkBeginCommandBuffer(cmd_buffer, &cb_begin_info), "Secondary Command Buffer Begin Failed");
+	return cmd_buffer;
+}
+
+OG_INT void __push_secondary(OGJobSystem *jobs, VkCommandBuffer cmd_buffer) {
+	if (jobs->secondary_count == jobs->secondary_capacity) {
+		jobs->secondary_capacity = jobs->secondary_capacity ? jobs->secondary_capacity * 2 : 16;
+		jobs->secondaries = realloc(jobs->secondaries, jobs->secondary_capacity * sizeof(VkCommandBuffer));
+	}
+	jobs->secondaries[jobs->secondary_count++] = cmd_buffer;
+}
+
+OG_INT void __record_job(void* data) {
+	OGRecordJob *job = data;
+
+	VkCommandBuffer cmd_buffer = __begin_secondary(job->ctx);
+	job->record(job->ctx, cmd_buffer, job->chunk, job->data);
+	OG_CHECK_VK(vkEndCommandBuffer(cmd_buffer), "Secondary Command Buffer End Failed");
+
+	*job->out = cmd_buffer;
+}
+
+
+OG_INT void _create_job_system(OGContext *og_ctx, uint32_t worker_count) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+
+	if (worker_count == OG_JOBS_AUTO) {
+		long cores = sysconf(_SC_NPROCESSORS_ONLN);
+		worker_count = cores > 1 ? (uint32_t)cores - 1 : 0;
+	}
+	if (worker_count > OG_MAX_WORKERS) {
+		worker_count = OG_MAX_WORKERS;
+	}
+
+	jobs->worker_count = worker_count;
+	jobs->secondaries = NULL;
+	jobs->secondary_count = 0;
+	jobs->secondary_capacity = 0;
+	atomic_init(&jobs->queued, 0);
+	atomic_init(&jobs->quit, false);
+	pthread_mutex_init(&jobs->sleep_lock, NULL);
+	pthread_cond_init(&jobs->wake, NULL);
+
+	uint32_t thread_count = worker_count + 1;
+	jobs->queues = calloc(thread_count, sizeof(OGJobQueue));
+	for (uint32_t i = 0; i < thread_count; i++) {
+		pthread_mutex_init(&jobs->queues[i].lock, NULL);
+		jobs->queues[i].index = i;
+		jobs->queues[i].system = jobs;
+	}
+
+	// Pools Are Externally Synchronized, So Every Thread Gets Its Own Per Frame Slot
+	jobs->commands = NULL;
+	if (worker_count) {
+		jobs->commands = calloc(og_ctx->frame_count * thread_count, sizeof(OGThreadCommands));
+
+		VkCommandPoolCreateInfo pool_create_info = {};
+		pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		pool_create_info.queueFamilyIndex = og_ctx->graphics_idx;
+
+		for (uint32_t i = 0; i < og_ctx->frame_count * thread_count; i++) {
+			OG_CHECK_VK(vkCreateCommandPool(og_ctx->logical_device, &pool_create_info, NULL,
+						&jobs->commands[i].pool), "Command Pool Creation Failed");
+		}
+	}
+
+	for (uint32_t i = 0; i < worker_count; i++) {
+		if (pthread_create(&jobs->threads[i], NULL, __worker_main, &jobs->queues[i + 1])) {
+			OG_LOG_ERR("Worker Thread Creation Failed");
+		}
+	}
+}
+
+OG_INT void _destroy_job_system(OGContext *og_ctx) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+
+	pthread_mutex_lock(&jobs->sleep_lock);
+	atomic_store(&jobs->quit, true);
+	pthread_cond_broadcast(&jobs->wake);
+	pthread_mutex_unlock(&jobs->sleep_lock);
+
+	for (uint32_t i = 0; i < jobs->worker_count; i++) {
+		pthread_join(jobs->threads[i], NULL);
+	}
+
+	uint32_t thread_count = jobs->worker_count + 1;
+	if (jobs->commands) {
+		for (uint32_t i = 0; i < og_ctx->frame_count * thread_count; i++) {
+			vkDestroyCommandPool(og_ctx->logical_device, jobs->commands[i].pool, NULL);
+			free(jobs->commands[i].buffers);
+		}
+		free(jobs->commands);
+	}
+
+	for (uint32_t i = 0; i < thread_count; i++) {
+		pthread_mutex_destroy(&jobs->queues[i].lock);
+	}
+	free(jobs->queues);
+	free(jobs->secondaries);
+
+	pthread_cond_destroy(&jobs->wake);
+	pthread_mutex_destroy(&jobs->sleep_lock);
+}
+
+// The Slot's Fence Has Signaled, So Everything Its Threads Recorded Can Be Reset
+OG_INT void _jobs_frame_begin(OGContext *og_ctx) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+	jobs->secondary_count = 0;
+
+	if (!jobs->worker_count) {
+		return;
+	}
+
+	uint32_t thread_count = jobs->worker_count + 1;
+	for (uint32_t i = 0; i < thread_count; i++) {
+		OGThreadCommands *cmds = &jobs->commands[og_ctx->frame_idx * thread_count + i];
+		if (cmds->used) {
+			OG_CHECK_VK(vkResetCommandPool(og_ctx->logical_device, cmds->pool, 0), "Command Pool Reset Failed");
+			cmds->used = 0;
+		}
+	}
+}
+
+// With Workers The Pass Only Takes Secondaries, So What The Render Callback Records
+// Directly Goes Into One Too, Split Wherever og_record_parallel Is Called
+OG_INT void _jobs_pass_begin(OGContext *og_ctx) {
+	if (og_ctx->jobs.worker_count) {
+		og_ctx->curr_cmd_buffer = __begin_secondary(og_ctx);
+	}
+}
+
+OG_INT void _jobs_pass_end(OGContext *og_ctx, VkCommandBuffer primary) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+	if (!jobs->worker_count) {
+		return;
+	}
+
+	OG_CHECK_VK(vkEndCommandBuffer(og_ctx->curr_cmd_buffer), "Secondary Command Buffer End Failed");
+	__push_secondary(jobs, og_ctx->curr_cmd_buffer);
+
+	vkCmdExecuteCommands(primary, jobs->secondary_count, jobs->secondaries);
+	og_ctx->curr_cmd_buffer = primary;
+}
+
+
+// Runs On Whichever Thread Gets To It First, Including The One Waiting On counter
+OG_API void og_job_submit(OGContext *og_ctx, void (*fn)(void*), void* data, OGJobCounter *counter) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+	OGJob job = { fn, data, counter };
+
+	if (counter) {
+		atomic_fetch_add(&counter->pending, 1);
+	}
+
+	OGJobQueue *queue = &jobs->queues[__thread_index()];
+	bool pushed = false;
+
+	if (jobs->worker_count) {
+		pthread_mutex_lock(&queue->lock);
+		if (queue->bottom - queue->top < OG_JOB_QUEUE_SIZE) {
+			queue->jobs[queue->bottom++ & (OG_JOB_QUEUE_SIZE - 1)] = job;
+			atomic_fetch_add(&jobs->queued, 1);
+			pushed = true;
+		}
+		pthread_mutex_unlock(&queue->lock);
+	}
+
+	if (!pushed) {
+		__run_job(&job);
+		return;
+	}
+
+	pthread_mutex_lock(&jobs->sleep_lock);
+	pthread_cond_signal(&jobs->wake);
+	pthread_mutex_unlock(&jobs->sleep_lock);
+}
+
+// Helps With Outstanding Jobs Instead Of Sleeping, So Waiting Inside A Job Can't Deadlock
+OG_API void og_job_wait(OGContext *og_ctx, OGJobCounter *counter) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+	OGJob job = {};
+
+	while (atomic_load(&counter->pending)) {
+		if (__take_job(jobs, __thread_index(), &job)) {
+			__run_job(&job);
+		} else {
+			sched_yield();
+		}
+	}
+}
+
+// Workers Plus The Calling Thread, Useful For Sizing Chunks
+OG_API uint32_t og_job_thread_count(OGContext *og_ctx) {
+	return og_ctx->jobs.worker_count + 1;
+}
+
+// Only Valid Inside The render Callback. Chunks Are Recorded In Parallel And
+// Executed In Chunk Order, After Everything The Callback Recorded Before The Call
+OG_API void og_record_parallel(OGContext *og_ctx, uint32_t chunk_count, OGRecordFn record, void* data) {
+	OGJobSystem *jobs = &og_ctx->jobs;
+
+	if (!jobs->worker_count) {
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			record(og_ctx, og_ctx->curr_cmd_buffer, i, data);
+		}
+		return;
+	}
+
+	OG_CHECK_VK(vkEndCommandBuffer(og_ctx->curr_cmd_buffer), "Secondary Command Buffer End Failed");
+	__push_secondary(jobs, og_ctx->curr_cmd_buffer);
+
+	// Slots Are Reserved Up Front So Jobs Write Into Them Without Any Locking
+	while (jobs->secondary_count + chunk_count > jobs->secondary_capacity) {
+		jobs->secondary_capacity = jobs->secondary_capacity ? jobs->secondary_capacity * 2 : 16;
+		jobs->secondaries = realloc(jobs->secondaries, jobs->secondary_capacity * sizeof(VkCommandBuffer));
+	}
+	uint32_t base = jobs->secondary_count;
+	jobs->secondary_count += chunk_count;
+
+	OGRecordJob *record_jobs = malloc(chunk_count * sizeof(OGRecordJob));
+	OGJobCounter counter = {};
+	atomic_init(&counter.pending, 0);
+
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		record_jobs[i].ctx = og_ctx;
+		record_jobs[i].record = record;
+		record_jobs[i].data = data;
+		record_jobs[i].chunk = i;
+		record_jobs[i].out = &jobs->secondaries[base + i];
+		og_job_submit(og_ctx, __record_job, &record_jobs[i], &counter);
+	}
+	og_job_wait(og_ctx, &counter);
+	free(record_jobs);
+
+	og_ctx->curr_cmd_buffer = __begin_secondary(og_ctx);
+}
@@ -0,0 +1,162 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+#include "origami/og_loop.h"
+
+#include <time.h>
+
+// Runs Every Update Due By now And Publishes Each Snapshot. False Once update Asks To Stop
+OG_INT bool __loop_advance(OGContext *og_ctx, double now) {
+	OGLoop *loop = &og_ctx->loop;
+	double dt = loop->cfg.timestep;
+	double target = now - loop->start;
+	uint32_t steps = 0;
+
+	while (loop->sim_time + dt <= target) {
+		// Too Far Behind To Catch Up, Slip The Clock Rather Than Spiral
+		if (steps == loop->cfg.max_updates) {
+			double behind = target - loop->sim_time;
+			loop->dropped += behind;
+			loop->start += behind;
+			break;
+		}
+
+		uint8_t *snapshot = loop->buffers[loop->back];
+		memcpy(snapshot, loop->buffers[loop->last], loop->cfg.snapshot_size);
+
+		bool keep_going = loop->cfg.update(og_ctx, snapshot, dt, loop->cfg.user);
+		loop->sim_time += dt;
+		loop->ticks++;
+		steps++;
+
+		// The Exchange Releases The Snapshot To The Render Side And Hands Back A Free Buffer
+		loop->times[loop->back] = loop->start + loop->sim_time;
+		loop->last = loop->back;
+		loop->back = atomic_exchange(&loop->middle, loop->back | OG_LOOP_FRESH) & ~OG_LOOP_FRESH;
+
+		if (!keep_going) {
+			atomic_store(&loop->finished, true);
+			return false;
+		}
+	}
+	return true;
+}
+
+// Takes The Newest Snapshot If There Is One, The Oldest Held Goes Back For Reuse
+OG_INT bool __loop_receive(OGLoop *loop) {
+	if (!(atomic_load(&loop->middle) & OG_LOOP_FRESH)) {
+		return false;
+	}
+
+	// Only The Simulation Writes Between The Load And Here, And It Always Leaves A Fresh One
+	uint32_t fresh = atomic_exchange(&loop->middle, loop->prev) & ~OG_LOOP_FRESH;
+	loop->prev = loop->curr;
+	loop->curr = fresh;
+	loop->received++;
+	return true;
+}
+
+OG_INT void* __loop_main(void* data) {
+	OGContext *og_ctx = data;
+	OGLoop *loop = &og_ctx->loop;
+
+	while (!atomic_load(&loop->stop)) {
+		if (!__loop_advance(og_ctx, __now_seconds())) {
+			break;
+		}
+
+		// Sleeps To The Next Tick, An Absolute Deadline Keeps The Rate From Drifting
+		double wake = loop->start + loop->sim_time + loop->cfg.timestep;
+		struct timespec ts = {};
+		ts.tv_sec = (time_t)wake;
+		ts.tv_nsec = (long)((wake - (double)ts.tv_sec) * 1e9);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+	}
+	return NULL;
+}
+
+// What og_render Calls Back Into, With The Pair Picked For This Frame
+OG_INT void __loop_render(OGContext *og_ctx) {
+	OGLoop *loop = &og_ctx->loop;
+	const uint8_t *curr = loop->buffers[loop->curr];
+	const uint8_t *prev = loop->received > 1 ? loop->buffers[loop->prev] : curr;
+
+	loop->cfg.render(og_ctx, prev, curr, loop->alpha, loop->cfg.user);
+}
+
+
+OG_API void og_run(OGContext *og_ctx, const OGLoopConfig *cfg) {
+	OGLoop *loop = &og_ctx->loop;
+	memset(loop, 0, sizeof(OGLoop));
+
+	loop->cfg = *cfg;
+	if (loop->cfg.timestep <= 0.0) {
+		loop->cfg.timestep = OG_DEFAULT_TIMESTEP;
+	}
+	if (!loop->cfg.max_updates) {
+		loop->cfg.max_updates = OG_DEFAULT_MAX_UPDATES;
+	}
+
+	size_t size = loop->cfg.snapshot_size ? loop->cfg.snapshot_size : 1;
+	for (uint32_t i = 0; i < OG_LOOP_BUFFERS; i++) {
+		loop->buffers[i] = calloc(1, size);
+		if (loop->cfg.initial) {
+			memcpy(loop->buffers[i], loop->cfg.initial, loop->cfg.snapshot_size);
+		}
+	}
+
+	loop->back = 0;
+	loop->last = 0;
+	atomic_init(&loop->middle, 1);
+	loop->prev = 2;
+	loop->curr = 3;
+	atomic_init(&loop->stop, false);
+	atomic_init(&loop->finished, false);
+
+	// Started One Step In The Past, So The First Frame Already Has A Snapshot To Show
+	loop->start = __now_seconds() - loop->cfg.timestep;
+
+	loop->threaded = loop->cfg.threaded;
+	if (loop->threaded && pthread_create(&loop->thread, NULL, __loop_main, og_ctx)) {
+		OG_LOG_ERR("Simulation Thread Creation Failed, Updating Inline");
+		loop->threaded = false;
+	}
+
+	while (og_ctx->running && !atomic_load(&loop->finished)) {
+		og_poll_events(og_ctx);
+
+		double now = __now_seconds();
+		if (!loop->threaded) {
+			__loop_advance(og_ctx, now);
+		}
+		__loop_receive(loop);
+
+		// Nothing Published Yet, Only Possible While The Simulation Thread Starts Up
+		if (!loop->received) {
+			continue;
+		}
+
+		// Shown One Timestep Behind, Which Falls Between The Two Newest Snapshots. Only
+		// Their Own Stamps Are Read Here, start Belongs To The Simulation Side
+		double shown = now - loop->cfg.timestep;
+		double t0 = loop->received > 1 ? loop->times[loop->prev] : loop->times[loop->curr];
+		double t1 = loop->times[loop->curr];
+		double alpha = t1 > t0 ? (shown - t0) / (t1 - t0) : 1.0;
+		loop->alpha = (float)(alpha < 0.0 ? 0.0 : alpha > 1.0 ? 1.0 : alpha);
+
+		og_render(og_ctx, __loop_render);
+	}
+
+	if (loop->threaded) {
+		atomic_store(&loop->stop, true);
+		pthread_join(loop->thread, NULL);
+	}
+
+	for (uint32_t i = 0; i < OG_LOOP_BUFFERS; i++) {
+		free(loop->buffers[i]);
+		loop->buffers[i] = NULL;
+	}
+}
@@ -0,0 +1,405 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_memory.h"
+#include "origami/common.h"
+
+#define OG_ALIGN_UP(val, align) \
+	(((val) + (align) - 1) & ~((VkDeviceSize)(align) - 1))
+
+OG_INT uint32_t __pick_memory_type(OGAllocator *allocator, uint32_t type_bits, OGMemoryUsage usage) {
+	VkMemoryPropertyFlags required = 0;
+	VkMemoryPropertyFlags preferred = 0;
+
+	switch (usage) {
+		case OG_MEMORY_GPU_ONLY:
+			required = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			break;
+		case OG_MEMORY_CPU_TO_GPU:
+			required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			preferred = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+			break;
+		case OG_MEMORY_GPU_TO_CPU:
+			required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			preferred = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+			break;
+		case OG_MEMORY_CPU_ONLY:
+			required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			break;
+	}
+
+	// First Pass Takes The Preferred Flags Too, Second Settles For The Required Ones
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		VkMemoryPropertyFlags wanted = pass == 0 ? required | preferred : required;
+
+		for (uint32_t i = 0; i < allocator->mem_props.memoryTypeCount; i++) {
+			VkMemoryPropertyFlags flags = allocator->mem_props.memoryTypes[i].propertyFlags;
+			if ((type_bits & (1u << i)) && (flags & wanted) == wanted) {
+				return i;
+			}
+		}
+	}
+	return UINT32_MAX;
+}
+
+OG_INT OGMemBlock* __create_mem_block(OGContext *og_ctx, uint32_t type_idx, VkDeviceSize size, OGAllocStrategy strategy) {
+	OGAllocator *allocator = &og_ctx->allocator;
+
+	VkMemoryAllocateInfo mem_alloc_info = {};
+	mem_alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	mem_alloc_info.allocationSize = size;
+	mem_alloc_info.memoryTypeIndex = type_idx;
+
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	if (vkAllocateMemory(og_ctx->logical_device, &mem_alloc_info, NULL, &memory) != VK_SUCCESS) {
+		OG_LOG_ERR("Device Memory Block Allocation Failed");
+		return NULL;
+	}
+
+	OGMemBlock *block = calloc(1, sizeof(OGMemBlock));
+	block->memory = memory;
+	block->size = size;
+	block->type_idx = type_idx;
+	block->strategy = strategy;
+
+	// Host Visible Blocks Stay Mapped For Their Whole Life
+	if (allocator->mem_props.memoryTypes[type_idx].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+		OG_CHECK_VK(vkMapMemory(og_ctx->logical_device, memory, 0,
+					VK_WHOLE_SIZE, 0, &block->mapped), "Memory Block Map Failed");
+	}
+
+	if (strategy == OG_ALLOC_FREE_LIST) {
+		block->free_capacity = 16;
+		block->free_ranges = malloc(sizeof(OGMemRange) * block->free_capacity);
+		block->free_ranges[0].offset = 0;
+		block->free_ranges[0].size = size;
+		block->free_count = 1;
+	}
+
+	if (allocator->block_count == allocator->block_capacity) {
+		allocator->block_capacity = allocator->block_capacity ? allocator->block_capacity * 2 : 8;
+		allocator->blocks = realloc(allocator->blocks, sizeof(OGMemBlock*) * allocator->block_capacity);
+	}
+	allocator->blocks[allocator->block_count++] = block;
+
+	return block;
+}
+
+OG_INT void __destroy_mem_block(OGContext *og_ctx, OGMemBlock *block) {
+	OGAllocator *allocator = &og_ctx->allocator;
+
+	for (uint32_t i = 0; i < allocator->block_count; i++) {
+		if (allocator->blocks[i] == block) {
+			allocator->blocks[i] = allocator->blocks[--allocator->block_count];
+			break;
+		}
+	}
+
+	if (block->mapped) {
+		vkUnmapMemory(og_ctx->logical_device, block->memory);
+	}
+	vkFreeMemory(og_ctx->logical_device, block->memory, NULL);
+	free(block->free_ranges);
+	free(block);
+}
+
+OG_INT bool __block_alloc(OGMemBlock *block, VkDeviceSize size, VkDeviceSize align, OGAllocation *out) {
+	VkDeviceSize range_offset = 0;
+	VkDeviceSize range_size = 0;
+	VkDeviceSize offset = 0;
+
+	if (block->strategy == OG_ALLOC_LINEAR) {
+		offset = OG_ALIGN_UP(block->head, align);
+		if (offset + size > block->size) {
+			return false;
+		}
+
+		range_offset = block->head;
+		range_size = offset + size - block->head;
+		block->head = offset + size;
+	} else {
+		uint32_t i = 0;
+		for (; i < block->free_count; i++) {
+			OGMemRange *range = &block->free_ranges[i];
+			offset = OG_ALIGN_UP(range->offset, align);
+			if (offset + size <= range->offset + range->size) {
+				break;
+			}
+		}
+		if (i == block->free_count) {
+			return false;
+		}
+
+		// The Alignment Padding In Front Travels With The Allocation, So Freeing
+		// Hands Back Exactly What Was Taken And Neighbours Still Line Up
+		OGMemRange *range = &block->free_ranges[i];
+		range_offset = range->offset;
+		range_size = offset + size - range->offset;
+
+		range->offset += range_size;
+		range->size -= range_size;
+		if (range->size == 0) {
+			memmove(&block->free_ranges[i], &block->free_ranges[i + 1],
+					sizeof(OGMemRange) * (block->free_count - i - 1));
+			block->free_count--;
+		}
+	}
+
+	block->live++;
+	block->used += size;
+	block->wasted += range_size - size;
+
+	out->block = block;
+	out->memory = block->memory;
+	out->offset = offset;
+	out->size = size;
+	out->range_offset = range_offset;
+	out->range_size = range_size;
+	out->mapped = block->mapped ? (char*)block->mapped + offset : NULL;
+	return true;
+}
+
+OG_INT void __block_free(OGMemBlock *block, OGAllocation *alloc) {
+	block->live--;
+	block->used -= alloc->size;
+	block->wasted -= alloc->range_size - alloc->size;
+
+	if (block->strategy == OG_ALLOC_LINEAR) {
+		// Nothing Is Reclaimed Piecemeal, The Whole Block Rewinds Once It Drains
+		if (block->live == 0) {
+			block->head = 0;
+		}
+		return;
+	}
+
+	uint32_t i = 0;
+	while (i < block->free_count && block->free_ranges[i].offset < alloc->range_offset) {
+		i++;
+	}
+
+	VkDeviceSize start = alloc->range_offset;
+	VkDeviceSize end = alloc->range_offset + alloc->range_size;
+
+	bool merge_prev = i > 0 && block->free_ranges[i - 1].offset + block->free_ranges[i - 1].size == start;
+	bool merge_next = i < block->free_count && block->free_ranges[i].offset == end;
+
+	if (merge_prev && merge_next) {
+		block->free_ranges[i - 1].size += alloc->range_size + block->free_ranges[i].size;
+		memmove(&block->free_ranges[i], &block->free_ranges[i + 1],
+				sizeof(OGMemRange) * (block->free_count - i - 1));
+		block->free_count--;
+	} else if (merge_prev) {
+		block->free_ranges[i - 1].size += alloc->range_size;
+	} else if (merge_next) {
+		block->free_ranges[i].offset = start;
+		block->free_ranges[i].size += alloc->range_size;
+	} else {
+		if (block->free_count == block->free_capacity) {
+			block->free_capacity *= 2;
+			block->free_ranges = realloc(block->free_ranges, sizeof(OGMemRange) * block->free_capacity);
+		}
+		memmove(&block->free_ranges[i + 1], &block->free_ranges[i],
+				sizeof(OGMemRange) * (block->free_count - i));
+		block->free_ranges[i].offset = start;
+		block->free_ranges[i].size = alloc->range_size;
+		block->free_count++;
+	}
+}
+
+
+OG_INT void _create_allocator(OGContext *og_ctx) {
+	OGAllocator *allocator = &og_ctx->allocator;
+	memset(allocator, 0, sizeof(OGAllocator));
+
+	vkGetPhysicalDeviceMemoryProperties(og_ctx->physical_device, &allocator->mem_props);
+
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(og_ctx->physical_device, &pd_props);
+	allocator->granularity = pd_props.limits.bufferImageGranularity;
+
+	// Small Heaps (Integrated Parts, Software Drivers) Get Smaller Blocks
+	// So One Block Never Eats A Large Share Of The Heap
+	allocator->block_size = OG_MEMORY_BLOCK_SIZE;
+	for (uint32_t i = 0; i < allocator->mem_props.memoryHeapCount; i++) {
+		VkDeviceSize heap_share = allocator->mem_props.memoryHeaps[i].size / 8;
+		if (heap_share < allocator->block_size) {
+			allocator->block_size = heap_share;
+		}
+	}
+}
+
+OG_INT void _destroy_allocator(OGContext *og_ctx) {
+	OGAllocator *allocator = &og_ctx->allocator;
+
+	if (allocator->allocation_count) {
+		OG_LOG_ERR("Allocator Destroyed With Live Allocations");
+	}
+
+	while (allocator->block_count) {
+		__destroy_mem_block(og_ctx, allocator->blocks[0]);
+	}
+	free(allocator->blocks);
+	allocator->blocks = NULL;
+	allocator->block_capacity = 0;
+}
+
+OG_INT bool _mem_alloc(OGContext *og_ctx, const VkMemoryRequirements *reqs, OGMemoryUsage usage,
+		OGAllocStrategy strategy, bool optimal_image, OGAllocation *out) {
+	OGAllocator *allocator = &og_ctx->allocator;
+	memset(out, 0, sizeof(OGAllocation));
+
+	uint32_t type_idx = __pick_memory_type(allocator, reqs->memoryTypeBits, usage);
+	if (type_idx == UINT32_MAX) {
+		OG_LOG_ERR("No Suitable Memory Type");
+		return false;
+	}
+
+	// Optimal Images Start And End On A Granularity Page, So Buffers And Linear
+	// Images Sharing The Block Can Never Land On The Same Page As One
+	VkDeviceSize align = reqs->alignment ? reqs->alignment : 1;
+	VkDeviceSize size = reqs->size;
+	if (optimal_image && allocator->granularity > align) {
+		align = allocator->granularity;
+		size = OG_ALIGN_UP(size, allocator->granularity);
+	}
+
+	// Anything Over Half A Block Gets A Block Of Its Own
+	if (size > allocator->block_size / 2) {
+		OGMemBlock *block = __create_mem_block(og_ctx, type_idx, size, OG_ALLOC_LINEAR);
+		if (!block) {
+			return false;
+		}
+		block->dedicated = true;
+		__block_alloc(block, size, align, out);
+		allocator->allocation_count++;
+		return true;
+	}
+
+	for (uint32_t i = 0; i < allocator->block_count; i++) {
+		OGMemBlock *block = allocator->blocks[i];
+		if (block->type_idx != type_idx || block->strategy != strategy || block->dedicated) {
+			continue;
+		}
+		if (__block_alloc(block, size, align, out)) {
+			allocator->allocation_count++;
+			return true;
+		}
+	}
+
+	OGMemBlock *block = __create_mem_block(og_ctx, type_idx, allocator->block_size, strategy);
+	if (!block || !__block_alloc(block, size, align, out)) {
+		OG_LOG_ERR("Device Memory Sub-Allocation Failed");
+		return false;
+	}
+	allocator->allocation_count++;
+	return true;
+}
+
+OG_INT void _mem_free(OGContext *og_ctx, OGAllocation *alloc) {
+	if (!alloc->block) {
+		return;
+	}
+
+	OGMemBlock *block = alloc->block;
+	__block_free(block, alloc);
+	og_ctx->allocator.allocation_count--;
+
+	if (block->dedicated) {
+		__destroy_mem_block(og_ctx, block);
+	}
+	memset(alloc, 0, sizeof(OGAllocation));
+}
+
+
+OG_INT bool __create_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGAllocStrategy strategy, OGBuffer *out) {
+	VkBufferCreateInfo buf_create_info = {};
+	buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buf_create_info.size = size;
+	buf_create_info.usage = usage;
+	buf_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	memset(out, 0, sizeof(OGBuffer));
+	OG_CHECK_VK(vkCreateBuffer(og_ctx->logical_device, &buf_create_info,
+				NULL, &out->buffer), "Buffer Creation Failed");
+	out->size = size;
+
+	VkMemoryRequirements mem_reqs = {};
+	vkGetBufferMemoryRequirements(og_ctx->logical_device, out->buffer, &mem_reqs);
+
+	if (!_mem_alloc(og_ctx, &mem_reqs, mem_usage, strategy, false, &out->alloc)) {
+		vkDestroyBuffer(og_ctx->logical_device, out->buffer, NULL);
+		out->buffer = VK_NULL_HANDLE;
+		return false;
+	}
+
+	OG_CHECK_VK(vkBindBufferMemory(og_ctx->logical_device, out->buffer,
+				out->alloc.memory, out->alloc.offset), "Buffer Memory Bind Failed");
+	return true;
+}
+
+OG_API bool og_create_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out) {
+	return __create_buffer(og_ctx, size, usage, mem_usage, OG_ALLOC_FREE_LIST, out);
+}
+
+// For Short Lived Buffers Such As Staging, Carved Linearly Out Of Their Own Blocks
+OG_API bool og_create_transient_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out) {
+	return __create_buffer(og_ctx, size, usage, mem_usage, OG_ALLOC_LINEAR, out);
+}
+
+OG_API void og_destroy_buffer(OGContext *og_ctx, OGBuffer *buffer) {
+	if (buffer->buffer) {
+		vkDestroyBuffer(og_ctx->logical_device, buffer->buffer, NULL);
+	}
+	_mem_free(og_ctx, &buffer->alloc);
+	memset(buffer, 0, sizeof(OGBuffer));
+}
+
+OG_API bool og_create_image(OGContext *og_ctx, const VkImageCreateInfo *img_create_info,
+		OGMemoryUsage mem_usage, OGImage *out) {
+	memset(out, 0, sizeof(OGImage));
+	OG_CHECK_VK(vkCreateImage(og_ctx->logical_device, img_create_info,
+				NULL, &out->image), "Image Creation Failed");
+
+	VkMemoryRequirements mem_reqs = {};
+	vkGetImageMemoryRequirements(og_ctx->logical_device, out->image, &mem_reqs);
+
+	bool optimal = img_create_info->tiling == VK_IMAGE_TILING_OPTIMAL;
+	if (!_mem_alloc(og_ctx, &mem_reqs, mem_usage, OG_ALLOC_FREE_LIST, optimal, &out->alloc)) {
+		vkDestroyImage(og_ctx->logical_device, out->image, NULL);
+		out->image = VK_NULL_HANDLE;
+		return false;
+	}
+
+	OG_CHECK_VK(vkBindImageMemory(og_ctx->logical_device, out->image,
+				out->alloc.memory, out->alloc.offset), "Image Memory Bind Failed");
+	return true;
+}
+
+OG_API void og_destroy_image(OGContext *og_ctx, OGImage *image) {
+	if (image->image) {
+		vkDestroyImage(og_ctx->logical_device, image->image, NULL);
+	}
+	_mem_free(og_ctx, &image->alloc);
+	memset(image, 0, sizeof(OGImage));
+}
+
+OG_API OGMemoryStats og_memory_stats(OGContext *og_ctx) {
+	OGAllocator *allocator = &og_ctx->allocator;
+
+	OGMemoryStats stats = {};
+	stats.block_count = allocator->block_count;
+	stats.allocation_count = allocator->allocation_count;
+
+	for (uint32_t i = 0; i < allocator->block_count; i++) {
+		OGMemBlock *block = allocator->blocks[i];
+		stats.bytes_reserved += block->size;
+		stats.bytes_used += block->used;
+		stats.bytes_wasted += block->wasted;
+	}
+	return stats;
+}
@@ -0,0 +1,214 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+#include "origami/og_pack.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Checks Every Offset Once On Open, So Lookups And Loads Can Trust The Index
+OG_INT bool __validate_pack(const OGPack *pack) {
+	const OGPackHeader *header = pack->header;
+	size_t size = pack->size;
+
+	if (header->magic != OG_PACK_MAGIC || header->version != OG_PACK_VERSION || header->file_size != size) {
+		return false;
+	}
+
+	uint64_t entries_size = (uint64_t)header->entry_count * sizeof(OGPackEntry);
+	uint64_t slots_size = (uint64_t)header->slot_count * sizeof(uint32_t);
+	if (header->slot_count <= header->entry_count || (header->slot_count & (header->slot_count - 1)) ||
+			header->entries_offset < sizeof(OGPackHeader) || header->entries_offset % 8 || header->slots_offset % 4 ||
+			header->entries_offset > header->slots_offset || header->slots_offset > header->names_offset ||
+			header->names_offset >= size || pack->base[size - 1] != '\0' ||
+			entries_size > header->slots_offset - header->entries_offset ||
+			slots_size > header->names_offset - header->slots_offset) {
+		return false;
+	}
+
+	uint64_t names_size = size - header->names_offset;
+	for (uint32_t i = 0; i < header->entry_count; i++) {
+		const OGPackEntry *entry = &pack->entries[i];
+
+		if (entry->offset % OG_PACK_ALIGN || entry->offset > header->entries_offset ||
+				entry->size > header->entries_offset - entry->offset || entry->name >= names_size) {
+			return false;
+		}
+
+		if (entry->type == OG_PACK_SHADER && entry->size % 4) {
+			return false;
+		}
+
+		if (entry->type == OG_PACK_TEXTURE) {
+			if (!entry->width || !entry->height || !entry->mip_levels || entry->mip_levels > OG_UPLOAD_MAX_MIPS) {
+				return false;
+			}
+
+			uint64_t texels = 0;
+			for (uint32_t m = 0; m < entry->mip_levels; m++) {
+				uint32_t level_w = entry->width >> m ? entry->width >> m : 1;
+				uint32_t level_h = entry->height >> m ? entry->height >> m : 1;
+				VkDeviceSize level_size = __image_level_size((VkFormat)entry->format, level_w, level_h);
+				if (!level_size) {
+					return false;
+				}
+				texels += level_size;
+			}
+			if (texels != entry->size) {
+				return false;
+			}
+		}
+	}
+
+	// No More Used Slots Than Entries, With slot_count Above entry_count That
+	// Leaves An Empty Slot For Every Probe To Stop At
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < header->slot_count; i++) {
+		if (pack->slots[i] == OG_PACK_EMPTY) {
+			continue;
+		}
+		if (pack->slots[i] >= header->entry_count) {
+			return false;
+		}
+		used++;
+	}
+	return used <= header->entry_count;
+}
+
+
+// Fills texture In Place, Which Lets Streaming Swap A Placeholder For The Real Thing
+OG_INT bool _upload_pack_texture(OGContext *og_ctx, const OGPack *pack, const OGPackEntry *entry, OGTexture *texture) {
+	// Block Compressed Formats Depend On The Device
+	VkFormatProperties format_props = {};
+	vkGetPhysicalDeviceFormatProperties(og_ctx->physical_device, (VkFormat)entry->format, &format_props);
+	if (!(format_props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT)) {
+		OG_LOG_ERR("Packed Texture Format Not Supported By The Device");
+		return false;
+	}
+
+	if (!_create_texture(og_ctx, texture, entry->width, entry->height, (VkFormat)entry->format, entry->mip_levels)) {
+		return false;
+	}
+
+	// Already In Its Final Layout, The Only Copy Is From The Mapping Into Staging.
+	// Asking For The Pages Up Front Lets The Kernel Read Ahead Instead Of Faulting Each One
+	const uint8_t *data = og_pack_data(pack, entry);
+	uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+	const uint8_t *first_page = (const uint8_t*)((uintptr_t)data & ~(page - 1));
+	posix_madvise((void*)first_page, entry->size + (size_t)(data - first_page), POSIX_MADV_WILLNEED);
+	texture->upload = og_upload_image_mips(og_ctx, texture->image.image, (VkFormat)entry->format,
+			entry->width, entry->height, entry->mip_levels, data);
+
+	_create_texture_set(og_ctx, texture);
+	return true;
+}
+
+
+OG_API OGPack* og_open_pack(const char* path) {
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		OG_LOG_ERR("Pack Could Not Be Opened");
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(OGPackHeader)) {
+		OG_LOG_ERR("Pack Is Truncated");
+		close(fd);
+		return NULL;
+	}
+
+	// Pages Come In As They Are First Touched, Opening Reads Only The Index
+	void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) {
+		OG_LOG_ERR("Pack Mapping Failed");
+		return NULL;
+	}
+
+	OGPack *pack = calloc(1, sizeof(OGPack));
+	pack->base = base;
+	pack->size = (size_t)st.st_size;
+	pack->header = base;
+	pack->entries = (const OGPackEntry*)(pack->base + pack->header->entries_offset);
+	pack->slots = (const uint32_t*)(pack->base + pack->header->slots_offset);
+	pack->names = (const char*)(pack->base + pack->header->names_offset);
+
+	if (!__validate_pack(pack)) {
+		OG_LOG_ERR("Pack Is Damaged Or From Another Version");
+		og_close_pack(pack);
+		return NULL;
+	}
+	return pack;
+}
+
+OG_API void og_close_pack(OGPack *pack) {
+	munmap((void*)pack->base, pack->size);
+	free(pack);
+}
+
+OG_API const OGPackEntry* og_pack_find(const OGPack *pack, const char* name) {
+	uint64_t hash = __fnv1a(OG_FNV_OFFSET, name, strlen(name));
+	uint32_t mask = pack->header->slot_count - 1;
+
+	// Linear Probing, The Table Is At Most Half Full So Runs Stay Short.
+	// Never Visits A Slot Twice, Even If The Table Somehow Has No Empty One
+	uint32_t i = (uint32_t)hash & mask;
+	for (uint32_t probe = 0; probe < pack->header->slot_count; probe++, i = (i + 1) & mask) {
+		uint32_t idx = pack->slots[i];
+		if (idx == OG_PACK_EMPTY) {
+			return NULL;
+		}
+
+		const OGPackEntry *entry = &pack->entries[idx];
+		if (entry->hash == hash && !strcmp(pack->names + entry->name, name)) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+OG_API const void* og_pack_data(const OGPack *pack, const OGPackEntry *entry) {
+	return pack->base + entry->offset;
+}
+
+OG_API const void* og_pack_blob(const OGPack *pack, const char* name, size_t *size) {
+	const OGPackEntry *entry = og_pack_find(pack, name);
+	if (!entry) {
+		return NULL;
+	}
+
+	*size = entry->size;
+	return og_pack_data(pack, entry);
+}
+
+OG_API OGTexture* og_load_pack_texture(OGContext *og_ctx, const OGPack *pack, const char* name) {
+	const OGPackEntry *entry = og_pack_find(pack, name);
+	if (!entry || entry->type != OG_PACK_TEXTURE) {
+		OG_LOG_ERR("Pack Has No Such Texture");
+		return NULL;
+	}
+
+	OGTexture *texture = calloc(1, sizeof(OGTexture));
+	if (!_upload_pack_texture(og_ctx, pack, entry, texture)) {
+		free(texture);
+		return NULL;
+	}
+	return texture;
+}
+
+// Goes Through The Module Cache, Loading The Same Shader Twice Hands Back One Module
+OG_API VkShaderModule og_load_pack_shader(OGContext *og_ctx, const OGPack *pack, const char* name) {
+	const OGPackEntry *entry = og_pack_find(pack, name);
+	if (!entry || entry->type != OG_PACK_SHADER) {
+		OG_LOG_ERR("Pack Has No Such Shader");
+		return VK_NULL_HANDLE;
+	}
+
+	return og_get_shader_module(og_ctx, og_pack_data(pack, entry), entry->size);
+}
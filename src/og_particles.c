@@ -0,0 +1,553 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_particles.h"
+
+#include <stddef.h>
+
+// SPIR-V Generated From ./shaders By The Makefile
+static const uint32_t particle_emit_comp_spv[] =
+#include "shaders/particle_emit.comp.inc"
+;
+
+static const uint32_t particle_prep_comp_spv[] =
+#include "shaders/particle_prep.comp.inc"
+;
+
+static const uint32_t particle_sim_comp_spv[] =
+#include "shaders/particle_sim.comp.inc"
+;
+
+static const uint32_t particle_vert_spv[] =
+#include "shaders/particle.vert.inc"
+;
+
+static const uint32_t particle_frag_spv[] =
+#include "shaders/particle.frag.inc"
+;
+
+// Like __create_buffer, But Shared With The Compute Family When It Is A Separate One
+OG_INT bool __create_particle_buffer(OGContext *og_ctx, VkDeviceSize size, VkBufferUsageFlags usage,
+		OGMemoryUsage mem_usage, OGBuffer *out) {
+	OGParticleSystem *ps = &og_ctx->particles;
+
+	VkBufferCreateInfo buf_create_info = {};
+	buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buf_create_info.size = size;
+	buf_create_info.usage = usage;
+	buf_create_info.sharingMode = ps->async ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
+	buf_create_info.queueFamilyIndexCount = ps->async ? 2 : 0;
+	buf_create_info.pQueueFamilyIndices = ps->families;
+
+	memset(out, 0, sizeof(OGBuffer));
+	OG_CHECK_VK(vkCreateBuffer(og_ctx->logical_device, &buf_create_info,
+				NULL, &out->buffer), "Particle Buffer Creation Failed");
+	out->size = size;
+
+	VkMemoryRequirements mem_reqs = {};
+	vkGetBufferMemoryRequirements(og_ctx->logical_device, out->buffer, &mem_reqs);
+
+	if (!_mem_alloc(og_ctx, &mem_reqs, mem_usage, OG_ALLOC_FREE_LIST, false, &out->alloc)) {
+		vkDestroyBuffer(og_ctx->logical_device, out->buffer, NULL);
+		out->buffer = VK_NULL_HANDLE;
+		return false;
+	}
+
+	OG_CHECK_VK(vkBindBufferMemory(og_ctx->logical_device, out->buffer,
+				out->alloc.memory, out->alloc.offset), "Buffer Memory Bind Failed");
+	return true;
+}
+
+// Emit, Size The Simulation, Then Simulate And Compact Into The Other Buffer. Only
+// The Emit Dispatch Is Sized On The CPU, From What It Asked For
+OG_INT void __record_particles(OGContext *og_ctx, VkCommandBuffer cmd_buffer, float dt) {
+	OGParticleSystem *ps = &og_ctx->particles;
+
+	OGParticlePush push = {};
+	push.gravity[0] = ps->gravity[0];
+	push.gravity[1] = ps->gravity[1];
+	push.dt = dt;
+	push.drag = ps->drag;
+	push.capacity = ps->capacity;
+	push.src_idx = ps->current;
+	push.emit_base = og_ctx->frame_idx * OG_MAX_EMITS;
+	push.emit_count = ps->emit_count;
+	push.emit_total = ps->emit_total;
+	push.seed = (uint32_t)og_ctx->frame_number;
+
+	// The Last Frame's Draws And Simulation Are Done With What This One Writes. A Compute
+	// Queue Never Saw Them, The Timeline Wait Already Covers Those
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+	VkPipelineStageFlags src_stages = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+	if (!ps->async) {
+		src_stages |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+	}
+	vkCmdPipelineBarrier(cmd_buffer, src_stages, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0, 1, &barrier, 0, NULL, 0, NULL);
+
+	vkCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, ps->compute_layout,
+			0, 1, &ps->sets[ps->current], 0, NULL);
+	vkCmdPushConstants(cmd_buffer, ps->compute_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push), &push);
+
+	if (ps->emit_total) {
+		vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, ps->emit_pipeline);
+		vkCmdDispatch(cmd_buffer, (ps->emit_total + OG_PARTICLE_GROUP - 1) / OG_PARTICLE_GROUP, 1, 1);
+
+		vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				0, 1, &barrier, 0, NULL, 0, NULL);
+	}
+
+	vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, ps->prep_pipeline);
+	vkCmdDispatch(cmd_buffer, 1, 1, 1);
+
+	barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+	vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0, 1, &barrier, 0, NULL, 0, NULL);
+
+	vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, ps->sim_pipeline);
+	vkCmdDispatchIndirect(cmd_buffer, ps->counters.buffer, offsetof(OGParticleCounters, dispatch));
+
+	if (!ps->async) {
+		barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(cmd_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+				0, 1, &barrier, 0, NULL, 0, NULL);
+	}
+}
+
+
+OG_INT void _create_particle_pipelines(OGContext *og_ctx) {
+	OGParticleSystem *ps = &og_ctx->particles;
+
+	// Both Particle Buffers, The Counters And This Frame's Emitters
+	VkDescriptorSetLayoutBinding bindings[4] = {};
+	for (uint32_t i = 0; i < OG_ARR_SIZE(bindings); i++) {
+		bindings[i].binding = i;
+		bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		bindings[i].descriptorCount = 1;
+		bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_VERTEX_BIT;
+	}
+
+	VkDescriptorSetLayoutCreateInfo dsl_create_info = {};
+	dsl_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	dsl_create_info.bindingCount = OG_ARR_SIZE(bindings);
+	dsl_create_info.pBindings = bindings;
+
+	OG_CHECK_VK(vkCreateDescriptorSetLayout(og_ctx->logical_device, &dsl_create_info,
+				NULL, &ps->set_layout), "Particle Descriptor Set Layout Creation Failed");
+
+	VkPushConstantRange compute_range = {};
+	compute_range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	compute_range.size = sizeof(OGParticlePush);
+
+	VkPipelineLayoutCreateInfo pl_create_info = {};
+	pl_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pl_create_info.setLayoutCount = 1;
+	pl_create_info.pSetLayouts = &ps->set_layout;
+	pl_create_info.pushConstantRangeCount = 1;
+	pl_create_info.pPushConstantRanges = &compute_range;
+
+	OG_CHECK_VK(vkCreatePipelineLayout(og_ctx->logical_device, &pl_create_info,
+				NULL, &ps->compute_layout), "Particle Compute Layout Creation Failed");
+
+	VkPushConstantRange draw_range = {};
+	draw_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	draw_range.size = 4 * sizeof(float);
+	pl_create_info.pPushConstantRanges = &draw_range;
+
+	OG_CHECK_VK(vkCreatePipelineLayout(og_ctx->logical_device, &pl_create_info,
+				NULL, &ps->draw_layout), "Particle Draw Layout Creation Failed");
+
+	const uint32_t* compute_code[3] = { particle_emit_comp_spv, particle_prep_comp_spv, particle_sim_comp_spv };
+	size_t compute_sizes[3] = { sizeof(particle_emit_comp_spv), sizeof(particle_prep_comp_spv), sizeof(particle_sim_comp_spv) };
+	VkPipeline* compute_pipelines[3] = { &ps->emit_pipeline, &ps->prep_pipeline, &ps->sim_pipeline };
+
+	for (uint32_t i = 0; i < 3; i++) {
+		VkComputePipelineCreateInfo cp_create_info = {};
+		cp_create_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		cp_create_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		cp_create_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		cp_create_info.stage.module = og_get_shader_module(og_ctx, compute_code[i], compute_sizes[i]);
+		cp_create_info.stage.pName = "main";
+		cp_create_info.layout = ps->compute_layout;
+
+		*compute_pipelines[i] = og_get_compute_pipeline(og_ctx, &cp_create_info);
+	}
+
+	VkShaderModule vert_module = og_get_shader_module(og_ctx, particle_vert_spv, sizeof(particle_vert_spv));
+	VkShaderModule frag_module = og_get_shader_module(og_ctx, particle_frag_spv, sizeof(particle_frag_spv));
+
+	VkPipelineShaderStageCreateInfo stages[2] = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vert_module;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = frag_module;
+	stages[1].pName = "main";
+
+	// Quads Come From gl_VertexIndex And Particles From gl_InstanceIndex, No Vertex Input
+	VkPipelineVertexInputStateCreateInfo vi_state = {};
+	vi_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+
+	VkPipelineInputAssemblyStateCreateInfo ia_state = {};
+	ia_state.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+	VkPipelineViewportStateCreateInfo vp_state = {};
+	vp_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	vp_state.viewportCount = 1;
+	vp_state.scissorCount = 1;
+
+	VkPipelineRasterizationStateCreateInfo rs_state = {};
+	rs_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rs_state.polygonMode = VK_POLYGON_MODE_FILL;
+	rs_state.cullMode = VK_CULL_MODE_NONE;
+	rs_state.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	rs_state.lineWidth = 1.0f;
+
+	VkPipelineMultisampleStateCreateInfo ms_state = {};
+	ms_state.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_state.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	// Additive, The Fragment Shader Premultiplies And Leaves Destination Alpha Alone
+	VkPipelineColorBlendAttachmentState blend_attachment = {};
+	blend_attachment.blendEnable = VK_TRUE;
+	blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+	blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+		VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+	VkPipelineColorBlendStateCreateInfo cb_state = {};
+	cb_state.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	cb_state.attachmentCount = 1;
+	cb_state.pAttachments = &blend_attachment;
+
+	VkDynamicState dynamic_states[] = {
+		VK_DYNAMIC_STATE_VIEWPORT,
+		VK_DYNAMIC_STATE_SCISSOR,
+	};
+
+	VkPipelineDynamicStateCreateInfo dyn_state = {};
+	dyn_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dyn_state.dynamicStateCount = OG_ARR_SIZE(dynamic_states);
+	dyn_state.pDynamicStates = dynamic_states;
+
+	VkGraphicsPipelineCreateInfo gp_create_info = {};
+	gp_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	gp_create_info.stageCount = OG_ARR_SIZE(stages);
+	gp_create_info.pStages = stages;
+	gp_create_info.pVertexInputState = &vi_state;
+	gp_create_info.pInputAssemblyState = &ia_state;
+	gp_create_info.pViewportState = &vp_state;
+	gp_create_info.pRasterizationState = &rs_state;
+	gp_create_info.pMultisampleState = &ms_state;
+	gp_create_info.pColorBlendState = &cb_state;
+	gp_create_info.pDynamicState = &dyn_state;
+	gp_create_info.layout = ps->draw_layout;
+	gp_create_info.renderPass = og_ctx->render_pass;
+	gp_create_info.subpass = 0;
+
+	ps->draw_pipeline = og_get_graphics_pipeline(og_ctx, &gp_create_info);
+}
+
+OG_INT void _create_particle_system(OGContext *og_ctx, uint32_t capacity, bool async) {
+	OGParticleSystem *ps = &og_ctx->particles;
+	memset(ps, 0, sizeof(OGParticleSystem));
+
+	ps->capacity = capacity;
+	ps->families[0] = og_ctx->graphics_idx;
+	ps->families[1] = og_ctx->compute_idx;
+	ps->async = async && og_ctx->compute_idx != og_ctx->graphics_idx;
+	if (async && !ps->async) {
+		OG_LOG_INFO("No Separate Compute Queue, Particles Simulate On The Graphics Queue");
+	}
+
+	_create_particle_pipelines(og_ctx);
+
+	bool created = true;
+	for (uint32_t i = 0; i < 2; i++) {
+		created &= __create_particle_buffer(og_ctx, (VkDeviceSize)capacity * sizeof(OGParticle),
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, OG_MEMORY_GPU_ONLY, &ps->particles[i]);
+	}
+	created &= __create_particle_buffer(og_ctx, sizeof(OGParticleCounters),
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+			OG_MEMORY_GPU_ONLY, &ps->counters);
+	created &= __create_particle_buffer(og_ctx, (VkDeviceSize)og_ctx->frame_count * OG_MAX_EMITS * sizeof(OGParticleEmitter),
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, OG_MEMORY_CPU_TO_GPU, &ps->emitters);
+	if (!created) {
+		OG_LOG_ERR("Particle Buffer Creation Failed");
+		return;
+	}
+
+	// Both Live Counts Start At Zero, After That Only The GPU Writes Them
+	VkCommandBuffer cmd_buffer = __begin_one_shot(og_ctx);
+	vkCmdFillBuffer(cmd_buffer, ps->counters.buffer, 0, VK_WHOLE_SIZE, 0);
+	__end_one_shot(og_ctx, cmd_buffer);
+
+	VkDescriptorPoolSize pool_size = {};
+	pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	pool_size.descriptorCount = 8;
+
+	VkDescriptorPoolCreateInfo dp_create_info = {};
+	dp_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	dp_create_info.maxSets = 2;
+	dp_create_info.poolSizeCount = 1;
+	dp_create_info.pPoolSizes = &pool_size;
+
+	OG_CHECK_VK(vkCreateDescriptorPool(og_ctx->logical_device, &dp_create_info,
+				NULL, &ps->desc_pool), "Particle Descriptor Pool Creation Failed");
+
+	VkDescriptorSetLayout set_layouts[2] = { ps->set_layout, ps->set_layout };
+
+	VkDescriptorSetAllocateInfo ds_alloc_info = {};
+	ds_alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	ds_alloc_info.descriptorPool = ps->desc_pool;
+	ds_alloc_info.descriptorSetCount = 2;
+	ds_alloc_info.pSetLayouts = set_layouts;
+
+	OG_CHECK_VK(vkAllocateDescriptorSets(og_ctx->logical_device, &ds_alloc_info,
+				ps->sets), "Particle Descriptor Set Allocation Failed");
+
+	for (uint32_t i = 0; i < 2; i++) {
+		VkDescriptorBufferInfo desc_buf_infos[4] = {};
+		desc_buf_infos[0].buffer = ps->particles[i].buffer;
+		desc_buf_infos[1].buffer = ps->particles[1 - i].buffer;
+		desc_buf_infos[2].buffer = ps->counters.buffer;
+		desc_buf_infos[3].buffer = ps->emitters.buffer;
+		for (uint32_t b = 0; b < 4; b++) {
+			desc_buf_infos[b].range = VK_WHOLE_SIZE;
+		}
+
+		VkWriteDescriptorSet desc_write = {};
+		desc_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		desc_write.dstSet = ps->sets[i];
+		desc_write.dstBinding = 0;
+		desc_write.descriptorCount = 4;
+		desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		desc_write.pBufferInfo = desc_buf_infos;
+
+		vkUpdateDescriptorSets(og_ctx->logical_device, 1, &desc_write, 0, NULL);
+	}
+
+	if (ps->async) {
+		for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+			VkCommandPoolCreateInfo pool_create_info = {};
+			pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+			pool_create_info.queueFamilyIndex = og_ctx->compute_idx;
+
+			OG_CHECK_VK(vkCreateCommandPool(og_ctx->logical_device, &pool_create_info,
+						NULL, &ps->pools[i]), "Particle Command Pool Creation Failed");
+
+			VkCommandBufferAllocateInfo cmd_alloc_info = {};
+			cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			cmd_alloc_info.commandBufferCount = 1;
+			cmd_alloc_info.commandPool = ps->pools[i];
+			cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+			OG_CHECK_VK(vkAllocateCommandBuffers(og_ctx->logical_device, &cmd_alloc_info,
+						&ps->cmd_buffers[i]), "Particle Command Buffer Allocation Failed");
+		}
+
+		VkSemaphoreTypeCreateInfo type_create_info = {};
+		type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+		type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+		type_create_info.initialValue = 0;
+
+		VkSemaphoreCreateInfo sem_create_info = {};
+		sem_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		sem_create_info.pNext = &type_create_info;
+
+		OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
+					NULL, &ps->timeline), "Particle Timeline Creation Failed");
+	}
+
+	ps->last_time = __now_seconds();
+}
+
+// Recorded Ahead Of The Graph, Into The Frame's Own Command Buffer Or Submitted
+// Right Away On The Compute Queue, Where It Overlaps Whatever Graphics Is Still Doing
+OG_INT void _simulate_particles(OGContext *og_ctx) {
+	OGParticleSystem *ps = &og_ctx->particles;
+
+	double now = __now_seconds();
+	float dt = (float)(now - ps->last_time);
+	ps->last_time = now;
+	if (dt > OG_PARTICLE_MAX_DT) {
+		dt = OG_PARTICLE_MAX_DT;
+	}
+
+	// Once The Last Particle Has Run Out Of Life There Is Nothing Left To Simulate
+	// Or Draw, Which Also Lets on_demand Stop Redrawing. The GPU Sums Its Own Float
+	// dt, So A Frame's Worth Of Slack Covers Its Rounding
+	if (ps->active && !ps->emit_count && ps->sim_time >= ps->alive_until + OG_PARTICLE_MAX_DT) {
+		ps->active = false;
+	}
+
+	if (!ps->active || !ps->counters.buffer) {
+		return;
+	}
+
+	// This Slot's Fence Has Signaled, So Its Emitter Range Is Free Again
+	OGParticleEmitter *mapped = ps->emitters.alloc.mapped;
+	memcpy(mapped + og_ctx->frame_idx * OG_MAX_EMITS, ps->emits, ps->emit_count * sizeof(OGParticleEmitter));
+
+	if (!ps->async) {
+		OG_PROFILE_GPU_BEGIN(og_ctx, "Particle Simulation");
+		__record_particles(og_ctx, og_ctx->curr_cmd_buffer, dt);
+		OG_PROFILE_GPU_END(og_ctx);
+	} else {
+		VkCommandBuffer cmd_buffer = ps->cmd_buffers[og_ctx->frame_idx];
+		OG_CHECK_VK(vkResetCommandPool(og_ctx->logical_device, ps->pools[og_ctx->frame_idx], 0), "Command Pool Reset Failed");
+
+		VkCommandBufferBeginInfo cb_begin_info = {};
+		cb_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		cb_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		OG_CHECK_VK(vkBeginCommandBuffer(cmd_buffer, &cb_begin_info), "Command Buffer Begin Failed");
+		__record_particles(og_ctx, cmd_buffer, dt);
+		OG_CHECK_VK(vkEndCommandBuffer(cmd_buffer), "Command Buffer End Failed");
+
+		// Waits For The Last Frame To Finish Drawing The Buffers This Overwrites
+		uint64_t wait_value = ps->frame_value;
+		ps->sim_value = ps->frame_value + 1;
+		ps->frame_value = ps->sim_value + 1;
+
+		VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+		VkTimelineSemaphoreSubmitInfo timeline_info = {};
+		timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timeline_info.waitSemaphoreValueCount = 1;
+		timeline_info.pWaitSemaphoreValues = &wait_value;
+		timeline_info.signalSemaphoreValueCount = 1;
+		timeline_info.pSignalSemaphoreValues = &ps->sim_value;
+
+		VkSubmitInfo submit_info = {};
+		submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submit_info.pNext = &timeline_info;
+		submit_info.commandBufferCount = 1;
+		submit_info.pCommandBuffers = &cmd_buffer;
+		submit_info.waitSemaphoreCount = 1;
+		submit_info.pWaitSemaphores = &ps->timeline;
+		submit_info.pWaitDstStageMask = &wait_stage;
+		submit_info.signalSemaphoreCount = 1;
+		submit_info.pSignalSemaphores = &ps->timeline;
+
+		OG_CHECK_VK(vkQueueSubmit(og_ctx->compute_queue, 1, &submit_info, VK_NULL_HANDLE), "Particle Submit Failed");
+	}
+
+	ps->current = 1 - ps->current;
+	ps->sim_time += dt;
+	ps->emitted = ps->emit_total;
+	ps->emit_count = 0;
+	ps->emit_total = 0;
+}
+
+// The Count Never Leaves The GPU, The Simulation Wrote It Straight Into The Draw
+OG_INT void _draw_particles(OGContext *og_ctx) {
+	OGParticleSystem *ps = &og_ctx->particles;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+	if (!ps->active || !ps->counters.buffer) {
+		return;
+	}
+
+	VkViewport viewport = {};
+	viewport.width = (float)og_ctx->curr_extent.width;
+	viewport.height = (float)og_ctx->curr_extent.height;
+	viewport.maxDepth = 1.0f;
+
+	VkRect2D scissor = og_ctx->curr_scissor;
+
+	float push[4] = {
+		2.0f / viewport.width, 2.0f / viewport.height,
+		-1.0f, -1.0f,
+	};
+
+	// The Set That Wrote particles[current] Has It As Binding 1, Where The Vertex Shader Reads
+	vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, ps->draw_pipeline);
+	vkCmdSetViewport(cmd_buffer, 0, 1, &viewport);
+	vkCmdSetScissor(cmd_buffer, 0, 1, &scissor);
+	vkCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, ps->draw_layout,
+			0, 1, &ps->sets[1 - ps->current], 0, NULL);
+	vkCmdPushConstants(cmd_buffer, ps->draw_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push), push);
+	vkCmdDrawIndirect(cmd_buffer, ps->counters.buffer,
+			ps->current * sizeof(VkDrawIndirectCommand), 1, sizeof(VkDrawIndirectCommand));
+}
+
+OG_INT void _destroy_particle_system(OGContext *og_ctx) {
+	OGParticleSystem *ps = &og_ctx->particles;
+
+	if (ps->async) {
+		for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+			vkDestroyCommandPool(og_ctx->logical_device, ps->pools[i], NULL);
+		}
+		vkDestroySemaphore(og_ctx->logical_device, ps->timeline, NULL);
+	}
+
+	vkDestroyDescriptorPool(og_ctx->logical_device, ps->desc_pool, NULL);
+	vkDestroyDescriptorSetLayout(og_ctx->logical_device, ps->set_layout, NULL);
+	vkDestroyPipelineLayout(og_ctx->logical_device, ps->compute_layout, NULL);
+	vkDestroyPipelineLayout(og_ctx->logical_device, ps->draw_layout, NULL);
+
+	for (uint32_t i = 0; i < 2; i++) {
+		og_destroy_buffer(og_ctx, &ps->particles[i]);
+	}
+	og_destroy_buffer(og_ctx, &ps->counters);
+	og_destroy_buffer(og_ctx, &ps->emitters);
+}
+
+
+OG_API void og_emit_particles(OGContext *og_ctx, const OGParticleEmitter *emitter, uint32_t count) {
+	OGParticleSystem *ps = &og_ctx->particles;
+	// More Than Fits Would Only Be Dropped On The GPU
+	if (count > ps->capacity - ps->emit_total) {
+		count = ps->capacity - ps->emit_total;
+	}
+	if (!count) {
+		return;
+	}
+	if (ps->emit_count == OG_MAX_EMITS) {
+		OG_LOG_ERR("Too Many Particle Emits This Frame");
+		return;
+	}
+
+	OGParticleEmitter *emit = &ps->emits[ps->emit_count++];
+	*emit = *emitter;
+	emit->first = ps->emit_total;
+	emit->count = count;
+
+	ps->emit_total += count;
+	ps->active = true;
+
+	// Spawned And Aged By The Next Simulation, Which Starts At The Current sim_time
+	float jitter = emitter->life_jitter < 0.0f ? -emitter->life_jitter : emitter->life_jitter;
+	double until = ps->sim_time + emitter->life + jitter * 0.5f;
+	if (until > ps->alive_until) {
+		ps->alive_until = until;
+	}
+}
+
+// Pixels Per Second Squared, drag Takes That Fraction Of Velocity Away Each Second
+OG_API void og_particle_forces(OGContext *og_ctx, float gravity_x, float gravity_y, float drag) {
+	OGParticleSystem *ps = &og_ctx->particles;
+	ps->gravity[0] = gravity_x;
+	ps->gravity[1] = gravity_y;
+	ps->drag = drag;
+}
+
+OG_API uint32_t og_particle_color(VkClearColorValue color) {
+	return __pack_color(color);
+}
@@ -0,0 +1,503 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_pipeline.h"
+#include "origami/common.h"
+
+OG_INT uint64_t __fnv1a(uint64_t hash, const void* data, size_t size) {
+	const uint8_t *bytes = data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= OG_FNV_PRIME;
+	}
+	return hash;
+}
+
+// Grows By Doubling Like The Tables, Sizes Are Small Enough That It Rarely Does
+OG_INT void __key_append(OGPipelineKey *key, const void* data, size_t size) {
+	if (key->size + size > key->capacity) {
+		while (key->size + size > key->capacity) {
+			key->capacity = key->capacity ? key->capacity * 2 : 256;
+		}
+		key->data = realloc(key->data, key->capacity);
+	}
+	if (size) {
+		memcpy(key->data + key->size, data, size);
+		key->size += size;
+	}
+}
+
+#define OG_KEY_FIELD(key, field) \
+	__key_append(key, &(field), sizeof((field)))
+
+// Marks Whether An Optional Pointer Was Set, So Absent And Empty State Never Match
+#define OG_KEY_PRESENT(key, ptr) do { \
+	uint8_t present = (ptr) != NULL; \
+	__key_append(key, &present, 1); \
+} while (0)
+
+// Specialization Data Is Baked Into The Pipeline, So It Is Part Of The Stage
+OG_INT bool __key_stage(OGPipelineKey *key, const VkPipelineShaderStageCreateInfo *stage) {
+	if (stage->pNext) {
+		return false;
+	}
+
+	OG_KEY_FIELD(key, stage->flags);
+	OG_KEY_FIELD(key, stage->stage);
+	OG_KEY_FIELD(key, stage->module); // Modules Are Deduplicated, So The Handle Stands For The Code
+	__key_append(key, stage->pName, strlen(stage->pName) + 1);
+
+	const VkSpecializationInfo *spec = stage->pSpecializationInfo;
+	OG_KEY_PRESENT(key, spec);
+	if (spec) {
+		OG_KEY_FIELD(key, spec->mapEntryCount);
+		__key_append(key, spec->pMapEntries, sizeof(VkSpecializationMapEntry) * spec->mapEntryCount);
+		OG_KEY_FIELD(key, spec->dataSize);
+		__key_append(key, spec->pData, spec->dataSize);
+	}
+	return true;
+}
+
+// Writes Out Every Field That Ends Up In The Pipeline, Never Padding. Extension
+// Structs Can't Be Walked Generically, So Any pNext Makes It Uncacheable
+OG_INT bool __graphics_pipeline_key(OGPipelineKey *key, const VkGraphicsPipelineCreateInfo *gp_create_info) {
+	if (gp_create_info->pNext) {
+		return false;
+	}
+
+	VkPipelineBindPoint bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS;
+	OG_KEY_FIELD(key, bind_point);
+	OG_KEY_FIELD(key, gp_create_info->flags);
+
+	OG_KEY_FIELD(key, gp_create_info->stageCount);
+	for (uint32_t i = 0; i < gp_create_info->stageCount; i++) {
+		if (!__key_stage(key, &gp_create_info->pStages[i])) {
+			return false;
+		}
+	}
+
+	const VkPipelineVertexInputStateCreateInfo *vi_state = gp_create_info->pVertexInputState;
+	OG_KEY_PRESENT(key, vi_state);
+	if (vi_state) {
+		if (vi_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, vi_state->flags);
+		OG_KEY_FIELD(key, vi_state->vertexBindingDescriptionCount);
+		__key_append(key, vi_state->pVertexBindingDescriptions,
+				sizeof(VkVertexInputBindingDescription) * vi_state->vertexBindingDescriptionCount);
+		OG_KEY_FIELD(key, vi_state->vertexAttributeDescriptionCount);
+		__key_append(key, vi_state->pVertexAttributeDescriptions,
+				sizeof(VkVertexInputAttributeDescription) * vi_state->vertexAttributeDescriptionCount);
+	}
+
+	const VkPipelineInputAssemblyStateCreateInfo *ia_state = gp_create_info->pInputAssemblyState;
+	OG_KEY_PRESENT(key, ia_state);
+	if (ia_state) {
+		if (ia_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, ia_state->flags);
+		OG_KEY_FIELD(key, ia_state->topology);
+		OG_KEY_FIELD(key, ia_state->primitiveRestartEnable);
+	}
+
+	const VkPipelineTessellationStateCreateInfo *ts_state = gp_create_info->pTessellationState;
+	OG_KEY_PRESENT(key, ts_state);
+	if (ts_state) {
+		if (ts_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, ts_state->flags);
+		OG_KEY_FIELD(key, ts_state->patchControlPoints);
+	}
+
+	// Static Viewports And Scissors Are Kept Even When Also Dynamic, That Only Costs A Miss
+	const VkPipelineViewportStateCreateInfo *vp_state = gp_create_info->pViewportState;
+	OG_KEY_PRESENT(key, vp_state);
+	if (vp_state) {
+		if (vp_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, vp_state->flags);
+		OG_KEY_FIELD(key, vp_state->viewportCount);
+		OG_KEY_PRESENT(key, vp_state->pViewports);
+		if (vp_state->pViewports) {
+			__key_append(key, vp_state->pViewports, sizeof(VkViewport) * vp_state->viewportCount);
+		}
+		OG_KEY_FIELD(key, vp_state->scissorCount);
+		OG_KEY_PRESENT(key, vp_state->pScissors);
+		if (vp_state->pScissors) {
+			__key_append(key, vp_state->pScissors, sizeof(VkRect2D) * vp_state->scissorCount);
+		}
+	}
+
+	const VkPipelineRasterizationStateCreateInfo *rs_state = gp_create_info->pRasterizationState;
+	OG_KEY_PRESENT(key, rs_state);
+	if (rs_state) {
+		if (rs_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, rs_state->flags);
+		OG_KEY_FIELD(key, rs_state->depthClampEnable);
+		OG_KEY_FIELD(key, rs_state->rasterizerDiscardEnable);
+		OG_KEY_FIELD(key, rs_state->polygonMode);
+		OG_KEY_FIELD(key, rs_state->cullMode);
+		OG_KEY_FIELD(key, rs_state->frontFace);
+		OG_KEY_FIELD(key, rs_state->depthBiasEnable);
+		OG_KEY_FIELD(key, rs_state->depthBiasConstantFactor);
+		OG_KEY_FIELD(key, rs_state->depthBiasClamp);
+		OG_KEY_FIELD(key, rs_state->depthBiasSlopeFactor);
+		OG_KEY_FIELD(key, rs_state->lineWidth);
+	}
+
+	const VkPipelineMultisampleStateCreateInfo *ms_state = gp_create_info->pMultisampleState;
+	OG_KEY_PRESENT(key, ms_state);
+	if (ms_state) {
+		if (ms_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, ms_state->flags);
+		OG_KEY_FIELD(key, ms_state->rasterizationSamples);
+		OG_KEY_FIELD(key, ms_state->sampleShadingEnable);
+		OG_KEY_FIELD(key, ms_state->minSampleShading);
+		OG_KEY_PRESENT(key, ms_state->pSampleMask);
+		if (ms_state->pSampleMask) {
+			uint32_t mask_words = ((uint32_t)ms_state->rasterizationSamples + 31) / 32;
+			__key_append(key, ms_state->pSampleMask, sizeof(VkSampleMask) * mask_words);
+		}
+		OG_KEY_FIELD(key, ms_state->alphaToCoverageEnable);
+		OG_KEY_FIELD(key, ms_state->alphaToOneEnable);
+	}
+
+	const VkPipelineDepthStencilStateCreateInfo *ds_state = gp_create_info->pDepthStencilState;
+	OG_KEY_PRESENT(key, ds_state);
+	if (ds_state) {
+		if (ds_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, ds_state->flags);
+		OG_KEY_FIELD(key, ds_state->depthTestEnable);
+		OG_KEY_FIELD(key, ds_state->depthWriteEnable);
+		OG_KEY_FIELD(key, ds_state->depthCompareOp);
+		OG_KEY_FIELD(key, ds_state->depthBoundsTestEnable);
+		OG_KEY_FIELD(key, ds_state->stencilTestEnable);
+		OG_KEY_FIELD(key, ds_state->front);
+		OG_KEY_FIELD(key, ds_state->back);
+		OG_KEY_FIELD(key, ds_state->minDepthBounds);
+		OG_KEY_FIELD(key, ds_state->maxDepthBounds);
+	}
+
+	const VkPipelineColorBlendStateCreateInfo *cb_state = gp_create_info->pColorBlendState;
+	OG_KEY_PRESENT(key, cb_state);
+	if (cb_state) {
+		if (cb_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, cb_state->flags);
+		OG_KEY_FIELD(key, cb_state->logicOpEnable);
+		OG_KEY_FIELD(key, cb_state->logicOp);
+		OG_KEY_FIELD(key, cb_state->attachmentCount);
+		__key_append(key, cb_state->pAttachments,
+				sizeof(VkPipelineColorBlendAttachmentState) * cb_state->attachmentCount);
+		OG_KEY_FIELD(key, cb_state->blendConstants);
+	}
+
+	const VkPipelineDynamicStateCreateInfo *dyn_state = gp_create_info->pDynamicState;
+	OG_KEY_PRESENT(key, dyn_state);
+	if (dyn_state) {
+		if (dyn_state->pNext) {
+			return false;
+		}
+		OG_KEY_FIELD(key, dyn_state->flags);
+		OG_KEY_FIELD(key, dyn_state->dynamicStateCount);
+		__key_append(key, dyn_state->pDynamicStates, sizeof(VkDynamicState) * dyn_state->dynamicStateCount);
+	}
+
+	OG_KEY_FIELD(key, gp_create_info->layout);
+	OG_KEY_FIELD(key, gp_create_info->renderPass);
+	OG_KEY_FIELD(key, gp_create_info->subpass);
+	OG_KEY_FIELD(key, gp_create_info->basePipelineHandle);
+	OG_KEY_FIELD(key, gp_create_info->basePipelineIndex);
+	return true;
+}
+
+// Shares The Table With Graphics Pipelines, The Bind Point Keeps The Two Apart
+OG_INT bool __compute_pipeline_key(OGPipelineKey *key, const VkComputePipelineCreateInfo *cp_create_info) {
+	if (cp_create_info->pNext) {
+		return false;
+	}
+
+	VkPipelineBindPoint bind_point = VK_PIPELINE_BIND_POINT_COMPUTE;
+	OG_KEY_FIELD(key, bind_point);
+	OG_KEY_FIELD(key, cp_create_info->flags);
+
+	if (!__key_stage(key, &cp_create_info->stage)) {
+		return false;
+	}
+
+	OG_KEY_FIELD(key, cp_create_info->layout);
+	OG_KEY_FIELD(key, cp_create_info->basePipelineHandle);
+	OG_KEY_FIELD(key, cp_create_info->basePipelineIndex);
+	return true;
+}
+
+// The Hash Only Narrows The Search, A Hit Needs The Whole Key To Match
+OG_INT VkPipeline __cached_pipeline(OGPipelineCache *pc, const OGPipelineKey *key, uint64_t hash) {
+	for (uint32_t i = 0; i < pc->pipeline_count; i++) {
+		OGPipelineEntry *entry = &pc->pipelines[i];
+		if (entry->hash == hash && entry->key_size == key->size &&
+				entry->key && memcmp(entry->key, key->data, key->size) == 0) {
+			pc->pipeline_hits++;
+			return entry->pipeline;
+		}
+	}
+	return VK_NULL_HANDLE;
+}
+
+// Takes Over The Key's Data, An Empty Key Stores A Pipeline Nothing Can Match
+OG_INT void __cache_pipeline(OGPipelineCache *pc, OGPipelineKey *key, uint64_t hash, VkPipeline pipeline) {
+	if (pc->pipeline_count == pc->pipeline_capacity) {
+		pc->pipeline_capacity = pc->pipeline_capacity ? pc->pipeline_capacity * 2 : 16;
+		pc->pipelines = realloc(pc->pipelines, sizeof(OGPipelineEntry) * pc->pipeline_capacity);
+	}
+	pc->pipelines[pc->pipeline_count].hash = hash;
+	pc->pipelines[pc->pipeline_count].key = key->data;
+	pc->pipelines[pc->pipeline_count].key_size = key->size;
+	pc->pipelines[pc->pipeline_count].pipeline = pipeline;
+	pc->pipeline_count++;
+
+	key->data = NULL;
+	key->size = 0;
+	key->capacity = 0;
+}
+
+// Returns The Driver's Blob Or NULL When The File Is Missing, Damaged Or From Another Device/Driver
+OG_INT void* __load_pipeline_cache(OGContext *og_ctx, const char* path, size_t *size) {
+	FILE *file = fopen(path, "rb");
+	if (!file) {
+		return NULL;
+	}
+
+	OGPipelineCacheHeader header = {};
+	if (fread(&header, sizeof(header), 1, file) != 1) {
+		fclose(file);
+		return NULL;
+	}
+
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(og_ctx->physical_device, &pd_props);
+
+	if (header.magic != OG_PIPELINE_CACHE_MAGIC ||
+			header.driver_version != pd_props.driverVersion ||
+			header.vendor_id != pd_props.vendorID ||
+			header.device_id != pd_props.deviceID ||
+			memcmp(header.uuid, pd_props.pipelineCacheUUID, VK_UUID_SIZE) != 0 ||
+			header.data_size < sizeof(VkPipelineCacheHeaderVersionOne)) {
+		OG_LOG_INFO("Pipeline Cache Is From Another Device Or Driver, Starting Cold");
+		fclose(file);
+		return NULL;
+	}
+
+	void *data = malloc(header.data_size);
+	size_t read = fread(data, 1, header.data_size, file);
+	fclose(file);
+
+	// The Driver Checks Its Own Header Too, Catch Truncated Files Before It Sees Them
+	VkPipelineCacheHeaderVersionOne *vk_header = data;
+	if (read != header.data_size ||
+			__fnv1a(OG_FNV_OFFSET, data, header.data_size) != header.data_hash ||
+			vk_header->headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+			memcmp(vk_header->pipelineCacheUUID, pd_props.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+		OG_LOG_INFO("Pipeline Cache Is Damaged, Starting Cold");
+		free(data);
+		return NULL;
+	}
+
+	*size = header.data_size;
+	return data;
+}
+
+
+OG_INT void _create_pipeline_cache(OGContext *og_ctx, const char* path) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+	memset(pc, 0, sizeof(OGPipelineCache));
+	pc->path = path;
+
+	size_t data_size = 0;
+	void *data = path ? __load_pipeline_cache(og_ctx, path, &data_size) : NULL;
+	pc->warm = data != NULL;
+
+	VkPipelineCacheCreateInfo pc_create_info = {};
+	pc_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	pc_create_info.initialDataSize = data_size;
+	pc_create_info.pInitialData = data;
+
+	OG_CHECK_VK(vkCreatePipelineCache(og_ctx->logical_device, &pc_create_info,
+				NULL, &pc->cache), "Pipeline Cache Creation Failed");
+	free(data);
+}
+
+// Written To A Temporary File First So A Crash Mid Write Never Leaves A Torn Cache
+OG_INT void _save_pipeline_cache(OGContext *og_ctx) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+	if (!pc->path) {
+		return;
+	}
+
+	size_t data_size = 0;
+	OG_CHECK_VK(vkGetPipelineCacheData(og_ctx->logical_device, pc->cache,
+				&data_size, NULL), "Pipeline Cache Size Query Failed");
+	if (!data_size) {
+		return;
+	}
+
+	void *data = malloc(data_size);
+	OG_CHECK_VK(vkGetPipelineCacheData(og_ctx->logical_device, pc->cache,
+				&data_size, data), "Pipeline Cache Data Query Failed");
+
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(og_ctx->physical_device, &pd_props);
+
+	OGPipelineCacheHeader header = {};
+	header.magic = OG_PIPELINE_CACHE_MAGIC;
+	header.driver_version = pd_props.driverVersion;
+	header.vendor_id = pd_props.vendorID;
+	header.device_id = pd_props.deviceID;
+	memcpy(header.uuid, pd_props.pipelineCacheUUID, VK_UUID_SIZE);
+	header.data_size = data_size;
+	header.data_hash = __fnv1a(OG_FNV_OFFSET, data, data_size);
+
+	size_t path_len = strlen(pc->path);
+	char tmp_path[path_len + 5];
+	snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", pc->path);
+
+	FILE *file = fopen(tmp_path, "wb");
+	if (!file) {
+		OG_LOG_ERR("Pipeline Cache Could Not Be Written");
+		free(data);
+		return;
+	}
+
+	bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(data, 1, data_size, file) == data_size;
+	written = fclose(file) == 0 && written;
+	free(data);
+
+	if (!written || rename(tmp_path, pc->path) != 0) {
+		OG_LOG_ERR("Pipeline Cache Could Not Be Written");
+		remove(tmp_path);
+	}
+}
+
+OG_INT void _destroy_pipeline_cache(OGContext *og_ctx) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+
+	for (uint32_t i = 0; i < pc->pipeline_count; i++) {
+		vkDestroyPipeline(og_ctx->logical_device, pc->pipelines[i].pipeline, NULL);
+		free(pc->pipelines[i].key);
+	}
+	for (uint32_t i = 0; i < pc->shader_count; i++) {
+		vkDestroyShaderModule(og_ctx->logical_device, pc->shaders[i].module, NULL);
+		free(pc->shaders[i].code);
+	}
+	free(pc->pipelines);
+	free(pc->shaders);
+
+	vkDestroyPipelineCache(og_ctx->logical_device, pc->cache, NULL);
+}
+
+
+// The Cache Owns The Module, It Lives Until og_quit
+OG_API VkShaderModule og_get_shader_module(OGContext *og_ctx, const uint32_t *code, size_t size) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+	uint64_t hash = __fnv1a(OG_FNV_OFFSET, code, size);
+
+	for (uint32_t i = 0; i < pc->shader_count; i++) {
+		// Code Can Come From Asset Packs, So A Colliding Hash Must Never Be Enough
+		if (pc->shaders[i].hash == hash && pc->shaders[i].size == size &&
+				memcmp(pc->shaders[i].code, code, size) == 0) {
+			pc->shader_hits++;
+			return pc->shaders[i].module;
+		}
+	}
+
+	VkShaderModuleCreateInfo sm_create_info = {};
+	sm_create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	sm_create_info.codeSize = size;
+	sm_create_info.pCode = code;
+
+	VkShaderModule module = VK_NULL_HANDLE;
+	OG_CHECK_VK(vkCreateShaderModule(og_ctx->logical_device, &sm_create_info,
+				NULL, &module), "Shader Module Creation Failed");
+
+	if (pc->shader_count == pc->shader_capacity) {
+		pc->shader_capacity = pc->shader_capacity ? pc->shader_capacity * 2 : 16;
+		pc->shaders = realloc(pc->shaders, sizeof(OGShaderEntry) * pc->shader_capacity);
+	}
+	pc->shaders[pc->shader_count].hash = hash;
+	pc->shaders[pc->shader_count].size = size;
+	pc->shaders[pc->shader_count].code = malloc(size);
+	memcpy(pc->shaders[pc->shader_count].code, code, size);
+	pc->shaders[pc->shader_count].module = module;
+	pc->shader_count++;
+	return module;
+}
+
+// Identical State Is Built Once And Shared, The Cache Owns The Pipeline.
+// Descriptions With A pNext Chain Are Built Every Time, Still Owned By The Cache
+OG_API VkPipeline og_get_graphics_pipeline(OGContext *og_ctx, const VkGraphicsPipelineCreateInfo *gp_create_info) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+	OGPipelineKey key = {};
+	uint64_t hash = 0;
+
+	VkPipeline pipeline = VK_NULL_HANDLE;
+	if (__graphics_pipeline_key(&key, gp_create_info)) {
+		hash = __fnv1a(OG_FNV_OFFSET, key.data, key.size);
+		pipeline = __cached_pipeline(pc, &key, hash);
+	} else {
+		free(key.data);
+		key.data = NULL;
+		key.size = 0;
+	}
+
+	if (pipeline) {
+		free(key.data);
+		return pipeline;
+	}
+
+	OG_CHECK_VK(vkCreateGraphicsPipelines(og_ctx->logical_device, pc->cache, 1,
+				gp_create_info, NULL, &pipeline), "Graphics Pipeline Creation Failed");
+
+	__cache_pipeline(pc, &key, hash, pipeline);
+	return pipeline;
+}
+
+OG_API VkPipeline og_get_compute_pipeline(OGContext *og_ctx, const VkComputePipelineCreateInfo *cp_create_info) {
+	OGPipelineCache *pc = &og_ctx->pipelines;
+	OGPipelineKey key = {};
+	uint64_t hash = 0;
+
+	VkPipeline pipeline = VK_NULL_HANDLE;
+	if (__compute_pipeline_key(&key, cp_create_info)) {
+		hash = __fnv1a(OG_FNV_OFFSET, key.data, key.size);
+		pipeline = __cached_pipeline(pc, &key, hash);
+	} else {
+		free(key.data);
+		key.data = NULL;
+		key.size = 0;
+	}
+
+	if (pipeline) {
+		free(key.data);
+		return pipeline;
+	}
+
+	OG_CHECK_VK(vkCreateComputePipelines(og_ctx->logical_device, pc->cache, 1,
+				cp_create_info, NULL, &pipeline), "Compute Pipeline Creation Failed");
+
+	__cache_pipeline(pc, &key, hash, pipeline);
+	return pipeline;
+}
@@ -0,0 +1,307 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "origami/og_renderer.h"
+#include "origami/og_profile.h"
+#include "origami/common.h"
+
+#ifdef OG_PROFILE
+
+#include <time.h>
+
+OG_INT double __profile_now_ms() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+OG_INT void __profile_push_event(OGProfiler *prof, const OGProfileEvent *event) {
+	prof->events[prof->event_head] = *event;
+	prof->event_head = (prof->event_head + 1) % OG_PROFILE_MAX_EVENTS;
+	if (prof->event_count < OG_PROFILE_MAX_EVENTS) {
+		prof->event_count++;
+	}
+}
+
+OG_INT int __compare_doubles(const void *a, const void *b) {
+	double da = *(const double*)a;
+	double db = *(const double*)b;
+	return (da > db) - (da < db);
+}
+
+// Min, Mean And 99th Percentile Over The Last OG_PROFILE_HISTORY Samples
+OG_INT OGProfileStat __profile_stat(const double *history, uint64_t samples) {
+	OGProfileStat stat = {};
+	if (!samples) {
+		return stat;
+	}
+
+	uint32_t count = samples < OG_PROFILE_HISTORY ? (uint32_t)samples : OG_PROFILE_HISTORY;
+	double sorted[OG_PROFILE_HISTORY];
+	memcpy(sorted, history, sizeof(double) * count);
+	qsort(sorted, count, sizeof(double), __compare_doubles);
+
+	double sum = 0.0;
+	for (uint32_t i = 0; i < count; i++) {
+		sum += sorted[i];
+	}
+
+	stat.last_ms = history[(samples - 1) % OG_PROFILE_HISTORY];
+	stat.min_ms = sorted[0];
+	stat.avg_ms = sum / count;
+	stat.p99_ms = sorted[(count - 1) * 99 / 100];
+	return stat;
+}
+
+
+OG_INT void _create_profiler(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	memset(prof, 0, sizeof(OGProfiler));
+
+	prof->events = malloc(sizeof(OGProfileEvent) * OG_PROFILE_MAX_EVENTS);
+	prof->epoch_ms = __profile_now_ms();
+
+	VkPhysicalDeviceProperties pd_props = {};
+	vkGetPhysicalDeviceProperties(og_ctx->physical_device, &pd_props);
+
+	uint32_t queue_family_count = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(og_ctx->physical_device, &queue_family_count, NULL);
+
+	VkQueueFamilyProperties queue_properties[queue_family_count];
+	vkGetPhysicalDeviceQueueFamilyProperties(og_ctx->physical_device, &queue_family_count, queue_properties);
+
+	uint32_t valid_bits = queue_properties[og_ctx->graphics_idx].timestampValidBits;
+	prof->gpu_timing = valid_bits != 0;
+	prof->ns_per_tick = pd_props.limits.timestampPeriod;
+	prof->tick_mask = valid_bits >= 64 ? UINT64_MAX : (1ull << valid_bits) - 1;
+
+	if (!prof->gpu_timing) {
+		OG_LOG_INFO("Graphics Queue Has No Timestamps, Profiling CPU Only");
+		return;
+	}
+
+	VkQueryPoolCreateInfo qp_create_info = {};
+	qp_create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	qp_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	qp_create_info.queryCount = OG_PROFILE_MAX_SCOPES * 2;
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		OG_CHECK_VK(vkCreateQueryPool(og_ctx->logical_device, &qp_create_info,
+					NULL, &prof->frames[i].query_pool), "Timestamp Query Pool Creation Failed");
+	}
+}
+
+OG_INT void _destroy_profiler(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		if (prof->frames[i].query_pool) {
+			vkDestroyQueryPool(og_ctx->logical_device, prof->frames[i].query_pool, NULL);
+		}
+	}
+	free(prof->events);
+}
+
+OG_INT void _profile_frame_begin(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	double now = __profile_now_ms() - prof->epoch_ms;
+
+	if (prof->last_frame_ms > 0.0) {
+		prof->cpu_history[prof->cpu_samples % OG_PROFILE_HISTORY] = now - prof->last_frame_ms;
+		prof->cpu_samples++;
+		prof->stats.cpu_frame = __profile_stat(prof->cpu_history, prof->cpu_samples);
+	}
+	prof->last_frame_ms = now;
+	prof->frame = og_ctx->frame_number;
+	prof->stats.frames++;
+
+	og_profile_cpu_begin(og_ctx, "Frame");
+}
+
+OG_INT void _profile_frame_end(OGContext *og_ctx) {
+	og_profile_cpu_end(og_ctx);
+}
+
+// Runs Right After The Slot's Fence Wait, So Results Are Frame Count Late And Never Stall
+OG_INT void _profile_collect(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	OGProfileFrame *pf = &prof->frames[og_ctx->frame_idx];
+
+	if (!prof->gpu_timing || !pf->recorded || !pf->scope_count) {
+		return;
+	}
+	pf->recorded = false;
+
+	uint64_t ticks[OG_PROFILE_MAX_SCOPES * 2];
+	if (vkGetQueryPoolResults(og_ctx->logical_device, pf->query_pool, 0, pf->scope_count * 2,
+				sizeof(ticks), ticks, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) {
+		return;
+	}
+
+	// The First Scope Spans The Whole Frame, Its Start Is Pinned To When Recording Began
+	double base = (double)(ticks[0] & prof->tick_mask);
+	double to_ms = prof->ns_per_tick / 1e6;
+
+	for (uint32_t i = 0; i < pf->scope_count; i++) {
+		OGProfileEvent event = {};
+		event.name = pf->names[i];
+		event.start_ms = pf->record_ms + ((double)(ticks[i * 2] & prof->tick_mask) - base) * to_ms;
+		event.end_ms = pf->record_ms + ((double)(ticks[i * 2 + 1] & prof->tick_mask) - base) * to_ms;
+		event.frame = pf->frame;
+		event.depth = pf->depths[i];
+		event.gpu = true;
+		__profile_push_event(prof, &event);
+	}
+
+	prof->gpu_history[prof->gpu_samples % OG_PROFILE_HISTORY] =
+		((double)(ticks[1] & prof->tick_mask) - base) * to_ms;
+	prof->gpu_samples++;
+	prof->stats.gpu_frame = __profile_stat(prof->gpu_history, prof->gpu_samples);
+}
+
+// Called Right After vkBeginCommandBuffer, Outside Any Render Pass
+OG_INT void _profile_record_begin(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	OGProfileFrame *pf = &prof->frames[og_ctx->frame_idx];
+
+	pf->scope_count = 0;
+	pf->open_count = 0;
+	pf->frame = og_ctx->frame_number;
+	pf->record_ms = __profile_now_ms() - prof->epoch_ms;
+
+	if (!prof->gpu_timing) {
+		return;
+	}
+
+	vkCmdResetQueryPool(og_ctx->curr_cmd_buffer, pf->query_pool, 0, OG_PROFILE_MAX_SCOPES * 2);
+	og_profile_gpu_begin(og_ctx, "GPU Frame");
+}
+
+OG_INT void _profile_record_end(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	OGProfileFrame *pf = &prof->frames[og_ctx->frame_idx];
+
+	prof->stats.sprite_binds = og_ctx->sprites.binds;
+	prof->stats.sprite_binds_unsorted = og_ctx->sprites.binds_unsorted;
+
+	if (!prof->gpu_timing) {
+		return;
+	}
+
+	// Scopes Left Open By The Render Callback Are Closed Here Along With The Frame
+	while (pf->open_count) {
+		og_profile_gpu_end(og_ctx);
+	}
+	pf->recorded = true;
+}
+
+
+// name Must Outlive The Profiler, String Literals Are The Intended Use
+OG_API void og_profile_cpu_begin(OGContext *og_ctx, const char* name) {
+	OGProfiler *prof = &og_ctx->profiler;
+	if (prof->cpu_depth == OG_PROFILE_MAX_DEPTH) {
+		return;
+	}
+
+	prof->cpu_names[prof->cpu_depth] = name;
+	prof->cpu_starts[prof->cpu_depth] = __profile_now_ms() - prof->epoch_ms;
+	prof->cpu_depth++;
+}
+
+OG_API void og_profile_cpu_end(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	if (!prof->cpu_depth) {
+		return;
+	}
+	prof->cpu_depth--;
+
+	OGProfileEvent event = {};
+	event.name = prof->cpu_names[prof->cpu_depth];
+	event.start_ms = prof->cpu_starts[prof->cpu_depth];
+	event.end_ms = __profile_now_ms() - prof->epoch_ms;
+	event.frame = prof->frame;
+	event.depth = prof->cpu_depth;
+	__profile_push_event(prof, &event);
+}
+
+// Only Valid While og_render Is Recording, Usually From The Render Callback
+OG_API void og_profile_gpu_begin(OGContext *og_ctx, const char* name) {
+	OGProfiler *prof = &og_ctx->profiler;
+	OGProfileFrame *pf = &prof->frames[og_ctx->frame_idx];
+
+	if (!prof->gpu_timing || pf->open_count == OG_PROFILE_MAX_DEPTH) {
+		return;
+	}
+
+	// Out Of Queries, Still Track The Scope So Its End Stays Balanced
+	if (pf->scope_count == OG_PROFILE_MAX_SCOPES) {
+		pf->open[pf->open_count++] = UINT32_MAX;
+		return;
+	}
+
+	uint32_t scope = pf->scope_count++;
+	pf->names[scope] = name;
+	pf->depths[scope] = pf->open_count;
+	pf->open[pf->open_count++] = scope;
+
+	vkCmdWriteTimestamp(og_ctx->curr_cmd_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+			pf->query_pool, scope * 2);
+}
+
+OG_API void og_profile_gpu_end(OGContext *og_ctx) {
+	OGProfiler *prof = &og_ctx->profiler;
+	OGProfileFrame *pf = &prof->frames[og_ctx->frame_idx];
+
+	if (!prof->gpu_timing || !pf->open_count) {
+		return;
+	}
+
+	uint32_t scope = pf->open[--pf->open_count];
+	if (scope == UINT32_MAX) {
+		return;
+	}
+
+	vkCmdWriteTimestamp(og_ctx->curr_cmd_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			pf->query_pool, scope * 2 + 1);
+}
+
+// Chrome Trace Event Format, Open With chrome://tracing Or ui.perfetto.dev
+OG_API bool og_profile_dump_trace(OGContext *og_ctx, const char* path) {
+	OGProfiler *prof = &og_ctx->profiler;
+
+	FILE *file = fopen(path, "w");
+	if (!file) {
+		OG_LOG_ERR("Trace File Could Not Be Opened");
+		return false;
+	}
+
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"GPU\"}}");
+
+	uint32_t first = (prof->event_head + OG_PROFILE_MAX_EVENTS - prof->event_count) % OG_PROFILE_MAX_EVENTS;
+	for (uint32_t i = 0; i < prof->event_count; i++) {
+		OGProfileEvent *event = &prof->events[(first + i) % OG_PROFILE_MAX_EVENTS];
+
+		fprintf(file, ",\n{\"name\":\"");
+		for (const char *c = event->name; *c; c++) {
+			if (*c == '"' || *c == '\\') {
+				fputc('\\', file);
+			}
+			fputc(*c, file);
+		}
+		fprintf(file, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d,"
+				"\"args\":{\"frame\":%llu}}",
+				event->gpu ? "gpu" : "cpu", event->start_ms * 1000.0,
+				(event->end_ms - event->start_ms) * 1000.0, event->gpu ? 1 : 0,
+				(unsigned long long)event->frame);
+	}
+
+	fprintf(file, "\n]}\n");
+	return fclose(file) == 0;
+}
+
+#endif // OG_PROFILE
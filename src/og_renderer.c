@@ -2,174 +2,576 @@
  * This Code is in the Public Domain
  */
 
+#define _POSIX_C_SOURCE 200809L
 #include "origami/og_renderer.h"
 #include "origami/common.h"
 
-OG_INT void __alloc_cmd_buffer(OGContext *og_ctx) {
+#include <time.h>
+
+OG_INT static VKAPI_ATTR VkBool32 VKAPI_CALL __debug_callback(
+		VkDebugUtilsMessageSeverityFlagBitsEXT msgSeverity,
+		VkDebugUtilsMessageTypeFlagsEXT msgType,
+		const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
+		void *pUserData) {
+	(void)msgSeverity;
+	(void)msgType;
+	(void)pUserData;
+
+	OG_LOG_INFOVAR("VALIDATION ERROR", pCallbackData->pMessage);
+	return false;
+}
+
+// Blocking Helpers For Setup Work Outside The Frame Loop
+OG_INT VkCommandBuffer __begin_one_shot(OGContext *og_ctx) {
 	VkCommandBufferAllocateInfo cmd_alloc_info = {};
 	cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 	cmd_alloc_info.commandBufferCount = 1;
-	cmd_alloc_info.commandPool = og_ctx->command_pool;
+	cmd_alloc_info.commandPool = og_ctx->one_shot_pool;
 	cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
 
+	VkCommandBuffer cmd_buffer = VK_NULL_HANDLE;
 	OG_CHECK_VK(vkAllocateCommandBuffers(og_ctx->logical_device,
-				&cmd_alloc_info, &og_ctx->curr_cmd_buffer), "Command Buffer Allocation Failed");
+				&cmd_alloc_info, &cmd_buffer), "Command Buffer Allocation Failed");
+
+	VkCommandBufferBeginInfo cb_begin_info = {};
+	cb_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cb_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
+	OG_CHECK_VK(vkBeginCommandBuffer(cmd_buffer, &cb_begin_info), "Command Buffer Begin Failed");
+	return cmd_buffer;
 }
 
-OG_INT static VKAPI_ATTR VkBool32 VKAPI_CALL __debug_callback(
-		VkDebugUtilsMessageSeverityFlagBitsEXT msgSeverity,
-		VkDebugUtilsMessageTypeFlagsEXT msgType,
-		const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
-		void *pUserData) {
-	OG_LOG_INFOVAR("VALIDATION ERROR", pCallbackData->pMessage);
-	return false;
+OG_INT void __end_one_shot(OGContext *og_ctx, VkCommandBuffer cmd_buffer) {
+	OG_CHECK_VK(vkEndCommandBuffer(cmd_buffer), "Command Buffer End Failed");
+
+	VkSubmitInfo submit_info = {};
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &cmd_buffer;
+
+	OG_CHECK_VK(vkQueueSubmit(og_ctx->graphics_queue, 1, &submit_info, 0), "Queue Submit Failed");
+	OG_CHECK_VK(vkQueueWaitIdle(og_ctx->graphics_queue), "Queue Wait Idle Failed");
+
+	vkFreeCommandBuffers(og_ctx->logical_device, og_ctx->one_shot_pool, 1, &cmd_buffer);
+}
+
+// GLFW's Clock Only Exists Once It Is Initialized, Headless Contexts Never Do That
+OG_INT double __now_seconds() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+OG_INT void __framebuffer_size_callback(GLFWwindow *window, int width, int height) {
+	(void)width;
+	(void)height;
+
+	OGContext *og_ctx = glfwGetWindowUserPointer(window);
+	og_ctx->swapchain_dirty = true;
+}
+
+// The Window System Lost What Was On Screen, Only Matters With on_demand
+OG_INT void __window_refresh_callback(GLFWwindow *window) {
+	og_invalidate(glfwGetWindowUserPointer(window));
+}
+
+OG_INT VkPresentModeKHR __pick_present_mode(OGContext *og_ctx) {
+	VkPresentModeKHR wanted = VK_PRESENT_MODE_MAILBOX_KHR;
+	switch (og_ctx->present_mode) {
+		case OG_PRESENT_IMMEDIATE: wanted = VK_PRESENT_MODE_IMMEDIATE_KHR; break;
+		case OG_PRESENT_FIFO: wanted = VK_PRESENT_MODE_FIFO_KHR; break;
+		case OG_PRESENT_FIFO_RELAXED: wanted = VK_PRESENT_MODE_FIFO_RELAXED_KHR; break;
+		default: break;
+	}
+
+	uint32_t present_mode_count = 0;
+	vkGetPhysicalDeviceSurfacePresentModesKHR(og_ctx->physical_device, og_ctx->surface, &present_mode_count, 0);
+	VkPresentModeKHR present_modes[present_mode_count];
+
+	OG_CHECK_VK(vkGetPhysicalDeviceSurfacePresentModesKHR(og_ctx->physical_device,
+				og_ctx->surface, &present_mode_count, present_modes), "Surface Present Mode Get Failed");
+
+	for (uint32_t i = 0; i < present_mode_count; i++) {
+		if (present_modes[i] == wanted) {
+			return wanted;
+		}
+	}
+
+	if (og_ctx->present_mode != OG_PRESENT_DEFAULT && !og_ctx->swapchain) {
+		OG_LOG_INFO("Requested Present Mode Not Supported, Falling Back To FIFO");
+	}
+
+	// Guaranteed To Be Present By Standard
+	return VK_PRESENT_MODE_FIFO_KHR;
 }
 
 
 OG_API void og_init(OGContext *og_ctx, OGConfig *og_cfg) {
+	og_ctx->frame_count = og_cfg->frames_in_flight ? og_cfg->frames_in_flight : OG_DEFAULT_FRAMES_IN_FLIGHT;
+	if (og_ctx->frame_count > OG_MAX_FRAMES_IN_FLIGHT) {
+		og_ctx->frame_count = OG_MAX_FRAMES_IN_FLIGHT;
+	}
+	og_ctx->frame_idx = 0;
+	og_ctx->frame_number = 0;
+
+	og_ctx->headless = og_cfg->headless;
+	og_ctx->async_compute = og_cfg->async_compute;
+	og_ctx->present_mode = og_cfg->present_mode;
+	og_ctx->swapchain_images = og_cfg->swapchain_images;
+	og_ctx->swapchain = VK_NULL_HANDLE;
+	og_ctx->swapchain_dirty = false;
+	og_ctx->max_fps = og_cfg->max_fps;
+	og_ctx->next_frame_time = 0.0;
+	og_ctx->readback = og_cfg->readback && og_cfg->headless;
+	if (og_cfg->readback && !og_cfg->headless) {
+		OG_LOG_INFO("Frame Readback Is Only Available In Headless Mode");
+	}
+
+	_init_damage(og_ctx, og_cfg->on_demand);
+	_init_capture(og_ctx, og_cfg->capture);
 	_init_window(og_ctx, og_cfg);
 	_init_vulkan(og_ctx, og_cfg);
-	_create_surface(og_ctx);
+	if (!og_ctx->headless) {
+		_create_surface(og_ctx);
+	}
 
 	_choose_physical_device(og_ctx);
 	_create_logical_device(og_ctx);
+	_create_allocator(og_ctx);
 
-	_create_swapchain(og_ctx);
+	if (og_ctx->headless) {
+		_create_offscreen_targets(og_ctx);
+	} else {
+		_create_swapchain(og_ctx);
+	}
 	_create_render_pass(og_ctx);
-	_create_framebuffer(og_ctx);
 
+	_create_pipeline_cache(og_ctx, og_cfg->pipeline_cache_path);
 	_create_pipeline(og_ctx);
 
 	_create_command_pool(og_ctx);
 	_create_sync_objects(og_ctx);
+	_create_graph(og_ctx);
+	_create_job_system(og_ctx, og_cfg->job_threads);
+	_create_uploader(og_ctx, og_cfg->upload_ring_size ? og_cfg->upload_ring_size : OG_DEFAULT_UPLOAD_RING_SIZE);
+	_create_frame_arenas(og_ctx, og_cfg->frame_arena_size ? og_cfg->frame_arena_size : OG_DEFAULT_FRAME_ARENA_SIZE,
+			og_cfg->frame_ring_size ? og_cfg->frame_ring_size : OG_DEFAULT_FRAME_RING_SIZE);
+	OG_PROFILE_HOOK(_create_profiler(og_ctx));
+	if (og_ctx->readback) {
+		_create_readback_buffers(og_ctx);
+	}
+
+	_create_sprite_batch(og_ctx, og_cfg->max_sprites ? og_cfg->max_sprites : OG_DEFAULT_MAX_SPRITES);
+	_create_shape_batch(og_ctx, og_cfg->max_shape_vertices ? og_cfg->max_shape_vertices : OG_DEFAULT_MAX_SHAPE_VERTICES);
+	_create_particle_system(og_ctx, og_cfg->max_particles ? og_cfg->max_particles : OG_DEFAULT_MAX_PARTICLES,
+			og_cfg->async_compute);
+	_create_tile_renderer(og_ctx);
+	_create_text_system(og_ctx);
+	_create_streamer(og_ctx, og_cfg->stream_budget ? og_cfg->stream_budget : OG_DEFAULT_STREAM_BUDGET);
 
 	og_ctx->running = true;
 }
 
+// Called From Inside The Scene Pass, So The Attachment Is Cleared Rather Than
+// The Image, Which Works For Swapchain, Offscreen And Graph Targets
 OG_API void og_clear_screen(OGContext *og_ctx, OGColor color) {
-	VkImageSubresourceRange range = {};
-	range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-	range.layerCount = 1;
-	range.levelCount = 1;
+	VkClearAttachment clear_attachment = {};
+	clear_attachment.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	clear_attachment.colorAttachment = 0;
+	clear_attachment.clearValue.color = color;
+
+	VkClearRect clear_rect = {};
+	clear_rect.rect = og_ctx->curr_scissor;
+	clear_rect.layerCount = 1;
 
-	vkCmdClearColorImage(og_ctx->curr_cmd_buffer, og_ctx->sc_images[og_ctx->img_idx],
-			VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, &color, 1, &range);
+	vkCmdClearAttachments(og_ctx->curr_cmd_buffer, 1, &clear_attachment, 1, &clear_rect);
 }
 
 
 OG_API void og_render(OGContext *og_ctx, void (*render)(OGContext*)) {
-	OG_CHECK_VK(vkAcquireNextImageKHR(og_ctx->logical_device, og_ctx->swapchain,
-				0, og_ctx->acquire_img_semaphore, 0, &og_ctx->img_idx), "Image Acquisition Failed");
+	// A Minimized Window Has No Extent To Build A Swapchain For, So No Frame Either
+	if (og_ctx->swapchain_dirty && !_recreate_swapchain(og_ctx)) {
+		return;
+	}
 
-	__alloc_cmd_buffer(og_ctx);
+	OGFrame *frame = &og_ctx->frames[og_ctx->frame_idx];
+	OG_PROFILE_HOOK(_profile_frame_begin(og_ctx));
+
+	// Everything Queued Since The Last Frame Goes Out As One Transfer Submission,
+	// Along With Whatever Streamed Textures Fit This Frame's Budget
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Uploads");
+	_pump_streamer(og_ctx);
+	og_upload_flush(og_ctx);
+	__retire_uploads(og_ctx);
+	OG_PROFILE_CPU_END(og_ctx);
+
+	// With on_demand, A Frame Nothing Invalidated Never Reaches The GPU
+	if (!_damage_frame_needed(og_ctx)) {
+		OG_PROFILE_HOOK(_profile_frame_end(og_ctx));
+		return;
+	}
 
+	// Only Block Until The GPU Has Retired This Slot, Earlier Frames Keep Running
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Wait");
+	OG_CHECK_VK(vkWaitForFences(og_ctx->logical_device, 1, &frame->in_flight_fence,
+				VK_TRUE, UINT64_MAX), "Frame Fence Wait Failed");
+	OG_PROFILE_CPU_END(og_ctx);
+	OG_PROFILE_HOOK(_profile_collect(og_ctx));
+	_retire_captures(og_ctx);
+	_jobs_frame_begin(og_ctx);
+	_begin_frame_arenas(og_ctx);
+
+	// Headless Targets Are Owned One Per Frame Slot, So Nothing To Acquire
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Acquire");
+	VkResult acquire_result = VK_SUCCESS;
+	if (og_ctx->headless) {
+		og_ctx->img_idx = og_ctx->frame_idx;
+	} else {
+		acquire_result = vkAcquireNextImageKHR(og_ctx->logical_device, og_ctx->swapchain,
+				UINT64_MAX, frame->acquire_img_semaphore, 0, &og_ctx->img_idx);
+	}
+	OG_PROFILE_CPU_END(og_ctx);
+
+	// Nothing Was Acquired And The Fence Is Still Signaled, Skip The Frame And Rebuild.
+	// A Suboptimal Image Is Still Usable, It Gets Presented And Rebuilt Afterwards.
+	// Any Other Failure Leaves img_idx Undefined, So The Frame Is Dropped Too
+	if (acquire_result == VK_SUBOPTIMAL_KHR) {
+		og_ctx->swapchain_dirty = true;
+	} else if (acquire_result != VK_SUCCESS) {
+		if (acquire_result == VK_ERROR_OUT_OF_DATE_KHR) {
+			og_ctx->swapchain_dirty = true;
+		} else {
+			OG_LOG_ERR("Image Acquisition Failed, Frame Skipped");
+		}
+		OG_PROFILE_HOOK(_profile_frame_end(og_ctx));
+		return;
+	}
+	_prepare_damage(og_ctx);
+
+	OG_CHECK_VK(vkResetFences(og_ctx->logical_device, 1, &frame->in_flight_fence), "Frame Fence Reset Failed");
+	OG_CHECK_VK(vkResetCommandPool(og_ctx->logical_device, frame->command_pool, 0), "Command Pool Reset Failed");
+	og_ctx->curr_cmd_buffer = frame->cmd_buffer;
+
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Record");
 	VkCommandBufferBeginInfo cb_begin_info = {};
 	cb_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 	cb_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 	
 	OG_CHECK_VK(vkBeginCommandBuffer(og_ctx->curr_cmd_buffer, &cb_begin_info), "Command Buffer Begin Failed");
+	OG_PROFILE_HOOK(_profile_record_begin(og_ctx));
+
+	// Glyphs Rasterized Last Frame Land In The Atlas Before Anything Samples It
+	_flush_glyphs(og_ctx);
+
+	// Compute Can't Run Inside A Render Pass, So Particles Are Simulated Up Front
+	_simulate_particles(og_ctx);
+
+	// Every Pass, Barrier And Layout Transition Comes From The Graph, Which Also
+	// Leaves Headless And Captured Targets In TRANSFER_SRC For The Copies Below
+	_execute_graph(og_ctx, render);
+
+	// Copy Headless Targets Out Here And Pick The Pixels Up Once This Slot's Fence Has Signaled
+	frame->readback_pending = og_ctx->readback;
+	frame->frame_number = og_ctx->frame_number;
+	if (og_ctx->readback) {
+		VkBufferImageCopy copy_region = {};
+		copy_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copy_region.imageSubresource.layerCount = 1;
+		copy_region.imageExtent.width = og_ctx->win->size.width;
+		copy_region.imageExtent.height = og_ctx->win->size.height;
+		copy_region.imageExtent.depth = 1;
+
+		vkCmdCopyImageToBuffer(og_ctx->curr_cmd_buffer, og_ctx->sc_images[og_ctx->img_idx],
+				VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, frame->readback.buffer, 1, &copy_region);
+
+		VkMemoryBarrier host_barrier = {};
+		host_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+		vkCmdPipelineBarrier(og_ctx->curr_cmd_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &host_barrier, 0, NULL, 0, NULL);
+	}
+	_record_capture(og_ctx);
 
-	VkExtent2D win_extent = {};
-	win_extent.width = og_ctx->win->size.width;
-	win_extent.height = og_ctx->win->size.height;
+	OG_PROFILE_HOOK(_profile_record_end(og_ctx));
+	OG_CHECK_VK(vkEndCommandBuffer(og_ctx->curr_cmd_buffer), "Command Buffer End Failed");
+	OG_PROFILE_CPU_END(og_ctx);
+
+	VkSemaphore wait_semaphores[3] = {};
+	VkPipelineStageFlags wdst_stage_masks[3] = {};
+	uint64_t wait_values[3] = {};
+	uint32_t wait_count = 0;
+	VkSemaphore signal_semaphores[2] = {};
+	uint64_t signal_values[2] = {};
+	uint32_t signal_count = 0;
+
+	if (!og_ctx->headless) {
+		wait_semaphores[wait_count] = frame->acquire_img_semaphore;
+		wdst_stage_masks[wait_count] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		wait_count++;
+	}
 
-	VkClearColorValue color_value = {{1, 1, 1, 1}};
-	VkClearValue clear_value = {};
-	clear_value.color = color_value;
+	// Only Waits On Uploads The Host Already Saw Finish, So This Never Delays The
+	// Frame, It Just Makes Their Writes Visible To The Graphics Queue
+	if (og_ctx->upload.completed) {
+		wait_semaphores[wait_count] = og_ctx->upload.timeline;
+		wdst_stage_masks[wait_count] = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		wait_values[wait_count] = og_ctx->upload.completed;
+		wait_count++;
+	}
 
-	VkRenderPassBeginInfo rp_begin_info = {};
-	rp_begin_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-	rp_begin_info.renderPass = og_ctx->render_pass;
-	rp_begin_info.renderArea.extent = win_extent;
-	rp_begin_info.framebuffer = og_ctx->framebuffers[og_ctx->img_idx];
-	rp_begin_info.pClearValues = &clear_value;
-	rp_begin_info.clearValueCount = 1;
+	if (!og_ctx->headless) {
+		signal_semaphores[signal_count++] = og_ctx->sc_submit_semaphores[og_ctx->img_idx];
+	}
 
-	vkCmdBeginRenderPass(og_ctx->curr_cmd_buffer, &rp_begin_info, VK_SUBPASS_CONTENTS_INLINE);
-	{
-		render(og_ctx);
+	// Particles Simulated On The Compute Queue Land Before Their Draw, And The
+	// Next Simulation Waits For This Frame To Be Done With Them
+	OGParticleSystem *particles = &og_ctx->particles;
+	if (particles->sim_value) {
+		wait_semaphores[wait_count] = particles->timeline;
+		wdst_stage_masks[wait_count] = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+		wait_values[wait_count] = particles->sim_value;
+		wait_count++;
+
+		signal_semaphores[signal_count] = particles->timeline;
+		signal_values[signal_count] = particles->frame_value;
+		signal_count++;
+		particles->sim_value = 0;
 	}
-	OG_CHECK_VK(vkCmdEndRenderPass(og_ctx->curr_cmd_buffer), "Render Pass End Failed");
-	OG_CHECK_VK(vkEndCommandBuffer(og_ctx->curr_cmd_buffer), "Command Buffer End Failed");
 
-	VkPipelineStageFlags wdst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	VkTimelineSemaphoreSubmitInfo timeline_info = {};
+	timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timeline_info.waitSemaphoreValueCount = wait_count;
+	timeline_info.pWaitSemaphoreValues = wait_values;
+	timeline_info.signalSemaphoreValueCount = signal_count;
+	timeline_info.pSignalSemaphoreValues = signal_values;
 
 	VkSubmitInfo submit_info = {};
 	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = &timeline_info;
 	submit_info.commandBufferCount = 1;
 	submit_info.pCommandBuffers = &og_ctx->curr_cmd_buffer;
-	submit_info.pSignalSemaphores = &og_ctx->submit_semaphore;
-	submit_info.signalSemaphoreCount = 1;
-	submit_info.pWaitSemaphores = &og_ctx->acquire_img_semaphore;
-	submit_info.waitSemaphoreCount = 1;
-	submit_info.pWaitDstStageMask = &wdst_stage_mask;
-
-	OG_CHECK_VK(vkQueueSubmit(og_ctx->graphics_queue, 1, &submit_info, 0), "Queue Submit Failed");
-
+	submit_info.pWaitSemaphores = wait_semaphores;
+	submit_info.waitSemaphoreCount = wait_count;
+	submit_info.pWaitDstStageMask = wdst_stage_masks;
+	submit_info.pSignalSemaphores = signal_semaphores;
+	submit_info.signalSemaphoreCount = signal_count;
+
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Submit");
+	OG_CHECK_VK(vkQueueSubmit(og_ctx->graphics_queue, 1, &submit_info,
+				frame->in_flight_fence), "Queue Submit Failed");
+	OG_PROFILE_CPU_END(og_ctx);
+	_end_frame_arenas(og_ctx);
+
+	og_ctx->frame_number++;
+	if (og_ctx->headless) {
+		og_ctx->frame_idx = (og_ctx->frame_idx + 1) % og_ctx->frame_count;
+		OG_PROFILE_HOOK(_profile_frame_end(og_ctx));
+		return;
+	}
 
 	VkPresentInfoKHR present_info = {};
 	present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	present_info.pSwapchains = &og_ctx->swapchain;
 	present_info.swapchainCount = 1;
 	present_info.pImageIndices = &og_ctx->img_idx;
-	present_info.pWaitSemaphores = &og_ctx->submit_semaphore;
+	present_info.pWaitSemaphores = &og_ctx->sc_submit_semaphores[og_ctx->img_idx];
 	present_info.waitSemaphoreCount = 1;
 
-	OG_CHECK_VK(vkQueuePresentKHR(og_ctx->graphics_queue, &present_info), "Queue Present Failed");
+	// Tells The Compositor Which Parts Changed, Where The Device Supports It
+	VkPresentRegionsKHR present_regions = {};
+	VkPresentRegionKHR present_region = {};
+	VkRectLayerKHR present_rects[OG_MAX_DAMAGE_RECTS];
+	if (_present_regions(og_ctx, &present_regions, &present_region, present_rects)) {
+		present_info.pNext = &present_regions;
+	}
+
+	OG_PROFILE_CPU_BEGIN(og_ctx, "Present");
+	VkResult present_result = vkQueuePresentKHR(og_ctx->graphics_queue, &present_info);
+	OG_PROFILE_CPU_END(og_ctx);
+
+	// The Frame Was Still Submitted, So Its Slot Moves On Either Way. Anything
+	// Else That Went Wrong Also Gets The Swapchain Rebuilt Before The Next One
+	if (present_result != VK_SUCCESS) {
+		if (present_result != VK_ERROR_OUT_OF_DATE_KHR && present_result != VK_SUBOPTIMAL_KHR) {
+			OG_LOG_ERR("Queue Present Failed");
+		}
+		og_ctx->swapchain_dirty = true;
+	}
+
+	og_ctx->frame_idx = (og_ctx->frame_idx + 1) % og_ctx->frame_count;
+	OG_PROFILE_HOOK(_profile_frame_end(og_ctx));
+}
+
+// Hands Out The Oldest Frame Still In Flight Once The GPU Is Done With It.
+// Without wait This Never Stalls, Frames Simply Arrive frame_count - 1 Late
+OG_API bool og_read_frame(OGContext *og_ctx, OGFrameData *out, bool wait) {
+	OGFrame *frame = NULL;
+
+	// Slots Are Reused In Order, So Starting At The Next One Walks Oldest First
+	for (uint32_t i = 0; i < og_ctx->frame_count && !frame; i++) {
+		OGFrame *slot = &og_ctx->frames[(og_ctx->frame_idx + i) % og_ctx->frame_count];
+		if (slot->readback_pending) {
+			frame = slot;
+		}
+	}
+
+	if (!frame) {
+		return false;
+	}
+
+	if (wait) {
+		OG_CHECK_VK(vkWaitForFences(og_ctx->logical_device, 1, &frame->in_flight_fence,
+					VK_TRUE, UINT64_MAX), "Frame Fence Wait Failed");
+	} else if (vkGetFenceStatus(og_ctx->logical_device, frame->in_flight_fence) != VK_SUCCESS) {
+		return false;
+	}
 
-	OG_CHECK_VK(vkDeviceWaitIdle(og_ctx->logical_device));
-	vkFreeCommandBuffers(og_ctx->logical_device, og_ctx->command_pool, 1, &og_ctx->curr_cmd_buffer);
+	frame->readback_pending = false;
+
+	out->pixels = frame->readback.alloc.mapped;
+	out->width = og_ctx->win->size.width;
+	out->height = og_ctx->win->size.height;
+	out->stride = og_ctx->win->size.width * 4;
+	out->format = og_ctx->surf_format.format;
+	out->frame = frame->frame_number;
+	return true;
+}
+
+
+// Headless Targets Are Rebuilt Right Away. A Window Is Resized And Its Swapchain
+// Rebuilt At The Start Of The Next Frame, Like Any Other Resize
+OG_API void og_resize(OGContext *og_ctx, uint32_t width, uint32_t height) {
+	if (!width || !height) {
+		return;
+	}
+
+	if (!og_ctx->headless) {
+		glfwSetWindowSize(og_ctx->win->screen, (int)width, (int)height);
+		og_ctx->swapchain_dirty = true;
+		return;
+	}
+
+	if (width == og_ctx->win->size.width && height == og_ctx->win->size.height) {
+		return;
+	}
+
+	_wait_frames(og_ctx);
+	_destroy_targets(og_ctx);
+
+	og_ctx->win->size.width = width;
+	og_ctx->win->size.height = height;
+	_create_offscreen_targets(og_ctx);
+
+	// Pending Readbacks Were Sized For The Old Targets, They Are Dropped
+	if (og_ctx->readback) {
+		for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+			og_destroy_buffer(og_ctx, &og_ctx->frames[i].readback);
+			og_ctx->frames[i].readback_pending = false;
+		}
+		_create_readback_buffers(og_ctx);
+	}
 }
 
 
 OG_API void og_poll_events(OGContext *og_ctx) {
-	glfwPollEvents();
+	_pace_frame(og_ctx);
+
+	if (og_ctx->headless) {
+		return;
+	}
+
+	// Nothing To Draw, Sleep Until Input Arrives Rather Than Spin
+	if (_damage_idle(og_ctx)) {
+		glfwWaitEventsTimeout(OG_IDLE_WAIT);
+	} else {
+		glfwPollEvents();
+	}
 	_handle_default_events(og_ctx);
 }
 
 OG_API void og_quit(OGContext *og_ctx) {
-	vkDestroyCommandPool(og_ctx->logical_device, og_ctx->command_pool, NULL);
-	vkDestroySemaphore(og_ctx->logical_device, og_ctx->acquire_img_semaphore, NULL);
-	vkDestroySemaphore(og_ctx->logical_device, og_ctx->submit_semaphore, NULL);
-
-	for (size_t i = 0; i < 5; i++) {
-		vkDestroyFramebuffer(og_ctx->logical_device, og_ctx->framebuffers[i], NULL);
+	OG_CHECK_VK(vkDeviceWaitIdle(og_ctx->logical_device), "Device Wait Idle Failed");
+
+	_destroy_capture(og_ctx);
+	_destroy_job_system(og_ctx);
+	_destroy_streamer(og_ctx);
+	_destroy_text_system(og_ctx);
+	_destroy_sprite_batch(og_ctx);
+	_destroy_shape_batch(og_ctx);
+	_destroy_particle_system(og_ctx);
+	_destroy_tile_renderer(og_ctx);
+	_destroy_uploader(og_ctx);
+	_destroy_frame_arenas(og_ctx);
+	OG_PROFILE_HOOK(_destroy_profiler(og_ctx));
+
+	_save_pipeline_cache(og_ctx);
+	_destroy_pipeline_cache(og_ctx);
+	vkDestroyCommandPool(og_ctx->logical_device, og_ctx->one_shot_pool, NULL);
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		OGFrame *frame = &og_ctx->frames[i];
+
+		vkDestroyCommandPool(og_ctx->logical_device, frame->command_pool, NULL);
+		vkDestroyFence(og_ctx->logical_device, frame->in_flight_fence, NULL);
+		vkDestroySemaphore(og_ctx->logical_device, frame->acquire_img_semaphore, NULL);
+
+		og_destroy_buffer(og_ctx, &frame->readback);
 	}
 
+	_destroy_targets(og_ctx);
+	_destroy_graph(og_ctx);
 	vkDestroyRenderPass(og_ctx->logical_device, og_ctx->render_pass, NULL);
 
-	for (size_t i = 0; i < 5; i++) {
-		vkDestroyImageView(og_ctx->logical_device, og_ctx->sc_img_views[i], NULL);
+	if (!og_ctx->headless) {
+		vkDestroySwapchainKHR(og_ctx->logical_device, og_ctx->swapchain, NULL);
 	}
-
-	vkDestroySwapchainKHR(og_ctx->logical_device, og_ctx->swapchain, NULL);
+	_destroy_allocator(og_ctx);
 	vkDestroyDevice(og_ctx->logical_device, NULL);
-	vkDestroySurfaceKHR(og_ctx->instance, og_ctx->surface, NULL);
+	if (!og_ctx->headless) {
+		vkDestroySurfaceKHR(og_ctx->instance, og_ctx->surface, NULL);
+	}
 	vkDestroyInstance(og_ctx->instance, NULL);
 
-	glfwDestroyWindow(og_ctx->win->screen);
-	glfwTerminate();
+	if (!og_ctx->headless) {
+		glfwDestroyWindow(og_ctx->win->screen);
+		glfwTerminate();
+	}
+	free(og_ctx->win);
+	og_ctx->win = NULL;
 }
 
 OG_INT void _init_window(OGContext *og_ctx, OGConfig *og_cfg) {
+	og_ctx->win = malloc(sizeof(Win));
+
+	VkExtent2D size = {og_cfg->win_width, og_cfg->win_height};
+	og_ctx->win->size = size;
+	og_ctx->win->screen = NULL;
+
+	// Headless Contexts Only Need The Size For Their Offscreen Targets
+	if (og_ctx->headless) {
+		return;
+	}
+
 	if (glfwInit() != GLFW_TRUE) {
 		OG_LOG_ERR("GLFW Initialization Failed");
 	}
 
 	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-	glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
-
-	og_ctx->win = malloc(sizeof(Win));
+	glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
-	VkExtent2D size = {og_cfg->win_width, og_cfg->win_height};
-	og_ctx->win->size = size;
 	og_ctx->win->screen = glfwCreateWindow(og_cfg->win_width,
 			og_cfg->win_height, og_cfg->app_name, NULL, NULL);
 
 	if (!og_ctx->win->screen) {
 		OG_LOG_ERR("GLFW Window Creation Failed");
+		return;
 	}
+
+	glfwSetWindowUserPointer(og_ctx->win->screen, og_ctx);
+	glfwSetFramebufferSizeCallback(og_ctx->win->screen, __framebuffer_size_callback);
+	glfwSetWindowRefreshCallback(og_ctx->win->screen, __window_refresh_callback);
 }
 
 OG_INT void _init_vulkan(OGContext *og_ctx, OGConfig *og_cfg) {
@@ -186,7 +588,10 @@ OG_INT void _init_vulkan(OGContext *og_ctx, OGConfig *og_cfg) {
 	};
 
 	uint32_t glfw_ext_c = 0;
-	const char** glfw_ext = glfwGetRequiredInstanceExtensions(&glfw_ext_c);
+	const char** glfw_ext = NULL;
+	if (!og_ctx->headless) {
+		glfw_ext = glfwGetRequiredInstanceExtensions(&glfw_ext_c);
+	}
 
 	VkInstanceCreateInfo instance_info = {};
 	instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -229,6 +634,7 @@ OG_INT void _handle_default_events(OGContext *og_ctx) {
 }
 OG_INT void _choose_physical_device(OGContext *og_ctx) {
 	og_ctx->graphics_idx = -1;
+	og_ctx->physical_device = VK_NULL_HANDLE;
 
 	uint32_t pd_count = 0;
 	vkEnumeratePhysicalDevices(og_ctx->instance, &pd_count, NULL);
@@ -247,9 +653,12 @@ OG_INT void _choose_physical_device(OGContext *og_ctx) {
 
 		for (uint32_t j = 0; j < queue_family_count; j++) {
 			if (queue_properties[j].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
-				VkBool32 surface_support = VK_FALSE;
-				OG_CHECK_VK(vkGetPhysicalDeviceSurfaceSupportKHR(p_device, j,
-							og_ctx->surface, &surface_support), "Physical Device Surface Support Not Available");
+				// Headless Contexts Have No Surface To Present To
+				VkBool32 surface_support = og_ctx->headless;
+				if (!og_ctx->headless) {
+					OG_CHECK_VK(vkGetPhysicalDeviceSurfaceSupportKHR(p_device, j,
+								og_ctx->surface, &surface_support), "Physical Device Surface Support Not Available");
+				}
 
 				if (surface_support) {
 					og_ctx->graphics_idx = j;
@@ -259,34 +668,125 @@ OG_INT void _choose_physical_device(OGContext *og_ctx) {
 			}
 		}
 	}
-	if (og_ctx->graphics_idx < 0) {
+	// graphics_idx Is Unsigned, So Whether A Device Was Picked Is What Tells
+	if (og_ctx->physical_device == VK_NULL_HANDLE) {
 		OG_LOG_ERR("Failed To Find Graphics Queue Family Support");
 	}
+
+	// A Transfer Only Family Maps To The Copy Engines And Runs Beside Graphics,
+	// Without One Uploads Share The Graphics Queue
+	og_ctx->transfer_idx = og_ctx->graphics_idx;
+
+	uint32_t queue_family_count = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(og_ctx->physical_device, &queue_family_count, NULL);
+
+	VkQueueFamilyProperties queue_properties[queue_family_count];
+	vkGetPhysicalDeviceQueueFamilyProperties(og_ctx->physical_device, &queue_family_count, queue_properties);
+
+	for (uint32_t j = 0; j < queue_family_count; j++) {
+		VkQueueFlags flags = queue_properties[j].queueFlags;
+		if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+			og_ctx->transfer_idx = j;
+			break;
+		}
+	}
+
+	// Likewise A Compute Only Family Runs Beside Graphics, Only Asked For With async_compute
+	og_ctx->compute_idx = og_ctx->graphics_idx;
+	for (uint32_t j = 0; j < queue_family_count && og_ctx->async_compute; j++) {
+		VkQueueFlags flags = queue_properties[j].queueFlags;
+		if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT)) {
+			og_ctx->compute_idx = j;
+			break;
+		}
+	}
 }
 
 OG_INT void _create_logical_device(OGContext *og_ctx) {
-	const char* extensions[1] = {
+	const char* extensions[2] = {
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME
 	};
+	uint32_t extension_count = og_ctx->headless ? 0 : 1;
+
+	// Partial Presents Only Help A Window That Skips And Trims Frames
+	if (og_ctx->damage.enabled && !og_ctx->headless) {
+		uint32_t available_count = 0;
+		vkEnumerateDeviceExtensionProperties(og_ctx->physical_device, NULL, &available_count, NULL);
+		VkExtensionProperties* available = malloc(available_count * sizeof(VkExtensionProperties));
+		vkEnumerateDeviceExtensionProperties(og_ctx->physical_device, NULL, &available_count, available);
+
+		for (uint32_t i = 0; i < available_count; i++) {
+			if (!strcmp(available[i].extensionName, VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)) {
+				extensions[extension_count++] = VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME;
+				og_ctx->damage.incremental = true;
+				break;
+			}
+		}
+		free(available);
+	}
 
 	float priority = 1.0f;
-	VkDeviceQueueCreateInfo queue_info = {};
-	queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-	queue_info.pQueuePriorities = &priority;
-	queue_info.queueCount = 1;
-	queue_info.queueFamilyIndex = og_ctx->graphics_idx;
+	VkDeviceQueueCreateInfo queue_infos[3] = {};
+	queue_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	queue_infos[0].pQueuePriorities = &priority;
+	queue_infos[0].queueCount = 1;
+	queue_infos[0].queueFamilyIndex = og_ctx->graphics_idx;
+	uint32_t queue_info_count = 1;
+
+	// Transfer Only And Compute Only Families Never Coincide
+	if (og_ctx->transfer_idx != og_ctx->graphics_idx) {
+		queue_infos[queue_info_count] = queue_infos[0];
+		queue_infos[queue_info_count++].queueFamilyIndex = og_ctx->transfer_idx;
+	}
+	if (og_ctx->compute_idx != og_ctx->graphics_idx) {
+		queue_infos[queue_info_count] = queue_infos[0];
+		queue_infos[queue_info_count++].queueFamilyIndex = og_ctx->compute_idx;
+	}
+
+	// Core In 1.2, Upload Completion Is Tracked On A Timeline
+	VkPhysicalDeviceVulkan12Features features_12 = {};
+	features_12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+	features_12.timelineSemaphore = VK_TRUE;
+
+	// Every Texture In One Array, Indexed Per Instance And Written While Frames Are In
+	// Flight. Devices With descriptorIndexing Guarantee Far More Update After Bind
+	// Samplers Than OG_BINDLESS_TEXTURES, So Only The Features Are Checked
+	VkPhysicalDeviceVulkan12Features supported_12 = {};
+	supported_12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+	VkPhysicalDeviceFeatures2 supported = {};
+	supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	supported.pNext = &supported_12;
+	vkGetPhysicalDeviceFeatures2(og_ctx->physical_device, &supported);
+
+	og_ctx->descriptor_indexing = supported_12.descriptorIndexing &&
+		supported_12.shaderSampledImageArrayNonUniformIndexing &&
+		supported_12.descriptorBindingSampledImageUpdateAfterBind &&
+		supported_12.descriptorBindingUpdateUnusedWhilePending &&
+		supported_12.descriptorBindingPartiallyBound;
+	if (og_ctx->descriptor_indexing) {
+		features_12.descriptorIndexing = VK_TRUE;
+		features_12.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+		features_12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+		features_12.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+		features_12.descriptorBindingPartiallyBound = VK_TRUE;
+	} else {
+		OG_LOG_INFO("No Descriptor Indexing, Textures Fall Back To One Set Each");
+	}
 
 	VkDeviceCreateInfo device_info = {};
 	device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-	device_info.queueCreateInfoCount = 1;
-	device_info.pQueueCreateInfos = &queue_info;
-	device_info.enabledExtensionCount = OG_ARR_SIZE(extensions);
+	device_info.pNext = &features_12;
+	device_info.queueCreateInfoCount = queue_info_count;
+	device_info.pQueueCreateInfos = queue_infos;
+	device_info.enabledExtensionCount = extension_count;
 	device_info.ppEnabledExtensionNames = extensions;
 
 	OG_CHECK_VK(vkCreateDevice(og_ctx->physical_device, &device_info, NULL,
 				&og_ctx->logical_device), "Logical Device Creation Failed");
 
 	vkGetDeviceQueue(og_ctx->logical_device, og_ctx->graphics_idx, 0, &og_ctx->graphics_queue);
+	vkGetDeviceQueue(og_ctx->logical_device, og_ctx->transfer_idx, 0, &og_ctx->transfer_queue);
+	vkGetDeviceQueue(og_ctx->logical_device, og_ctx->compute_idx, 0, &og_ctx->compute_queue);
 }
 
 OG_INT void _create_swapchain(OGContext *og_ctx) {
@@ -309,50 +809,63 @@ OG_INT void _create_swapchain(OGContext *og_ctx) {
 			break; }
 	}
 
-	VkPresentModeKHR present_mode = 0;
-
-	uint32_t present_mode_count = 0;
-	vkGetPhysicalDeviceSurfacePresentModesKHR(og_ctx->physical_device, og_ctx->surface, &present_mode_count, 0);
-	VkPresentModeKHR present_modes[present_mode_count];
-
-	OG_CHECK_VK(vkGetPhysicalDeviceSurfacePresentModesKHR(og_ctx->physical_device,
-				og_ctx->surface, &present_mode_count, present_modes), "Surface Present Mode Get Failed");
+	// Surfaces Without A Fixed Extent Take The Window's Framebuffer Size
+	VkExtent2D extent = surf_caps.currentExtent;
+	if (extent.width == UINT32_MAX) {
+		int width = 0, height = 0;
+		glfwGetFramebufferSize(og_ctx->win->screen, &width, &height);
+
+		extent.width = (uint32_t)width;
+		extent.height = (uint32_t)height;
+		if (extent.width < surf_caps.minImageExtent.width) extent.width = surf_caps.minImageExtent.width;
+		if (extent.width > surf_caps.maxImageExtent.width) extent.width = surf_caps.maxImageExtent.width;
+		if (extent.height < surf_caps.minImageExtent.height) extent.height = surf_caps.minImageExtent.height;
+		if (extent.height > surf_caps.maxImageExtent.height) extent.height = surf_caps.maxImageExtent.height;
+	}
+	og_ctx->win->size = extent;
 
-	for (uint32_t i = 0; i < present_mode_count; i++) {
-		if (present_modes[i] == VK_PRESENT_MODE_MAILBOX_KHR) {
-			present_mode = present_modes[i];
-			break;
-		// Guaranteed To Be Present By Standard
-		} else if (present_modes[i] == VK_PRESENT_MODE_FIFO_KHR) {
-			present_mode = present_modes[i];
-		}
+	uint32_t image_count = og_ctx->swapchain_images ? og_ctx->swapchain_images : surf_caps.minImageCount + 1;
+	if (image_count < surf_caps.minImageCount) {
+		image_count = surf_caps.minImageCount;
+	}
+	if (surf_caps.maxImageCount && image_count > surf_caps.maxImageCount) {
+		image_count = surf_caps.maxImageCount;
 	}
 
 	VkSwapchainCreateInfoKHR sc_info = {};
 	sc_info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-	sc_info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+	// Graph Passes May Copy Or Blit Into The Backbuffer, Captures Copy Out Of It
+	sc_info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | (surf_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+	if (og_ctx->capture.enabled) {
+		sc_info.imageUsage |= surf_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+		og_ctx->capture.supported = (surf_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) != 0;
+	}
 	sc_info.surface = og_ctx->surface;
 	sc_info.preTransform = surf_caps.currentTransform;
-	sc_info.imageExtent = surf_caps.currentExtent;
-	sc_info.minImageCount = surf_caps.minImageCount + 1;
+	sc_info.imageExtent = extent;
+	sc_info.minImageCount = image_count;
 	sc_info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 	sc_info.imageArrayLayers = 1;
 	sc_info.imageFormat = og_ctx->surf_format.format;
 	sc_info.imageColorSpace = og_ctx->surf_format.colorSpace;
-	sc_info.presentMode = present_mode;
+	sc_info.presentMode = __pick_present_mode(og_ctx);
 	sc_info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
 	sc_info.queueFamilyIndexCount = 0;
 	sc_info.pQueueFamilyIndices = &og_ctx->graphics_idx;
 	sc_info.clipped = VK_TRUE;
-	sc_info.oldSwapchain = VK_NULL_HANDLE;
+	// Lets The Driver Hand Resources Over From The Swapchain Being Replaced
+	sc_info.oldSwapchain = og_ctx->swapchain;
 
 	OG_CHECK_VK(vkCreateSwapchainKHR(og_ctx->logical_device, &sc_info,
 				NULL, &og_ctx->swapchain), "SwapChain Creation Failed");
 
-	uint32_t sc_img_count = 0;
-	vkGetSwapchainImagesKHR(og_ctx->logical_device, og_ctx->swapchain, &sc_img_count, 0);
+	// The Driver May Create More Images Than Asked For
+	vkGetSwapchainImagesKHR(og_ctx->logical_device, og_ctx->swapchain, &og_ctx->sc_img_count, 0);
+	og_ctx->sc_images = malloc(og_ctx->sc_img_count * sizeof(VkImage));
+	og_ctx->sc_img_views = malloc(og_ctx->sc_img_count * sizeof(VkImageView));
+	og_ctx->sc_submit_semaphores = malloc(og_ctx->sc_img_count * sizeof(VkSemaphore));
 
-	vkGetSwapchainImagesKHR(og_ctx->logical_device, og_ctx->swapchain, &sc_img_count, og_ctx->sc_images);
+	vkGetSwapchainImagesKHR(og_ctx->logical_device, og_ctx->swapchain, &og_ctx->sc_img_count, og_ctx->sc_images);
 
 	VkImageViewCreateInfo iv_create_info = {};
 	iv_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -362,53 +875,239 @@ OG_INT void _create_swapchain(OGContext *og_ctx) {
 	iv_create_info.subresourceRange.layerCount = 1;
 	iv_create_info.subresourceRange.levelCount = 1;
 
-	for (uint32_t i = 0; i < OG_ARR_SIZE(og_ctx->sc_img_views); i++) {
+	// Present Waits On The Image's Semaphore Rather Than The Frame Slot's, With More
+	// Images Than Slots A Slot Comes Round Again Before Its Last Present Is Done
+	VkSemaphoreCreateInfo sem_create_info = {};
+	sem_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+	for (uint32_t i = 0; i < og_ctx->sc_img_count; i++) {
 		iv_create_info.image = og_ctx->sc_images[i];
 		OG_CHECK_VK(vkCreateImageView(og_ctx->logical_device, &iv_create_info,
 					NULL, &og_ctx->sc_img_views[i]), "Image View Creation Failed");
+		OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
+					NULL, &og_ctx->sc_submit_semaphores[i]), "Submit Semaphore Creation Failed");
 	}
 }
 
+// Only Waits On The Frames Still In Flight, Uploads And Everything Else Keep Running
+OG_INT bool _recreate_swapchain(OGContext *og_ctx) {
+	int width = 0, height = 0;
+	glfwGetFramebufferSize(og_ctx->win->screen, &width, &height);
+	if (!width || !height) {
+		return false;
+	}
+
+	_wait_frames(og_ctx);
+	_destroy_targets(og_ctx);
+
+	VkSwapchainKHR old_swapchain = og_ctx->swapchain;
+	_create_swapchain(og_ctx);
+	vkDestroySwapchainKHR(og_ctx->logical_device, old_swapchain, NULL);
+
+	og_ctx->swapchain_dirty = false;
+	return true;
+}
+
+// Everything Sized By The Window, Swapchain Or Offscreen, But Not The Swapchain Itself.
+// The Graph's Images And Framebuffers Are Rebuilt Lazily By The Next Frame
+OG_INT void _destroy_targets(OGContext *og_ctx) {
+	_invalidate_graph(og_ctx);
+	_reset_damage(og_ctx);
+
+	for (uint32_t i = 0; i < og_ctx->sc_img_count; i++) {
+		vkDestroyImageView(og_ctx->logical_device, og_ctx->sc_img_views[i], NULL);
+
+		if (og_ctx->headless) {
+			og_destroy_image(og_ctx, &og_ctx->offscreen[i]);
+		} else {
+			vkDestroySemaphore(og_ctx->logical_device, og_ctx->sc_submit_semaphores[i], NULL);
+		}
+	}
+
+	free(og_ctx->sc_img_views);
+	free(og_ctx->sc_images);
+	free(og_ctx->offscreen);
+	free(og_ctx->sc_submit_semaphores);
+	og_ctx->sc_img_views = NULL;
+	og_ctx->sc_images = NULL;
+	og_ctx->offscreen = NULL;
+	og_ctx->sc_submit_semaphores = NULL;
+	og_ctx->sc_img_count = 0;
+}
+
+OG_INT void _wait_frames(OGContext *og_ctx) {
+	VkFence fences[OG_MAX_FRAMES_IN_FLIGHT];
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		fences[i] = og_ctx->frames[i].in_flight_fence;
+	}
+
+	OG_CHECK_VK(vkWaitForFences(og_ctx->logical_device, og_ctx->frame_count, fences,
+				VK_TRUE, UINT64_MAX), "Frame Fence Wait Failed");
+}
+
+// Sleeps Before Events Are Polled Rather Than After Present, So A Capped
+// Frame Still Reads Input As Late As It Can
+OG_INT void _pace_frame(OGContext *og_ctx) {
+	if (!og_ctx->max_fps) {
+		return;
+	}
+
+	double period = 1.0 / og_ctx->max_fps;
+	double now = __now_seconds();
+
+	if (og_ctx->next_frame_time > now) {
+		double wait = og_ctx->next_frame_time - now;
+		struct timespec ts = {};
+		ts.tv_sec = (time_t)wait;
+		ts.tv_nsec = (long)((wait - (double)ts.tv_sec) * 1e9);
+		nanosleep(&ts, NULL);
+		now = og_ctx->next_frame_time;
+	}
+
+	// A Frame That Ran Long Restarts The Schedule Instead Of Bursting To Catch Up
+	if (now - og_ctx->next_frame_time > period) {
+		og_ctx->next_frame_time = now;
+	}
+	og_ctx->next_frame_time += period;
+}
+
+// Stands In For The Swapchain When Headless, One Target Per Frame Slot
+OG_INT void _create_offscreen_targets(OGContext *og_ctx) {
+	// Plain RGBA So Readbacks Can Be Compared Byte For Byte
+	og_ctx->surf_format.format = VK_FORMAT_R8G8B8A8_UNORM;
+	og_ctx->surf_format.colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+	og_ctx->sc_img_count = og_ctx->frame_count;
+	og_ctx->sc_images = malloc(og_ctx->sc_img_count * sizeof(VkImage));
+	og_ctx->sc_img_views = malloc(og_ctx->sc_img_count * sizeof(VkImageView));
+	og_ctx->offscreen = malloc(og_ctx->sc_img_count * sizeof(OGImage));
+
+	VkImageCreateInfo img_create_info = {};
+	img_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	img_create_info.imageType = VK_IMAGE_TYPE_2D;
+	img_create_info.format = og_ctx->surf_format.format;
+	img_create_info.extent.width = og_ctx->win->size.width;
+	img_create_info.extent.height = og_ctx->win->size.height;
+	img_create_info.extent.depth = 1;
+	img_create_info.mipLevels = 1;
+	img_create_info.arrayLayers = 1;
+	img_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+	img_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	img_create_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+	img_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	img_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	VkImageViewCreateInfo iv_create_info = {};
+	iv_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	iv_create_info.format = og_ctx->surf_format.format;
+	iv_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	iv_create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	iv_create_info.subresourceRange.layerCount = 1;
+	iv_create_info.subresourceRange.levelCount = 1;
+
+	for (uint32_t i = 0; i < og_ctx->sc_img_count; i++) {
+		if (!og_create_image(og_ctx, &img_create_info, OG_MEMORY_GPU_ONLY, &og_ctx->offscreen[i])) {
+			OG_LOG_ERR("Offscreen Image Creation Failed");
+		}
+		og_ctx->sc_images[i] = og_ctx->offscreen[i].image;
+
+		iv_create_info.image = og_ctx->sc_images[i];
+		OG_CHECK_VK(vkCreateImageView(og_ctx->logical_device, &iv_create_info,
+					NULL, &og_ctx->sc_img_views[i]), "Image View Creation Failed");
+	}
+}
+
+// Persistently Mapped, One Per Frame Slot So Readbacks Never Block Recording
+OG_INT void _create_readback_buffers(OGContext *og_ctx) {
+	VkDeviceSize size = (VkDeviceSize)og_ctx->win->size.width * og_ctx->win->size.height * 4;
+
+	// Cached Memory Makes The CPU Side Read Far Cheaper Where Available
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		if (!og_create_buffer(og_ctx, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+					OG_MEMORY_GPU_TO_CPU, &og_ctx->frames[i].readback)) {
+			OG_LOG_ERR("Readback Buffer Creation Failed");
+		}
+	}
+}
+
+// One Pool Per Frame Slot So The Whole Slot Can Be Reset Instead Of Freed
 OG_INT void _create_command_pool(OGContext *og_ctx) {
 	VkCommandPoolCreateInfo pool_create_info = {};
 	pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
 	pool_create_info.queueFamilyIndex = og_ctx->graphics_idx;
 
+	VkCommandBufferAllocateInfo cmd_alloc_info = {};
+	cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	cmd_alloc_info.commandBufferCount = 1;
+	cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		OGFrame *frame = &og_ctx->frames[i];
+
+		OG_CHECK_VK(vkCreateCommandPool(og_ctx->logical_device, &pool_create_info, NULL,
+					&frame->command_pool), "Command Pool Creation Failed");
+
+		cmd_alloc_info.commandPool = frame->command_pool;
+		OG_CHECK_VK(vkAllocateCommandBuffers(og_ctx->logical_device,
+					&cmd_alloc_info, &frame->cmd_buffer), "Command Buffer Allocation Failed");
+	}
+
 	OG_CHECK_VK(vkCreateCommandPool(og_ctx->logical_device, &pool_create_info, NULL,
-				&og_ctx->command_pool), "Command Pool Creation Failed");
+				&og_ctx->one_shot_pool), "Command Pool Creation Failed");
 }
 
 OG_INT void _create_sync_objects(OGContext *og_ctx) {
 	VkSemaphoreCreateInfo sem_create_info = {};
 	sem_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-	OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
-				NULL, &og_ctx->acquire_img_semaphore), "Acquire Image Semaphore Creation Failed");
-	OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
-				NULL, &og_ctx->submit_semaphore), "Submit Semaphore Creation Failed");
+	// Created Signaled So The First Wait On Each Slot Returns Immediately
+	VkFenceCreateInfo fence_create_info = {};
+	fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	fence_create_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		OGFrame *frame = &og_ctx->frames[i];
+
+		OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
+					NULL, &frame->acquire_img_semaphore), "Acquire Image Semaphore Creation Failed");
+		OG_CHECK_VK(vkCreateFence(og_ctx->logical_device, &fence_create_info,
+					NULL, &frame->in_flight_fence), "Frame Fence Creation Failed");
+	}
 }
 
-OG_INT void _create_framebuffer(OGContext *og_ctx) {
-	VkFramebufferCreateInfo fb_create_info = {};
-	fb_create_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-	fb_create_info.width = og_ctx->win->size.width;
-	fb_create_info.height = og_ctx->win->size.height;
-	fb_create_info.renderPass = og_ctx->render_pass;
-	fb_create_info.layers = 1;
-	fb_create_info.attachmentCount = 1;
+// Runs Inside The Scene Pass Of The Render Graph
+OG_INT void _record_scene(OGContext *og_ctx, void(*render)()) {
+	VkCommandBuffer primary = og_ctx->curr_cmd_buffer;
 
-	for (uint32_t i = 0; i < OG_ARR_SIZE(og_ctx->sc_images); i++) {
-		fb_create_info.pAttachments = &og_ctx->sc_img_views[i];
+	_jobs_pass_begin(og_ctx);
+	render(og_ctx);
 
-		vkCreateFramebuffer(og_ctx->logical_device, &fb_create_info, NULL, &og_ctx->framebuffers[i]);
-	}
+	OG_PROFILE_GPU_BEGIN(og_ctx, "Sprites");
+	_flush_sprites(og_ctx, false);
+	OG_PROFILE_GPU_END(og_ctx);
+
+	OG_PROFILE_GPU_BEGIN(og_ctx, "Particles");
+	_draw_particles(og_ctx);
+	OG_PROFILE_GPU_END(og_ctx);
+
+	OG_PROFILE_GPU_BEGIN(og_ctx, "Shapes");
+	_flush_shapes(og_ctx);
+	OG_PROFILE_GPU_END(og_ctx);
+
+	// Text And Anything Else On The Overlay Layers Goes On Top
+	OG_PROFILE_GPU_BEGIN(og_ctx, "Overlay");
+	_flush_sprites(og_ctx, true);
+	OG_PROFILE_GPU_END(og_ctx);
+	_jobs_pass_end(og_ctx, primary);
 }
 
+// Never Begun, Pipelines Are Created Against It And Only Need Its Format To
+// Match The Passes The Graph Builds, Which Is Why It Has No Dependencies Either
 OG_INT void _create_render_pass(OGContext *og_ctx) {
 	VkAttachmentDescription attachment = {};
-	attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-	attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-	attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+	attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+	attachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+	attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 	attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
 	attachment.samples = VK_SAMPLE_COUNT_1_BIT;
 	attachment.format = og_ctx->surf_format.format;
@@ -439,5 +1138,7 @@ OG_INT void _create_render_pass(OGContext *og_ctx) {
 
 
 OG_INT void _create_pipeline(OGContext *og_ctx) {
+	_create_sprite_pipeline(og_ctx);
+	_create_shape_pipeline(og_ctx);
 }
 
@@ -0,0 +1,465 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_shape.h"
+
+#include <math.h>
+#include <stddef.h>
+
+// SSE2 Is Part Of Every x86-64 Target, Anything Else Takes The Scalar Paths
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define OG_SHAPE_SIMD 1
+#endif
+
+// SPIR-V Generated From ./shaders By The Makefile
+static const uint32_t shape_vert_spv[] =
+#include "shaders/shape.vert.inc"
+;
+
+static const uint32_t shape_frag_spv[] =
+#include "shaders/shape.frag.inc"
+;
+
+#ifdef OG_SHAPE_SIMD
+// Interleaves Four Positions And One Color Into Four 12 Byte Vertices, Three Stores
+static inline void __store_vertices4(OGShapeVertex *dst, __m128 x, __m128 y, __m128 color) {
+	__m128 xy_lo = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+	__m128 xy_hi = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+	__m128 c_lo = _mm_shuffle_ps(color, xy_lo, _MM_SHUFFLE(3, 2, 1, 0)); // c c x1 y1
+	__m128 c_hi = _mm_shuffle_ps(color, xy_hi, _MM_SHUFFLE(3, 2, 1, 0)); // c c x3 y3
+
+	float *out = (float*)dst;
+	_mm_storeu_ps(out + 0, _mm_shuffle_ps(xy_lo, c_lo, _MM_SHUFFLE(2, 0, 1, 0))); // x0 y0 c x1
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(c_lo, xy_hi, _MM_SHUFFLE(1, 0, 0, 3))); // y1 c x2 y2
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(c_hi, c_hi, _MM_SHUFFLE(0, 3, 2, 0))); // c x3 y3 c
+}
+#endif
+
+OG_INT bool __reserve_shape(OGShapeBatch *batch, uint32_t vertex_count, uint32_t index_count) {
+	if (batch->vertex_count + vertex_count > batch->vertex_capacity ||
+			batch->index_count + index_count > batch->index_capacity) {
+		if (!batch->overflowed) {
+			OG_LOG_ERR("Shape Batch Full, Raise OGConfig.max_shape_vertices");
+		}
+		batch->overflowed = true;
+		return false;
+	}
+
+	batch->shapes++;
+	return true;
+}
+
+OG_INT void __write_vertices(OGShapeVertex *dst, const float *xs, const float *ys, uint32_t count, uint32_t color) {
+	uint32_t i = 0;
+
+#ifdef OG_SHAPE_SIMD
+	__m128 c = _mm_castsi128_ps(_mm_set1_epi32((int)color));
+	for (; i + 4 <= count; i += 4) {
+		__store_vertices4(dst + i, _mm_loadu_ps(xs + i), _mm_loadu_ps(ys + i), c);
+	}
+#endif
+
+	for (; i < count; i++) {
+		dst[i].pos[0] = xs[i];
+		dst[i].pos[1] = ys[i];
+		dst[i].color = color;
+	}
+}
+
+// Corners (x, y), + a, + a + b, + b, Built In Registers Rather Than Staged Through Memory
+OG_INT void __write_quad(OGShapeVertex *dst, float x, float y, float ax, float ay, float bx, float by, uint32_t color) {
+#ifdef OG_SHAPE_SIMD
+	__m128 px = _mm_add_ps(_mm_set1_ps(x), _mm_setr_ps(0.0f, ax, ax + bx, bx));
+	__m128 py = _mm_add_ps(_mm_set1_ps(y), _mm_setr_ps(0.0f, ay, ay + by, by));
+	__store_vertices4(dst, px, py, _mm_castsi128_ps(_mm_set1_epi32((int)color)));
+#else
+	float xs[4] = { x, x + ax, x + ax + bx, x + bx };
+	float ys[4] = { y, y + ay, y + ay + by, y + by };
+	__write_vertices(dst, xs, ys, 4, color);
+#endif
+}
+
+// Points Come In As x, y Pairs, Deinterleaved Four At A Time
+OG_INT void __write_points(OGShapeVertex *dst, const float *points, uint32_t count, uint32_t color) {
+	uint32_t i = 0;
+
+#ifdef OG_SHAPE_SIMD
+	__m128 c = _mm_castsi128_ps(_mm_set1_epi32((int)color));
+	for (; i + 4 <= count; i += 4) {
+		__m128 a = _mm_loadu_ps(points + i * 2);
+		__m128 b = _mm_loadu_ps(points + i * 2 + 4);
+		__m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		__store_vertices4(dst + i, x, y, c);
+	}
+#endif
+
+	for (; i < count; i++) {
+		dst[i].pos[0] = points[i * 2];
+		dst[i].pos[1] = points[i * 2 + 1];
+		dst[i].color = color;
+	}
+}
+
+// Triangles (center, first + t, first + t + 1). Closed Fans Wrap The Last One Back To first
+OG_INT void __write_fan(uint32_t *dst, uint32_t center, uint32_t first, uint32_t triangles, bool closed) {
+	uint32_t t = 0;
+
+#ifdef OG_SHAPE_SIMD
+	// Four Triangles Are Exactly Three Vectors Of Indices, Quads Skip The Setup
+	if (triangles >= 4) {
+		__m128i p0 = _mm_setr_epi32((int)center, (int)first, (int)first + 1, (int)center);
+		__m128i p1 = _mm_setr_epi32((int)first + 1, (int)first + 2, (int)center, (int)first + 2);
+		__m128i p2 = _mm_setr_epi32((int)first + 3, (int)center, (int)first + 3, (int)first + 4);
+		__m128i s0 = _mm_setr_epi32(0, 4, 4, 0);
+		__m128i s1 = _mm_setr_epi32(4, 4, 0, 4);
+		__m128i s2 = _mm_setr_epi32(4, 0, 4, 4);
+
+		for (; t + 4 <= triangles; t += 4) {
+			_mm_storeu_si128((__m128i*)(dst + t * 3), p0);
+			_mm_storeu_si128((__m128i*)(dst + t * 3 + 4), p1);
+			_mm_storeu_si128((__m128i*)(dst + t * 3 + 8), p2);
+			p0 = _mm_add_epi32(p0, s0);
+			p1 = _mm_add_epi32(p1, s1);
+			p2 = _mm_add_epi32(p2, s2);
+		}
+	}
+#endif
+
+	for (; t < triangles; t++) {
+		dst[t * 3] = center;
+		dst[t * 3 + 1] = first + t;
+		dst[t * 3 + 2] = first + t + 1;
+	}
+
+	if (closed && triangles) {
+		dst[triangles * 3 - 1] = first;
+	}
+}
+
+// Segments Is Always A Multiple Of Four, So The Rim Never Needs A Scalar Tail
+OG_INT void __write_circle(OGShapeVertex *dst, const float *unit_x, const float *unit_y,
+		uint32_t segments, float x, float y, float radius, uint32_t color) {
+#ifdef OG_SHAPE_SIMD
+	__m128 cx = _mm_set1_ps(x);
+	__m128 cy = _mm_set1_ps(y);
+	__m128 r = _mm_set1_ps(radius);
+	__m128 c = _mm_castsi128_ps(_mm_set1_epi32((int)color));
+
+	for (uint32_t i = 0; i < segments; i += 4) {
+		__m128 px = _mm_add_ps(cx, _mm_mul_ps(r, _mm_loadu_ps(unit_x + i)));
+		__m128 py = _mm_add_ps(cy, _mm_mul_ps(r, _mm_loadu_ps(unit_y + i)));
+		__store_vertices4(dst + i, px, py, c);
+	}
+#else
+	for (uint32_t i = 0; i < segments; i++) {
+		dst[i].pos[0] = x + radius * unit_x[i];
+		dst[i].pos[1] = y + radius * unit_y[i];
+		dst[i].color = color;
+	}
+#endif
+}
+
+// Fewest Segments Keeping The Edge Within OG_SHAPE_TOLERANCE Of The True Circle
+OG_INT uint32_t __circle_segments(float radius) {
+	uint32_t segments = OG_SHAPE_MIN_SEGMENTS;
+	if (radius <= OG_SHAPE_TOLERANCE) {
+		return segments;
+	}
+
+	float wanted = 3.14159265f / acosf(1.0f - OG_SHAPE_TOLERANCE / radius);
+	while (segments < OG_SHAPE_MAX_SEGMENTS && (float)segments < wanted) {
+		segments *= 2;
+	}
+	return segments;
+}
+
+// Everything Tessellation Touches, No Device Needed. Draw Calls May Come Before
+// This Slot's Fence Is Waited On, So The Frame Is Built In Host Memory And
+// Copied Over In One Go On Flush
+OG_INT void __init_shape_arena(OGShapeBatch *batch, uint32_t max_vertices) {
+	// A Fan Never Has More Than Three Indices Per Vertex
+	batch->vertex_capacity = max_vertices;
+	batch->index_capacity = max_vertices * 3;
+	batch->vertices = malloc(batch->vertex_capacity * sizeof(OGShapeVertex));
+	batch->indices = malloc(batch->index_capacity * sizeof(uint32_t));
+
+	for (uint32_t segments = OG_SHAPE_MIN_SEGMENTS; segments <= OG_SHAPE_MAX_SEGMENTS; segments *= 2) {
+		float *unit_x = batch->unit_x + segments - OG_SHAPE_MIN_SEGMENTS;
+		float *unit_y = batch->unit_y + segments - OG_SHAPE_MIN_SEGMENTS;
+
+		for (uint32_t i = 0; i < segments; i++) {
+			float angle = 2.0f * 3.14159265f * (float)i / (float)segments;
+			unit_x[i] = cosf(angle);
+			unit_y[i] = sinf(angle);
+		}
+	}
+}
+
+
+// x, y Is The Top Left Corner
+OG_API void og_draw_rect(OGContext *og_ctx, float x, float y, float w, float h, VkClearColorValue color) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+	if (!__reserve_shape(batch, 4, 6)) {
+		return;
+	}
+
+	uint32_t base = batch->vertex_count;
+	__write_quad(batch->vertices + base, x, y, w, 0.0f, 0.0f, h, __pack_color(color));
+	__write_fan(batch->indices + batch->index_count, base, base + 1, 2, false);
+	batch->vertex_count += 4;
+	batch->index_count += 6;
+}
+
+OG_API void og_draw_line(OGContext *og_ctx, float x0, float y0, float x1, float y1, float thickness, VkClearColorValue color) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+
+	float dx = x1 - x0;
+	float dy = y1 - y0;
+	float length = sqrtf(dx * dx + dy * dy);
+	if (length == 0.0f || !__reserve_shape(batch, 4, 6)) {
+		return;
+	}
+
+	// Half The Thickness Along The Normal, On Both Sides
+	float nx = -dy / length * thickness * 0.5f;
+	float ny = dx / length * thickness * 0.5f;
+
+	uint32_t base = batch->vertex_count;
+	__write_quad(batch->vertices + base, x0 + nx, y0 + ny, dx, dy, -2.0f * nx, -2.0f * ny, __pack_color(color));
+	__write_fan(batch->indices + batch->index_count, base, base + 1, 2, false);
+	batch->vertex_count += 4;
+	batch->index_count += 6;
+}
+
+OG_API void og_draw_circle(OGContext *og_ctx, float x, float y, float radius, VkClearColorValue color) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+	uint32_t segments = __circle_segments(radius);
+	if (!__reserve_shape(batch, segments + 1, segments * 3)) {
+		return;
+	}
+
+	uint32_t packed = __pack_color(color);
+	uint32_t base = batch->vertex_count;
+	uint32_t table = segments - OG_SHAPE_MIN_SEGMENTS;
+
+	OGShapeVertex *center = &batch->vertices[base];
+	center->pos[0] = x;
+	center->pos[1] = y;
+	center->color = packed;
+
+	__write_circle(center + 1, batch->unit_x + table, batch->unit_y + table, segments, x, y, radius, packed);
+	__write_fan(batch->indices + batch->index_count, base, base + 1, segments, true);
+	batch->vertex_count += segments + 1;
+	batch->index_count += segments * 3;
+}
+
+// Convex Only, points Holds count x, y Pairs In Winding Order
+OG_API void og_draw_polygon(OGContext *og_ctx, const float *points, uint32_t count, VkClearColorValue color) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+	if (count < 3 || !__reserve_shape(batch, count, (count - 2) * 3)) {
+		return;
+	}
+
+	uint32_t base = batch->vertex_count;
+	__write_points(batch->vertices + base, points, count, __pack_color(color));
+	__write_fan(batch->indices + batch->index_count, base, base + 1, count - 2, false);
+	batch->vertex_count += count;
+	batch->index_count += (count - 2) * 3;
+}
+
+
+// Copies The Frame's Shapes Into This Slot's Buffers And Draws Them All At Once
+OG_INT void _flush_shapes(OGContext *og_ctx) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+
+	batch->shapes_drawn = batch->shapes;
+	batch->vertices_drawn = batch->vertex_count;
+	if (!batch->index_count) {
+		_reset_shapes(og_ctx);
+		return;
+	}
+
+	memcpy(batch->vertex_buffers[og_ctx->frame_idx].alloc.mapped, batch->vertices,
+			batch->vertex_count * sizeof(OGShapeVertex));
+	memcpy(batch->index_buffers[og_ctx->frame_idx].alloc.mapped, batch->indices,
+			batch->index_count * sizeof(uint32_t));
+
+	VkViewport viewport = {};
+	viewport.width = (float)og_ctx->curr_extent.width;
+	viewport.height = (float)og_ctx->curr_extent.height;
+	viewport.maxDepth = 1.0f;
+
+	VkRect2D scissor = og_ctx->curr_scissor;
+
+	float push[4] = {
+		2.0f / viewport.width, 2.0f / viewport.height,
+		-1.0f, -1.0f,
+	};
+
+	VkDeviceSize vb_offset = 0;
+
+	vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, batch->pipeline);
+	vkCmdSetViewport(cmd_buffer, 0, 1, &viewport);
+	vkCmdSetScissor(cmd_buffer, 0, 1, &scissor);
+	vkCmdPushConstants(cmd_buffer, batch->layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push), push);
+	vkCmdBindVertexBuffers(cmd_buffer, 0, 1, &batch->vertex_buffers[og_ctx->frame_idx].buffer, &vb_offset);
+	vkCmdBindIndexBuffer(cmd_buffer, batch->index_buffers[og_ctx->frame_idx].buffer, 0, VK_INDEX_TYPE_UINT32);
+	vkCmdDrawIndexed(cmd_buffer, batch->index_count, 1, 0, 0, 0);
+
+	_reset_shapes(og_ctx);
+}
+
+OG_INT void _reset_shapes(OGContext *og_ctx) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+	batch->vertex_count = 0;
+	batch->index_count = 0;
+	batch->shapes = 0;
+	batch->overflowed = false;
+}
+
+OG_INT void _create_shape_pipeline(OGContext *og_ctx) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+
+	VkPushConstantRange push_range = {};
+	push_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	push_range.offset = 0;
+	push_range.size = 4 * sizeof(float);
+
+	VkPipelineLayoutCreateInfo pl_create_info = {};
+	pl_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pl_create_info.pushConstantRangeCount = 1;
+	pl_create_info.pPushConstantRanges = &push_range;
+
+	OG_CHECK_VK(vkCreatePipelineLayout(og_ctx->logical_device, &pl_create_info,
+				NULL, &batch->layout), "Shape Pipeline Layout Creation Failed");
+
+	VkShaderModule vert_module = og_get_shader_module(og_ctx, shape_vert_spv, sizeof(shape_vert_spv));
+	VkShaderModule frag_module = og_get_shader_module(og_ctx, shape_frag_spv, sizeof(shape_frag_spv));
+
+	VkPipelineShaderStageCreateInfo stages[2] = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vert_module;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = frag_module;
+	stages[1].pName = "main";
+
+	VkVertexInputBindingDescription vi_binding = {};
+	vi_binding.binding = 0;
+	vi_binding.stride = sizeof(OGShapeVertex);
+	vi_binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+	VkVertexInputAttributeDescription vi_attributes[] = {
+		{ 0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(OGShapeVertex, pos) },
+		{ 1, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(OGShapeVertex, color) },
+	};
+
+	VkPipelineVertexInputStateCreateInfo vi_state = {};
+	vi_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vi_state.vertexBindingDescriptionCount = 1;
+	vi_state.pVertexBindingDescriptions = &vi_binding;
+	vi_state.vertexAttributeDescriptionCount = OG_ARR_SIZE(vi_attributes);
+	vi_state.pVertexAttributeDescriptions = vi_attributes;
+
+	VkPipelineInputAssemblyStateCreateInfo ia_state = {};
+	ia_state.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+	VkPipelineViewportStateCreateInfo vp_state = {};
+	vp_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	vp_state.viewportCount = 1;
+	vp_state.scissorCount = 1;
+
+	// Winding Is Up To The Caller, So Nothing Is Culled
+	VkPipelineRasterizationStateCreateInfo rs_state = {};
+	rs_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rs_state.polygonMode = VK_POLYGON_MODE_FILL;
+	rs_state.cullMode = VK_CULL_MODE_NONE;
+	rs_state.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	rs_state.lineWidth = 1.0f;
+
+	VkPipelineMultisampleStateCreateInfo ms_state = {};
+	ms_state.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_state.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	VkPipelineColorBlendAttachmentState blend_attachment = {};
+	blend_attachment.blendEnable = VK_TRUE;
+	blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+	blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+		VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+	VkPipelineColorBlendStateCreateInfo cb_state = {};
+	cb_state.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	cb_state.attachmentCount = 1;
+	cb_state.pAttachments = &blend_attachment;
+
+	VkDynamicState dynamic_states[] = {
+		VK_DYNAMIC_STATE_VIEWPORT,
+		VK_DYNAMIC_STATE_SCISSOR,
+	};
+
+	VkPipelineDynamicStateCreateInfo dyn_state = {};
+	dyn_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dyn_state.dynamicStateCount = OG_ARR_SIZE(dynamic_states);
+	dyn_state.pDynamicStates = dynamic_states;
+
+	VkGraphicsPipelineCreateInfo gp_create_info = {};
+	gp_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	gp_create_info.stageCount = OG_ARR_SIZE(stages);
+	gp_create_info.pStages = stages;
+	gp_create_info.pVertexInputState = &vi_state;
+	gp_create_info.pInputAssemblyState = &ia_state;
+	gp_create_info.pViewportState = &vp_state;
+	gp_create_info.pRasterizationState = &rs_state;
+	gp_create_info.pMultisampleState = &ms_state;
+	gp_create_info.pColorBlendState = &cb_state;
+	gp_create_info.pDynamicState = &dyn_state;
+	gp_create_info.layout = batch->layout;
+	gp_create_info.renderPass = og_ctx->render_pass;
+	gp_create_info.subpass = 0;
+
+	batch->pipeline = og_get_graphics_pipeline(og_ctx, &gp_create_info);
+}
+
+OG_INT void _create_shape_batch(OGContext *og_ctx, uint32_t max_vertices) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+
+	__init_shape_arena(batch, max_vertices);
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		if (!og_create_buffer(og_ctx, (VkDeviceSize)batch->vertex_capacity * sizeof(OGShapeVertex),
+					VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, OG_MEMORY_CPU_TO_GPU, &batch->vertex_buffers[i])) {
+			OG_LOG_ERR("Shape Vertex Buffer Creation Failed");
+		}
+		if (!og_create_buffer(og_ctx, (VkDeviceSize)batch->index_capacity * sizeof(uint32_t),
+					VK_BUFFER_USAGE_INDEX_BUFFER_BIT, OG_MEMORY_CPU_TO_GPU, &batch->index_buffers[i])) {
+			OG_LOG_ERR("Shape Index Buffer Creation Failed");
+		}
+	}
+}
+
+OG_INT void _destroy_shape_batch(OGContext *og_ctx) {
+	OGShapeBatch *batch = &og_ctx->shapes;
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		og_destroy_buffer(og_ctx, &batch->vertex_buffers[i]);
+		og_destroy_buffer(og_ctx, &batch->index_buffers[i]);
+	}
+
+	vkDestroyPipelineLayout(og_ctx->logical_device, batch->layout, NULL);
+
+	free(batch->vertices);
+	free(batch->indices);
+}
@@ -0,0 +1,203 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_spatial.h"
+
+#include <math.h>
+
+#define OG_SPATIAL_NONE 0xFFFFFFFFu // End Of The Free List
+
+OG_INT uint32_t __spatial_bucket(const OGSpatialGrid *grid, int32_t cell_x, int32_t cell_y) {
+	return ((uint32_t)cell_x * 73856093u ^ (uint32_t)cell_y * 19349663u) & grid->bucket_mask;
+}
+
+// Files The Item Under The Cell Holding Its Center, Or The Large List When A
+// Cell Plus Half A Cell Either Side Can't Hold It
+OG_INT void __spatial_link(OGSpatialGrid *grid, OGSpatialHandle handle) {
+	OGSpatialItem *item = &grid->items[handle];
+	OGSpatialBucket *bucket = &grid->large;
+
+	if (item->max_x - item->min_x <= grid->cell_size && item->max_y - item->min_y <= grid->cell_size) {
+		item->cell_x = (int32_t)floorf((item->min_x + item->max_x) * 0.5f * grid->inv_cell_size);
+		item->cell_y = (int32_t)floorf((item->min_y + item->max_y) * 0.5f * grid->inv_cell_size);
+		item->bucket = __spatial_bucket(grid, item->cell_x, item->cell_y);
+		bucket = &grid->buckets[item->bucket];
+	} else {
+		item->bucket = OG_SPATIAL_LARGE;
+	}
+
+	if (bucket->count == bucket->capacity) {
+		bucket->capacity = bucket->capacity ? bucket->capacity * 2 : 4;
+		bucket->items = realloc(bucket->items, bucket->capacity * sizeof(uint32_t));
+	}
+
+	item->slot = bucket->count;
+	bucket->items[bucket->count++] = handle;
+}
+
+// Swap Remove, The Bucket's Last Item Takes Over The Slot
+OG_INT void __spatial_unlink(OGSpatialGrid *grid, OGSpatialHandle handle) {
+	OGSpatialItem *item = &grid->items[handle];
+	OGSpatialBucket *bucket = item->bucket == OG_SPATIAL_LARGE ? &grid->large : &grid->buckets[item->bucket];
+
+	uint32_t last = bucket->items[--bucket->count];
+	bucket->items[item->slot] = last;
+	grid->items[last].slot = item->slot;
+}
+
+
+OG_API OGSpatialGrid* og_create_spatial_grid(float cell_size, uint32_t capacity) {
+	OGSpatialGrid *grid = calloc(1, sizeof(OGSpatialGrid));
+	grid->cell_size = cell_size;
+	grid->inv_cell_size = 1.0f / cell_size;
+	grid->free_head = OG_SPATIAL_NONE;
+
+	grid->item_capacity = capacity ? capacity : 1024;
+	grid->items = malloc(grid->item_capacity * sizeof(OGSpatialItem));
+
+	// Around Two Items Per Bucket When Full
+	uint32_t bucket_count = 1024;
+	while (bucket_count < grid->item_capacity / 2) {
+		bucket_count *= 2;
+	}
+	grid->buckets = calloc(bucket_count, sizeof(OGSpatialBucket));
+	grid->bucket_mask = bucket_count - 1;
+	return grid;
+}
+
+OG_API void og_destroy_spatial_grid(OGSpatialGrid *grid) {
+	for (uint32_t i = 0; i <= grid->bucket_mask; i++) {
+		free(grid->buckets[i].items);
+	}
+
+	free(grid->buckets);
+	free(grid->large.items);
+	free(grid->items);
+	free(grid);
+}
+
+OG_API OGSpatialHandle og_spatial_insert(OGSpatialGrid *grid, float min_x, float min_y, float max_x, float max_y, uint32_t user) {
+	OGSpatialHandle handle = grid->free_head;
+
+	if (handle != OG_SPATIAL_NONE) {
+		grid->free_head = grid->items[handle].slot;
+	} else {
+		if (grid->item_count == grid->item_capacity) {
+			grid->item_capacity *= 2;
+			grid->items = realloc(grid->items, grid->item_capacity * sizeof(OGSpatialItem));
+		}
+		handle = grid->item_count++;
+	}
+
+	OGSpatialItem *item = &grid->items[handle];
+	item->min_x = min_x;
+	item->min_y = min_y;
+	item->max_x = max_x;
+	item->max_y = max_y;
+	item->user = user;
+
+	__spatial_link(grid, handle);
+	grid->live++;
+	return handle;
+}
+
+// Staying Inside The Same Cell, The Usual Case For Anything Moving A Few Pixels
+// A Frame, Only Rewrites The Bounds
+OG_API void og_spatial_move(OGSpatialGrid *grid, OGSpatialHandle handle, float min_x, float min_y, float max_x, float max_y) {
+	OGSpatialItem *item = &grid->items[handle];
+
+	bool small = max_x - min_x <= grid->cell_size && max_y - min_y <= grid->cell_size;
+	int32_t cell_x = (int32_t)floorf((min_x + max_x) * 0.5f * grid->inv_cell_size);
+	int32_t cell_y = (int32_t)floorf((min_y + max_y) * 0.5f * grid->inv_cell_size);
+	bool relink = !small || item->bucket == OG_SPATIAL_LARGE || cell_x != item->cell_x || cell_y != item->cell_y;
+
+	if (relink) {
+		__spatial_unlink(grid, handle);
+	}
+
+	item->min_x = min_x;
+	item->min_y = min_y;
+	item->max_x = max_x;
+	item->max_y = max_y;
+
+	if (relink) {
+		__spatial_link(grid, handle);
+	}
+}
+
+OG_API void og_spatial_remove(OGSpatialGrid *grid, OGSpatialHandle handle) {
+	OGSpatialItem *item = &grid->items[handle];
+
+	__spatial_unlink(grid, handle);
+	item->bucket = OG_SPATIAL_FREE;
+	item->slot = grid->free_head;
+	grid->free_head = handle;
+	grid->live--;
+}
+
+OG_API uint32_t og_spatial_query(OGSpatialGrid *grid, float min_x, float min_y, float max_x, float max_y,
+		uint32_t *out, uint32_t max_out) {
+	uint32_t found = 0;
+	grid->tested = 0;
+
+	// Anything Whose Center Lies Within Half A Cell Of The Rectangle May Overlap It
+	float half = grid->cell_size * 0.5f;
+	int32_t cell_x0 = (int32_t)floorf((min_x - half) * grid->inv_cell_size);
+	int32_t cell_y0 = (int32_t)floorf((min_y - half) * grid->inv_cell_size);
+	int32_t cell_x1 = (int32_t)floorf((max_x + half) * grid->inv_cell_size);
+	int32_t cell_y1 = (int32_t)floorf((max_y + half) * grid->inv_cell_size);
+	uint64_t cells = (uint64_t)(cell_x1 - cell_x0 + 1) * (uint64_t)(cell_y1 - cell_y0 + 1);
+
+	if (cells > grid->bucket_mask) {
+		// Zoomed Out Past The Table, Walking Every Bucket Once Is Cheaper
+		for (uint32_t b = 0; b <= grid->bucket_mask; b++) {
+			OGSpatialBucket *bucket = &grid->buckets[b];
+			grid->tested += bucket->count;
+
+			for (uint32_t i = 0; i < bucket->count; i++) {
+				const OGSpatialItem *item = &grid->items[bucket->items[i]];
+				if (item->max_x >= min_x && item->min_x <= max_x && item->max_y >= min_y && item->min_y <= max_y) {
+					if (found < max_out) {
+						out[found] = item->user;
+					}
+					found++;
+				}
+			}
+		}
+	} else {
+		for (int32_t cy = cell_y0; cy <= cell_y1; cy++) {
+			for (int32_t cx = cell_x0; cx <= cell_x1; cx++) {
+				OGSpatialBucket *bucket = &grid->buckets[__spatial_bucket(grid, cx, cy)];
+				grid->tested += bucket->count;
+
+				// Other Cells Hashed Into The Same Bucket Are Skipped, So Nothing Comes Out Twice
+				for (uint32_t i = 0; i < bucket->count; i++) {
+					const OGSpatialItem *item = &grid->items[bucket->items[i]];
+					if (item->cell_x != cx || item->cell_y != cy) {
+						continue;
+					}
+					if (item->max_x >= min_x && item->min_x <= max_x && item->max_y >= min_y && item->min_y <= max_y) {
+						if (found < max_out) {
+							out[found] = item->user;
+						}
+						found++;
+					}
+				}
+			}
+		}
+	}
+
+	grid->tested += grid->large.count;
+	for (uint32_t i = 0; i < grid->large.count; i++) {
+		const OGSpatialItem *item = &grid->items[grid->large.items[i]];
+		if (item->max_x >= min_x && item->min_x <= max_x && item->max_y >= min_y && item->min_y <= max_y) {
+			if (found < max_out) {
+				out[found] = item->user;
+			}
+			found++;
+		}
+	}
+	return found;
+}
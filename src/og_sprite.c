@@ -0,0 +1,662 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_sprite.h"
+
+#include <stddef.h>
+
+// SPIR-V Generated From ./shaders By The Makefile
+static const uint32_t sprite_vert_spv[] =
+#include "shaders/sprite.vert.inc"
+;
+
+static const uint32_t sprite_frag_spv[] =
+#include "shaders/sprite.frag.inc"
+;
+
+static const uint32_t sprite_bindless_frag_spv[] =
+#include "shaders/sprite_bindless.frag.inc"
+;
+
+OG_INT uint32_t __pack_color(VkClearColorValue color) {
+	uint32_t packed = 0;
+
+	for (uint32_t i = 0; i < 4; i++) {
+		float c = color.float32[i];
+		c = c < 0.0f ? 0.0f : (c > 1.0f ? 1.0f : c);
+		packed |= (uint32_t)(c * 255.0f + 0.5f) << (i * 8);
+	}
+	return packed;
+}
+
+// LSD Radix Sort Of The Runs Into sorted_runs, One Key Byte Per Pass. Every Byte's
+// Histogram Comes From One Read Up Front, And Bytes All Keys Share Skip Their Pass,
+// Which Leaves Most Frames With One Or Two. Stable, So Runs Sharing A Key Keep
+// Their Submission Order. runs Is Used As Scratch And Holds Nothing Useful After
+OG_INT void __sort_runs(OGSpriteBatch *batch) {
+	uint32_t count = batch->run_count;
+	if (!count) {
+		return;
+	}
+
+	uint32_t hist[8][256];
+	memset(hist, 0, sizeof(hist));
+	for (uint32_t i = 0; i < count; i++) {
+		uint64_t key = batch->runs[i].key;
+		for (uint32_t b = 0; b < 8; b++) {
+			hist[b][(key >> (b * 8)) & 0xFF]++;
+		}
+	}
+
+	OGSpriteRun *src = batch->runs;
+	OGSpriteRun *dst = batch->sorted_runs;
+	for (uint32_t b = 0; b < 8; b++) {
+		uint32_t shift = b * 8;
+		if (hist[b][(src[0].key >> shift) & 0xFF] == count) {
+			continue;
+		}
+
+		uint32_t offsets[256];
+		uint32_t sum = 0;
+		for (uint32_t i = 0; i < 256; i++) {
+			offsets[i] = sum;
+			sum += hist[b][i];
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+		}
+
+		OGSpriteRun *tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+
+	if (src != batch->sorted_runs) {
+		memcpy(batch->sorted_runs, src, count * sizeof(OGSpriteRun));
+	}
+}
+
+// The CPU Side Of The Batch, Needs No Device
+OG_INT void __init_sprite_arena(OGSpriteBatch *batch, uint32_t max_sprites) {
+	batch->capacity = max_sprites;
+	batch->instances = malloc(max_sprites * sizeof(OGSpriteInstance));
+	batch->run_capacity = 256;
+	batch->runs = malloc(batch->run_capacity * sizeof(OGSpriteRun));
+	batch->sorted_runs = malloc(batch->run_capacity * sizeof(OGSpriteRun));
+}
+
+
+OG_API OGTexture* og_create_texture(OGContext *og_ctx, uint32_t width, uint32_t height, const void* rgba) {
+	OGTexture *texture = calloc(1, sizeof(OGTexture));
+	if (!_create_texture(og_ctx, texture, width, height, VK_FORMAT_R8G8B8A8_UNORM, 1)) {
+		free(texture);
+		return NULL;
+	}
+
+	// Recorded On The Upload Queue, Drawn As Plain White Until It Lands
+	texture->upload = og_upload_image(og_ctx, texture->image.image, width, height, rgba);
+
+	_create_texture_set(og_ctx, texture);
+	return texture;
+}
+
+OG_API void og_destroy_texture(OGContext *og_ctx, OGTexture *texture) {
+	// Frames Still In Flight May Sample It, Not Meant For The Hot Path
+	og_upload_wait(og_ctx, texture->upload);
+	OG_CHECK_VK(vkDeviceWaitIdle(og_ctx->logical_device), "Device Wait Idle Failed");
+
+	// The Array Entry Is Simply Left Behind, Nothing Samples A Slot Until It Is Written Again
+	if (!og_ctx->sprites.registry.bindless) {
+		vkFreeDescriptorSets(og_ctx->logical_device, og_ctx->sprites.desc_pool, 1, &texture->set);
+	}
+	_release_texture_id(og_ctx, texture);
+	vkDestroyImageView(og_ctx->logical_device, texture->view, NULL);
+	og_destroy_image(og_ctx, &texture->image);
+	free(texture);
+}
+
+OG_API void og_draw_sprite(OGContext *og_ctx, const OGSprite *sprite) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+
+	OGTexture *texture = sprite->texture ? sprite->texture : batch->white;
+	if (texture->upload > og_ctx->upload.completed) {
+		texture = batch->white;
+	}
+
+	OGSpriteInstance *instance = _reserve_sprites(og_ctx, texture, sprite->layer, 1);
+	if (!instance) {
+		return;
+	}
+
+	instance->pos[0] = sprite->x;
+	instance->pos[1] = sprite->y;
+	instance->size[0] = sprite->w;
+	instance->size[1] = sprite->h;
+	instance->rotation = sprite->rotation;
+	instance->color = __pack_color(sprite->color);
+	instance->sdf = 0.0f;
+
+	if (sprite->u0 == 0.0f && sprite->v0 == 0.0f && sprite->u1 == 0.0f && sprite->v1 == 0.0f) {
+		instance->uv[0] = 0.0f;
+		instance->uv[1] = 0.0f;
+		instance->uv[2] = 1.0f;
+		instance->uv[3] = 1.0f;
+	} else {
+		instance->uv[0] = sprite->u0;
+		instance->uv[1] = sprite->v0;
+		instance->uv[2] = sprite->u1;
+		instance->uv[3] = sprite->v1;
+	}
+}
+
+
+// The Image And View Only, Callers Upload Into It And Then Give It Its Set
+OG_INT bool _create_texture(OGContext *og_ctx, OGTexture *texture, uint32_t width, uint32_t height,
+		VkFormat format, uint32_t mip_levels) {
+	texture->width = width;
+	texture->height = height;
+	if (!_acquire_texture_id(og_ctx, texture)) {
+		return false;
+	}
+
+	VkImageCreateInfo img_create_info = {};
+	img_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	img_create_info.imageType = VK_IMAGE_TYPE_2D;
+	img_create_info.format = format;
+	img_create_info.extent.width = width;
+	img_create_info.extent.height = height;
+	img_create_info.extent.depth = 1;
+	img_create_info.mipLevels = mip_levels;
+	img_create_info.arrayLayers = 1;
+	img_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+	img_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	img_create_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	img_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	img_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	// Written On The Transfer Queue, Sampled On The Graphics One
+	if (og_ctx->upload.concurrent) {
+		img_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		img_create_info.queueFamilyIndexCount = 2;
+		img_create_info.pQueueFamilyIndices = og_ctx->upload.families;
+	}
+
+	if (!og_create_image(og_ctx, &img_create_info, OG_MEMORY_GPU_ONLY, &texture->image)) {
+		OG_LOG_ERR("Texture Image Creation Failed");
+		_release_texture_id(og_ctx, texture);
+		return false;
+	}
+
+	VkImageViewCreateInfo iv_create_info = {};
+	iv_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	iv_create_info.image = texture->image.image;
+	iv_create_info.format = img_create_info.format;
+	iv_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	iv_create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	iv_create_info.subresourceRange.layerCount = 1;
+	iv_create_info.subresourceRange.levelCount = mip_levels;
+
+	OG_CHECK_VK(vkCreateImageView(og_ctx->logical_device, &iv_create_info,
+				NULL, &texture->view), "Texture Image View Creation Failed");
+
+	return true;
+}
+
+// Freed Slots Come Back First, So Ids Stay Dense And Sort Keys Small
+OG_INT bool _acquire_texture_id(OGContext *og_ctx, OGTexture *texture) {
+	OGTextureRegistry *registry = &og_ctx->sprites.registry;
+
+	if (registry->free_count) {
+		texture->id = registry->free_ids[--registry->free_count];
+	} else if (registry->next_id < registry->capacity) {
+		texture->id = registry->next_id++;
+	} else {
+		if (registry->bindless) {
+			OG_LOG_ERR("Texture Registry Full, Raise OG_BINDLESS_TEXTURES");
+		} else {
+			OG_LOG_ERR("Texture Registry Full, Raise OG_MAX_TEXTURES");
+		}
+		return false;
+	}
+
+	registry->live++;
+	return true;
+}
+
+// Callers Make Sure No Frame In Flight Still Samples The Texture
+OG_INT void _release_texture_id(OGContext *og_ctx, OGTexture *texture) {
+	OGTextureRegistry *registry = &og_ctx->sprites.registry;
+
+	if (registry->free_count == registry->free_capacity) {
+		registry->free_capacity = registry->free_capacity ? registry->free_capacity * 2 : 64;
+		registry->free_ids = realloc(registry->free_ids, registry->free_capacity * sizeof(uint32_t));
+	}
+	registry->free_ids[registry->free_count++] = texture->id;
+	registry->live--;
+}
+
+// Bindless, The Texture Goes Into Its Slot Of The Shared Array, Which Update After
+// Bind Allows While Frames Using Other Slots Are Still In Flight. Otherwise One Set
+// Per Texture, Bound Once Per Batch
+OG_INT void _create_texture_set(OGContext *og_ctx, OGTexture *texture) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+	OGTextureRegistry *registry = &batch->registry;
+
+	if (registry->bindless) {
+		texture->set = registry->set;
+	} else {
+		VkDescriptorSetAllocateInfo ds_alloc_info = {};
+		ds_alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		ds_alloc_info.descriptorPool = batch->desc_pool;
+		ds_alloc_info.descriptorSetCount = 1;
+		ds_alloc_info.pSetLayouts = &batch->set_layout;
+
+		// The Registry Caps Textures At What The Pool Holds, This Shouldn't Fail
+		if (vkAllocateDescriptorSets(og_ctx->logical_device, &ds_alloc_info, &texture->set) != VK_SUCCESS) {
+			OG_LOG_ERR("Texture Descriptor Set Allocation Failed");
+			texture->set = VK_NULL_HANDLE;
+			return;
+		}
+	}
+
+	VkDescriptorImageInfo desc_img_info = {};
+	desc_img_info.sampler = batch->sampler;
+	desc_img_info.imageView = texture->view;
+	desc_img_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+	VkWriteDescriptorSet desc_write = {};
+	desc_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	desc_write.dstSet = texture->set;
+	desc_write.dstBinding = 0;
+	desc_write.dstArrayElement = registry->bindless ? texture->id : 0;
+	desc_write.descriptorCount = 1;
+	desc_write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	desc_write.pImageInfo = &desc_img_info;
+
+	vkUpdateDescriptorSets(og_ctx->logical_device, 1, &desc_write, 0, NULL);
+}
+
+// Hands Out `count` Consecutive Instances Under One Key For The Caller To Fill,
+// NULL When The Batch Can't Fit Them All
+OG_INT OGSpriteInstance* _reserve_sprites(OGContext *og_ctx, OGTexture *texture, uint32_t layer, uint32_t count) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+
+	if (count > batch->capacity - batch->count) {
+		if (!batch->overflowed) {
+			OG_LOG_ERR("Sprite Batch Full, Raise OGConfig.max_sprites");
+		}
+		batch->overflowed = true;
+		return NULL;
+	}
+
+	// A Texture Whose Set Couldn't Be Made Is Never Bound, It Draws White Instead
+	if (!texture->set) {
+		texture = batch->white;
+	}
+
+	uint64_t key = OG_SPRITE_KEY(layer, texture->id);
+
+	// Consecutive Sprites With The Same Key Just Extend The Current Run
+	OGSpriteRun *run = batch->run_count ? &batch->runs[batch->run_count - 1] : NULL;
+	if (!run || run->key != key) {
+		if (batch->run_count == batch->run_capacity) {
+			batch->run_capacity *= 2;
+			batch->runs = realloc(batch->runs, batch->run_capacity * sizeof(OGSpriteRun));
+			batch->sorted_runs = realloc(batch->sorted_runs, batch->run_capacity * sizeof(OGSpriteRun));
+		}
+
+		run = &batch->runs[batch->run_count++];
+		run->key = key;
+		run->texture = texture;
+		run->first = batch->count;
+		run->count = 0;
+	}
+
+	OGSpriteInstance *instances = &batch->instances[batch->count];
+	for (uint32_t i = 0; i < count; i++) {
+		instances[i].texture = texture->id;
+	}
+	batch->count += count;
+	run->count += count;
+	return instances;
+}
+
+// Sorts This Frame's Runs By Layer And Texture, Lays Them Out Contiguously In
+// The Frame's Instance Buffer And Issues One Instanced Draw Per Texture Change.
+// Called Twice Per Scene, Once For The Layers Under Shapes And Once With
+// `overlay` Set For OG_OVERLAY_LAYER And Up, Which Also Ends The Batch
+OG_INT void _flush_sprites(OGContext *og_ctx, bool overlay) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+
+	if (!overlay) {
+		batch->draw_calls = 0;
+		batch->binds = 0;
+		batch->sprites_drawn = batch->count;
+		batch->flushed_runs = 0;
+
+		// What Binding In Call Order Would Cost, Kept For The Profiler
+		batch->binds_unsorted = 0;
+		for (uint32_t i = 0; i < batch->run_count; i++) {
+			if (!i || batch->runs[i].texture != batch->runs[i - 1].texture) {
+				batch->binds_unsorted++;
+			}
+		}
+
+		__sort_runs(batch);
+
+		// Written Once Up Front, Each Run's First Now Points Into The Instance Buffer
+		OGSpriteInstance *dst = batch->instance_buffers[og_ctx->frame_idx].alloc.mapped;
+		uint32_t written = 0;
+		for (uint32_t i = 0; i < batch->run_count; i++) {
+			OGSpriteRun *run = &batch->sorted_runs[i];
+			memcpy(dst + written, batch->instances + run->first, run->count * sizeof(OGSpriteInstance));
+			run->first = written;
+			written += run->count;
+		}
+	}
+
+	uint32_t end = batch->flushed_runs;
+	while (end < batch->run_count && (overlay || (batch->sorted_runs[end].key >> 32) < OG_OVERLAY_LAYER)) {
+		end++;
+	}
+
+	if (end > batch->flushed_runs) {
+		VkViewport viewport = {};
+		viewport.width = (float)og_ctx->curr_extent.width;
+		viewport.height = (float)og_ctx->curr_extent.height;
+		viewport.maxDepth = 1.0f;
+
+		VkRect2D scissor = og_ctx->curr_scissor;
+
+		float push[4] = {
+			2.0f / viewport.width, 2.0f / viewport.height,
+			-1.0f, -1.0f,
+		};
+
+		VkDeviceSize vb_offset = 0;
+
+		vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, batch->pipeline);
+		vkCmdSetViewport(cmd_buffer, 0, 1, &viewport);
+		vkCmdSetScissor(cmd_buffer, 0, 1, &scissor);
+		vkCmdPushConstants(cmd_buffer, batch->layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push), push);
+		vkCmdBindVertexBuffers(cmd_buffer, 0, 1, &batch->instance_buffers[og_ctx->frame_idx].buffer, &vb_offset);
+
+		// Bindless, Instances Carry Their Texture And The Whole Range Is One Draw
+		bool bindless = batch->registry.bindless;
+		if (bindless) {
+			vkCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, batch->layout,
+					0, 1, &batch->registry.set, 0, NULL);
+			batch->binds++;
+		}
+
+		OGTexture *bound = NULL;
+		uint32_t draw_first = batch->sorted_runs[batch->flushed_runs].first;
+		uint32_t draw_end = draw_first;
+
+		for (uint32_t i = batch->flushed_runs; i < end; i++) {
+			OGSpriteRun *run = &batch->sorted_runs[i];
+
+			// Adjacent Runs With The Same Texture Merge Into One Draw, Even Across Layers
+			if (!bindless && run->texture != bound) {
+				if (draw_end > draw_first) {
+					vkCmdDraw(cmd_buffer, 6, draw_end - draw_first, 0, draw_first);
+					batch->draw_calls++;
+				}
+
+				vkCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, batch->layout,
+						0, 1, &run->texture->set, 0, NULL);
+				bound = run->texture;
+				batch->binds++;
+				draw_first = run->first;
+			}
+			draw_end = run->first + run->count;
+		}
+
+		vkCmdDraw(cmd_buffer, 6, draw_end - draw_first, 0, draw_first);
+		batch->draw_calls++;
+		batch->flushed_runs = end;
+	}
+
+	if (overlay) {
+		batch->count = 0;
+		batch->run_count = 0;
+		batch->overflowed = false;
+	}
+}
+
+OG_INT void _create_sprite_pipeline(OGContext *og_ctx) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+
+	bool bindless = og_ctx->descriptor_indexing;
+
+	VkDescriptorSetLayoutBinding tex_binding = {};
+	tex_binding.binding = 0;
+	tex_binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	tex_binding.descriptorCount = bindless ? OG_BINDLESS_TEXTURES : 1;
+	tex_binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+	VkDescriptorSetLayoutCreateInfo dsl_create_info = {};
+	dsl_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	dsl_create_info.bindingCount = 1;
+	dsl_create_info.pBindings = &tex_binding;
+
+	// Slots Never Written Are Fine As Long As Nothing Samples Them
+	VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+		VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+
+	VkDescriptorSetLayoutBindingFlagsCreateInfo flags_create_info = {};
+	flags_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+	flags_create_info.bindingCount = 1;
+	flags_create_info.pBindingFlags = &binding_flags;
+
+	if (bindless) {
+		dsl_create_info.pNext = &flags_create_info;
+		dsl_create_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+	}
+
+	OG_CHECK_VK(vkCreateDescriptorSetLayout(og_ctx->logical_device, &dsl_create_info,
+				NULL, &batch->set_layout), "Sprite Descriptor Set Layout Creation Failed");
+
+	VkPushConstantRange push_range = {};
+	push_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	push_range.offset = 0;
+	push_range.size = 4 * sizeof(float);
+
+	VkPipelineLayoutCreateInfo pl_create_info = {};
+	pl_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pl_create_info.setLayoutCount = 1;
+	pl_create_info.pSetLayouts = &batch->set_layout;
+	pl_create_info.pushConstantRangeCount = 1;
+	pl_create_info.pPushConstantRanges = &push_range;
+
+	OG_CHECK_VK(vkCreatePipelineLayout(og_ctx->logical_device, &pl_create_info,
+				NULL, &batch->layout), "Sprite Pipeline Layout Creation Failed");
+
+	VkShaderModule vert_module = og_get_shader_module(og_ctx, sprite_vert_spv, sizeof(sprite_vert_spv));
+	VkShaderModule frag_module = bindless ?
+		og_get_shader_module(og_ctx, sprite_bindless_frag_spv, sizeof(sprite_bindless_frag_spv)) :
+		og_get_shader_module(og_ctx, sprite_frag_spv, sizeof(sprite_frag_spv));
+
+	VkPipelineShaderStageCreateInfo stages[2] = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vert_module;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = frag_module;
+	stages[1].pName = "main";
+
+	// Quads Are Expanded From gl_VertexIndex, The Only Vertex Input Is Per Instance
+	VkVertexInputBindingDescription vi_binding = {};
+	vi_binding.binding = 0;
+	vi_binding.stride = sizeof(OGSpriteInstance);
+	vi_binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+	VkVertexInputAttributeDescription vi_attributes[] = {
+		{ 0, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(OGSpriteInstance, pos) },
+		{ 1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(OGSpriteInstance, size) },
+		{ 2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(OGSpriteInstance, uv) },
+		{ 3, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(OGSpriteInstance, color) },
+		{ 4, 0, VK_FORMAT_R32_SFLOAT, offsetof(OGSpriteInstance, rotation) },
+		{ 5, 0, VK_FORMAT_R32_SFLOAT, offsetof(OGSpriteInstance, sdf) },
+		{ 6, 0, VK_FORMAT_R32_UINT, offsetof(OGSpriteInstance, texture) },
+	};
+
+	VkPipelineVertexInputStateCreateInfo vi_state = {};
+	vi_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vi_state.vertexBindingDescriptionCount = 1;
+	vi_state.pVertexBindingDescriptions = &vi_binding;
+	vi_state.vertexAttributeDescriptionCount = OG_ARR_SIZE(vi_attributes);
+	vi_state.pVertexAttributeDescriptions = vi_attributes;
+
+	VkPipelineInputAssemblyStateCreateInfo ia_state = {};
+	ia_state.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+	VkPipelineViewportStateCreateInfo vp_state = {};
+	vp_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	vp_state.viewportCount = 1;
+	vp_state.scissorCount = 1;
+
+	VkPipelineRasterizationStateCreateInfo rs_state = {};
+	rs_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rs_state.polygonMode = VK_POLYGON_MODE_FILL;
+	rs_state.cullMode = VK_CULL_MODE_NONE;
+	rs_state.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	rs_state.lineWidth = 1.0f;
+
+	VkPipelineMultisampleStateCreateInfo ms_state = {};
+	ms_state.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_state.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	VkPipelineColorBlendAttachmentState blend_attachment = {};
+	blend_attachment.blendEnable = VK_TRUE;
+	blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+	blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+		VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+	VkPipelineColorBlendStateCreateInfo cb_state = {};
+	cb_state.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	cb_state.attachmentCount = 1;
+	cb_state.pAttachments = &blend_attachment;
+
+	VkDynamicState dynamic_states[] = {
+		VK_DYNAMIC_STATE_VIEWPORT,
+		VK_DYNAMIC_STATE_SCISSOR,
+	};
+
+	VkPipelineDynamicStateCreateInfo dyn_state = {};
+	dyn_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dyn_state.dynamicStateCount = OG_ARR_SIZE(dynamic_states);
+	dyn_state.pDynamicStates = dynamic_states;
+
+	VkGraphicsPipelineCreateInfo gp_create_info = {};
+	gp_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	gp_create_info.stageCount = OG_ARR_SIZE(stages);
+	gp_create_info.pStages = stages;
+	gp_create_info.pVertexInputState = &vi_state;
+	gp_create_info.pInputAssemblyState = &ia_state;
+	gp_create_info.pViewportState = &vp_state;
+	gp_create_info.pRasterizationState = &rs_state;
+	gp_create_info.pMultisampleState = &ms_state;
+	gp_create_info.pColorBlendState = &cb_state;
+	gp_create_info.pDynamicState = &dyn_state;
+	gp_create_info.layout = batch->layout;
+	gp_create_info.renderPass = og_ctx->render_pass;
+	gp_create_info.subpass = 0;
+
+	batch->pipeline = og_get_graphics_pipeline(og_ctx, &gp_create_info);
+}
+
+OG_INT void _create_sprite_batch(OGContext *og_ctx, uint32_t max_sprites) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+	__init_sprite_arena(batch, max_sprites);
+
+	VkSamplerCreateInfo sampler_create_info = {};
+	sampler_create_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+	sampler_create_info.magFilter = VK_FILTER_LINEAR;
+	sampler_create_info.minFilter = VK_FILTER_LINEAR;
+	sampler_create_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+	sampler_create_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_create_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_create_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	sampler_create_info.maxLod = VK_LOD_CLAMP_NONE; // Packed Textures Carry Full Mip Chains
+
+	OG_CHECK_VK(vkCreateSampler(og_ctx->logical_device, &sampler_create_info,
+				NULL, &batch->sampler), "Sprite Sampler Creation Failed");
+
+	// Bindless, The Pool Holds Just The One Array. Otherwise A Set Per Texture
+	OGTextureRegistry *registry = &batch->registry;
+	memset(registry, 0, sizeof(OGTextureRegistry));
+	registry->bindless = og_ctx->descriptor_indexing;
+	registry->capacity = registry->bindless ? OG_BINDLESS_TEXTURES : OG_MAX_TEXTURES; // One Id Per Set The Pool Holds
+
+	VkDescriptorPoolSize pool_size = {};
+	pool_size.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+	pool_size.descriptorCount = registry->bindless ? OG_BINDLESS_TEXTURES : OG_MAX_TEXTURES;
+
+	VkDescriptorPoolCreateInfo dp_create_info = {};
+	dp_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	dp_create_info.flags = registry->bindless ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT :
+		VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+	dp_create_info.maxSets = registry->bindless ? 1 : OG_MAX_TEXTURES;
+	dp_create_info.poolSizeCount = 1;
+	dp_create_info.pPoolSizes = &pool_size;
+
+	OG_CHECK_VK(vkCreateDescriptorPool(og_ctx->logical_device, &dp_create_info,
+				NULL, &batch->desc_pool), "Sprite Descriptor Pool Creation Failed");
+
+	if (registry->bindless) {
+		VkDescriptorSetAllocateInfo ds_alloc_info = {};
+		ds_alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		ds_alloc_info.descriptorPool = batch->desc_pool;
+		ds_alloc_info.descriptorSetCount = 1;
+		ds_alloc_info.pSetLayouts = &batch->set_layout;
+
+		OG_CHECK_VK(vkAllocateDescriptorSets(og_ctx->logical_device, &ds_alloc_info,
+					&registry->set), "Bindless Texture Set Allocation Failed");
+	}
+
+	// Device Local And Mappable Where The Device Offers It, Plain Host Memory Otherwise
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		if (!og_create_buffer(og_ctx, (VkDeviceSize)max_sprites * sizeof(OGSpriteInstance),
+					VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, OG_MEMORY_CPU_TO_GPU, &batch->instance_buffers[i])) {
+			OG_LOG_ERR("Sprite Instance Buffer Creation Failed");
+		}
+	}
+
+	// Untextured Sprites Sample This, So Every Draw Goes Through One Pipeline
+	uint8_t white[4] = { 255, 255, 255, 255 };
+	batch->white = og_create_texture(og_ctx, 1, 1, white);
+	og_upload_wait(og_ctx, batch->white->upload);
+}
+
+OG_INT void _destroy_sprite_batch(OGContext *og_ctx) {
+	OGSpriteBatch *batch = &og_ctx->sprites;
+
+	og_destroy_texture(og_ctx, batch->white);
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		og_destroy_buffer(og_ctx, &batch->instance_buffers[i]);
+	}
+
+	vkDestroyPipelineLayout(og_ctx->logical_device, batch->layout, NULL);
+	vkDestroyDescriptorSetLayout(og_ctx->logical_device, batch->set_layout, NULL);
+	vkDestroyDescriptorPool(og_ctx->logical_device, batch->desc_pool, NULL);
+	vkDestroySampler(og_ctx->logical_device, batch->sampler, NULL);
+
+	free(batch->instances);
+	free(batch->runs);
+	free(batch->sorted_runs);
+	free(batch->registry.free_ids);
+}
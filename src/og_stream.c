@@ -0,0 +1,367 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "origami/og_renderer.h"
+#include "origami/og_stream.h"
+
+#include <math.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+OG_INT void __stream_swap(OGStreamer *streamer, uint32_t a, uint32_t b) {
+	uint32_t slot = streamer->heap[a];
+	streamer->heap[a] = streamer->heap[b];
+	streamer->heap[b] = slot;
+	streamer->requests[streamer->heap[a]].heap_idx = a;
+	streamer->requests[streamer->heap[b]].heap_idx = b;
+}
+
+OG_INT void __stream_sift_up(OGStreamer *streamer, uint32_t pos) {
+	while (pos > 0) {
+		uint32_t parent = (pos - 1) / 2;
+		if (streamer->requests[streamer->heap[parent]].key <= streamer->requests[streamer->heap[pos]].key) {
+			break;
+		}
+		__stream_swap(streamer, pos, parent);
+		pos = parent;
+	}
+}
+
+OG_INT void __stream_sift_down(OGStreamer *streamer, uint32_t pos) {
+	for (;;) {
+		uint32_t least = pos;
+		uint32_t left = pos * 2 + 1;
+		uint32_t right = left + 1;
+
+		if (left < streamer->heap_count &&
+				streamer->requests[streamer->heap[left]].key < streamer->requests[streamer->heap[least]].key) {
+			least = left;
+		}
+		if (right < streamer->heap_count &&
+				streamer->requests[streamer->heap[right]].key < streamer->requests[streamer->heap[least]].key) {
+			least = right;
+		}
+		if (least == pos) {
+			return;
+		}
+		__stream_swap(streamer, pos, least);
+		pos = least;
+	}
+}
+
+// The Last Entry Fills The Hole And Moves Whichever Way Its Key Needs
+OG_INT void __stream_heap_remove(OGStreamer *streamer, uint32_t pos) {
+	uint32_t last = --streamer->heap_count;
+	if (pos == last) {
+		return;
+	}
+
+	streamer->heap[pos] = streamer->heap[last];
+	streamer->requests[streamer->heap[pos]].heap_idx = pos;
+	__stream_sift_down(streamer, pos);
+	__stream_sift_up(streamer, pos);
+}
+
+// The Placeholder Goes With It, It Never Owned Anything On The GPU
+OG_INT void __stream_free(OGStreamer *streamer, uint32_t slot) {
+	OGStreamRequest *request = &streamer->requests[slot];
+	free(request->texture);
+	if (request->state != OG_STREAM_FAILED) {
+		streamer->pending--;
+	}
+
+	memset(request, 0, sizeof(OGStreamRequest));
+	request->state = OG_STREAM_FREE;
+	request->heap_idx = streamer->free_head;
+	streamer->free_head = slot;
+}
+
+// Hands Out The Placeholder And Queues It, Keyed Before The Reader Can See It
+OG_INT OGTexture* __stream_push(OGContext *og_ctx, const OGPack *pack, const char* name,
+		bool positioned, float x, float y, float priority) {
+	OGStreamer *streamer = &og_ctx->stream;
+
+	const OGPackEntry *entry = og_pack_find(pack, name);
+	if (!entry || entry->type != OG_PACK_TEXTURE) {
+		OG_LOG_ERR("Pack Has No Such Texture");
+		return NULL;
+	}
+
+	OGTexture *texture = calloc(1, sizeof(OGTexture));
+	texture->width = entry->width;
+	texture->height = entry->height;
+	texture->upload = OG_STREAM_PENDING;
+
+	pthread_mutex_lock(&streamer->lock);
+
+	uint32_t slot = streamer->free_head;
+	if (slot != OG_STREAM_NONE) {
+		streamer->free_head = streamer->requests[slot].heap_idx;
+	} else {
+		if (streamer->request_count == streamer->request_capacity) {
+			streamer->request_capacity = streamer->request_capacity ? streamer->request_capacity * 2 : 64;
+			streamer->requests = realloc(streamer->requests, streamer->request_capacity * sizeof(OGStreamRequest));
+		}
+		slot = streamer->request_count++;
+	}
+
+	OGStreamRequest *request = &streamer->requests[slot];
+	memset(request, 0, sizeof(OGStreamRequest));
+	request->texture = texture;
+	request->pack = pack;
+	request->entry = entry;
+	request->hint = priority;
+	request->x = x;
+	request->y = y;
+	request->positioned = positioned;
+	request->key = positioned ? priority + hypotf(x - streamer->focus_x, y - streamer->focus_y) : priority;
+	request->state = OG_STREAM_QUEUED;
+	texture->stream = slot + 1;
+	streamer->pending++;
+
+	if (streamer->heap_count == streamer->heap_capacity) {
+		streamer->heap_capacity = streamer->heap_capacity ? streamer->heap_capacity * 2 : 64;
+		streamer->heap = realloc(streamer->heap, streamer->heap_capacity * sizeof(uint32_t));
+	}
+	request->heap_idx = streamer->heap_count;
+	streamer->heap[streamer->heap_count++] = slot;
+	__stream_sift_up(streamer, request->heap_idx);
+
+	pthread_cond_signal(&streamer->wake);
+	pthread_mutex_unlock(&streamer->lock);
+	return texture;
+}
+
+// Faults Every Page Of The Entry In, So The Main Thread's Copy Into Staging Never
+// Waits On The Disk. False When A Cancel Cut It Short
+OG_INT bool __stream_read(OGStreamer *streamer, const uint8_t *data, size_t size) {
+	const uint8_t *first_page = (const uint8_t*)((uintptr_t)data & ~(uintptr_t)(streamer->page_size - 1));
+	posix_madvise((void*)first_page, size + (size_t)(data - first_page), POSIX_MADV_WILLNEED);
+
+	volatile uint8_t sink = 0;
+	for (size_t offset = 0; offset < size; offset += streamer->page_size) {
+		if (offset % OG_STREAM_ABORT_STRIDE < streamer->page_size && atomic_load(&streamer->abort)) {
+			return false;
+		}
+		sink ^= data[offset];
+	}
+	if (size) {
+		sink ^= data[size - 1];
+	}
+	return true;
+}
+
+// Takes The Most Urgent Request, Pages It In Without Holding The Lock, Then Hands It To The Pump
+OG_INT void* __stream_main(void* data) {
+	OGStreamer *streamer = data;
+
+	pthread_mutex_lock(&streamer->lock);
+	while (!streamer->quit) {
+		if (!streamer->heap_count) {
+			pthread_cond_wait(&streamer->wake, &streamer->lock);
+			continue;
+		}
+
+		uint32_t slot = streamer->heap[0];
+		__stream_heap_remove(streamer, 0);
+
+		OGStreamRequest *request = &streamer->requests[slot];
+		request->state = OG_STREAM_READING;
+		streamer->reading = slot;
+		atomic_store(&streamer->abort, false);
+
+		const uint8_t *bytes = og_pack_data(request->pack, request->entry);
+		size_t size = request->entry->size;
+		pthread_mutex_unlock(&streamer->lock);
+
+		__stream_read(streamer, bytes, size);
+
+		pthread_mutex_lock(&streamer->lock);
+		streamer->reading = OG_STREAM_NONE;
+
+		// Cancelled Ones Still Go Through The Pump, Which Frees Them
+		if (streamer->ready_count == streamer->ready_capacity) {
+			streamer->ready_capacity = streamer->ready_capacity ? streamer->ready_capacity * 2 : 64;
+			streamer->ready = realloc(streamer->ready, streamer->ready_capacity * sizeof(uint32_t));
+		}
+		streamer->ready[streamer->ready_count++] = slot;
+		streamer->requests[slot].state = OG_STREAM_READY;
+	}
+	pthread_mutex_unlock(&streamer->lock);
+	return NULL;
+}
+
+
+OG_INT void _create_streamer(OGContext *og_ctx, uint64_t budget) {
+	OGStreamer *streamer = &og_ctx->stream;
+	memset(streamer, 0, sizeof(OGStreamer));
+
+	streamer->budget = budget;
+	streamer->free_head = OG_STREAM_NONE;
+	streamer->reading = OG_STREAM_NONE;
+	streamer->page_size = (size_t)sysconf(_SC_PAGESIZE);
+	atomic_init(&streamer->abort, false);
+
+	pthread_mutex_init(&streamer->lock, NULL);
+	pthread_cond_init(&streamer->wake, NULL);
+
+	if (pthread_create(&streamer->thread, NULL, __stream_main, streamer)) {
+		OG_LOG_ERR("Streaming Thread Creation Failed");
+		return;
+	}
+	streamer->running = true;
+}
+
+// Runs At The Top Of og_render: Frees What Was Cancelled And Turns Paged In Requests
+// Into Real Textures Until The Frame's Budget Is Spent. The First One Always Goes,
+// So Something Larger Than The Budget Still Makes Progress
+OG_INT void _pump_streamer(OGContext *og_ctx) {
+	OGStreamer *streamer = &og_ctx->stream;
+	streamer->bytes_last_frame = 0;
+
+	pthread_mutex_lock(&streamer->lock);
+	uint32_t kept = 0;
+
+	for (uint32_t i = 0; i < streamer->ready_count; i++) {
+		uint32_t slot = streamer->ready[i];
+		OGStreamRequest *request = &streamer->requests[slot];
+
+		if (request->cancelled) {
+			__stream_free(streamer, slot);
+			continue;
+		}
+
+		uint64_t size = request->entry->size;
+		if (streamer->bytes_last_frame && streamer->bytes_last_frame + size > streamer->budget) {
+			streamer->ready[kept++] = slot;
+			continue;
+		}
+
+		// The Placeholder Becomes The Real Texture In Place, So Every Pointer To It Stays Good
+		OGTexture *texture = request->texture;
+		if (!_upload_pack_texture(og_ctx, request->pack, request->entry, texture)) {
+			OG_LOG_ERR("Streamed Texture Could Not Be Created");
+			request->state = OG_STREAM_FAILED;
+			streamer->pending--;
+			continue;
+		}
+
+		streamer->bytes_last_frame += size;
+		streamer->textures_streamed++;
+		texture->stream = 0;
+		request->texture = NULL;
+		__stream_free(streamer, slot);
+	}
+
+	streamer->ready_count = kept;
+	pthread_mutex_unlock(&streamer->lock);
+}
+
+// Anything Not Yet Resident Is Dropped, Textures That Arrived Belong To The Caller
+OG_INT void _destroy_streamer(OGContext *og_ctx) {
+	OGStreamer *streamer = &og_ctx->stream;
+
+	if (streamer->running) {
+		pthread_mutex_lock(&streamer->lock);
+		streamer->quit = true;
+		atomic_store(&streamer->abort, true);
+		pthread_cond_broadcast(&streamer->wake);
+		pthread_mutex_unlock(&streamer->lock);
+		pthread_join(streamer->thread, NULL);
+	}
+
+	for (uint32_t i = 0; i < streamer->request_count; i++) {
+		free(streamer->requests[i].texture);
+	}
+
+	free(streamer->requests);
+	free(streamer->heap);
+	free(streamer->ready);
+	pthread_mutex_destroy(&streamer->lock);
+	pthread_cond_destroy(&streamer->wake);
+}
+
+
+OG_API OGTexture* og_stream_texture(OGContext *og_ctx, const OGPack *pack, const char* name, float priority) {
+	return __stream_push(og_ctx, pack, name, false, 0.0f, 0.0f, priority);
+}
+
+// Also Ordered By Distance To The Point Given To og_stream_focus, priority Is Added On Top
+OG_API OGTexture* og_stream_texture_at(OGContext *og_ctx, const OGPack *pack, const char* name,
+		float x, float y, float priority) {
+	return __stream_push(og_ctx, pack, name, true, x, y, priority);
+}
+
+OG_API void og_stream_prioritize(OGContext *og_ctx, OGTexture *texture, float priority) {
+	OGStreamer *streamer = &og_ctx->stream;
+	if (!texture->stream) {
+		return;
+	}
+
+	pthread_mutex_lock(&streamer->lock);
+	OGStreamRequest *request = &streamer->requests[texture->stream - 1];
+	request->hint = priority;
+
+	if (request->state == OG_STREAM_QUEUED) {
+		request->key = priority;
+		if (request->positioned) {
+			request->key += hypotf(request->x - streamer->focus_x, request->y - streamer->focus_y);
+		}
+		__stream_sift_down(streamer, request->heap_idx);
+		__stream_sift_up(streamer, request->heap_idx);
+	}
+	pthread_mutex_unlock(&streamer->lock);
+}
+
+// Usually The Camera, Re-keys Every Positioned Request Still Queued
+OG_API void og_stream_focus(OGContext *og_ctx, float x, float y) {
+	OGStreamer *streamer = &og_ctx->stream;
+
+	pthread_mutex_lock(&streamer->lock);
+	streamer->focus_x = x;
+	streamer->focus_y = y;
+
+	for (uint32_t i = 0; i < streamer->heap_count; i++) {
+		OGStreamRequest *request = &streamer->requests[streamer->heap[i]];
+		if (request->positioned) {
+			request->key = request->hint + hypotf(request->x - x, request->y - y);
+		}
+	}
+
+	// Rebuilt Bottom Up, Cheaper Than Moving Every Key On Its Own
+	for (uint32_t i = streamer->heap_count / 2; i-- > 0;) {
+		__stream_sift_down(streamer, i);
+	}
+	pthread_mutex_unlock(&streamer->lock);
+}
+
+// Queued Requests Go At Once, One Being Read Stops At Its Next Check. Textures
+// That Already Arrived Are Destroyed Like Any Other. Don't Use texture After This
+OG_API void og_stream_cancel(OGContext *og_ctx, OGTexture *texture) {
+	OGStreamer *streamer = &og_ctx->stream;
+
+	if (!texture->stream) {
+		og_destroy_texture(og_ctx, texture);
+		return;
+	}
+
+	pthread_mutex_lock(&streamer->lock);
+	uint32_t slot = texture->stream - 1;
+	OGStreamRequest *request = &streamer->requests[slot];
+
+	if (request->state == OG_STREAM_QUEUED || request->state == OG_STREAM_FAILED) {
+		if (request->state == OG_STREAM_QUEUED) {
+			__stream_heap_remove(streamer, request->heap_idx);
+		}
+		__stream_free(streamer, slot);
+	} else {
+		request->cancelled = true;
+		if (streamer->reading == slot) {
+			atomic_store(&streamer->abort, true);
+		}
+	}
+	streamer->requests_cancelled++;
+	pthread_mutex_unlock(&streamer->lock);
+}
@@ -0,0 +1,952 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_text.h"
+
+#include <math.h>
+
+#define OG_CURVE_STEPS 6 // Lines Per Quadratic Segment At OG_GLYPH_SDF_SIZE
+
+// TrueType Is Big Endian
+static inline uint16_t __read_u16(const uint8_t *p) {
+	return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+static inline int16_t __read_i16(const uint8_t *p) {
+	return (int16_t)__read_u16(p);
+}
+
+static inline uint32_t __read_u32(const uint8_t *p) {
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+// Malformed Sequences Decode To U+FFFD And Never Read Past The Terminator
+static inline uint32_t __next_codepoint(const uint8_t **str) {
+	const uint8_t *s = *str;
+	uint32_t cp = *s++;
+	uint32_t extra = 0;
+
+	if (cp >= 0xF0) {
+		cp &= 0x07;
+		extra = 3;
+	} else if (cp >= 0xE0) {
+		cp &= 0x0F;
+		extra = 2;
+	} else if (cp >= 0xC0) {
+		cp &= 0x1F;
+		extra = 1;
+	} else if (cp >= 0x80) {
+		cp = 0xFFFD;
+	}
+
+	for (uint32_t i = 0; i < extra; i++, s++) {
+		if ((*s & 0xC0) != 0x80) {
+			cp = 0xFFFD;
+			break;
+		}
+		cp = cp << 6 | (*s & 0x3F);
+	}
+
+	*str = s;
+	return cp;
+}
+
+OG_INT void __push_edge(OGTextSystem *text, float x0, float y0, float x1, float y1) {
+	if (text->edge_count == text->edge_capacity) {
+		text->edge_capacity *= 2;
+		text->edges = realloc(text->edges, text->edge_capacity * 4 * sizeof(float));
+	}
+
+	float *edge = &text->edges[text->edge_count++ * 4];
+	edge[0] = x0;
+	edge[1] = y0;
+	edge[2] = x1;
+	edge[3] = y1;
+}
+
+OG_INT void __push_curve(OGTextSystem *text, float x0, float y0, float cx, float cy, float x1, float y1) {
+	float px = x0;
+	float py = y0;
+
+	for (uint32_t i = 1; i <= OG_CURVE_STEPS; i++) {
+		float t = (float)i / OG_CURVE_STEPS;
+		float mt = 1.0f - t;
+		float x = mt * mt * x0 + 2.0f * mt * t * cx + t * t * x1;
+		float y = mt * mt * y0 + 2.0f * mt * t * cy + t * t * y1;
+		__push_edge(text, px, py, x, y);
+		px = x;
+		py = y;
+	}
+}
+
+OG_INT uint32_t __find_table(const OGFont *font, const char *tag, uint32_t min_size) {
+	uint16_t table_count = __read_u16(font->data + 4);
+	if (12 + (uint32_t)table_count * 16 > font->size) {
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < table_count; i++) {
+		const uint8_t *record = font->data + 12 + i * 16;
+		if (memcmp(record, tag, 4) != 0) {
+			continue;
+		}
+
+		uint32_t offset = __read_u32(record + 8);
+		uint32_t length = __read_u32(record + 12);
+		if (length < min_size || offset > font->size || length > font->size - offset) {
+			return 0;
+		}
+		return offset;
+	}
+	return 0;
+}
+
+OG_INT bool __glyph_range(const OGFont *font, uint32_t index, uint32_t *start, uint32_t *end) {
+	if (index >= font->glyph_count) {
+		return false;
+	}
+
+	if (font->long_loca) {
+		*start = __read_u32(font->data + font->loca + index * 4);
+		*end = __read_u32(font->data + font->loca + index * 4 + 4);
+	} else {
+		*start = __read_u16(font->data + font->loca + index * 2) * 2u;
+		*end = __read_u16(font->data + font->loca + index * 2 + 2) * 2u;
+	}
+
+	// Empty Glyphs Share Their Offset With The Next One
+	return *end > *start && font->glyf + *end <= font->size;
+}
+
+OG_INT float __glyph_advance(const OGFont *font, uint32_t index) {
+	if (index >= font->hmetric_count) {
+		index = font->hmetric_count - 1;
+	}
+	return __read_u16(font->data + font->hmtx + index * 4) / font->units_per_em;
+}
+
+
+// Finds The Tables Drawing Needs, A Unicode cmap And glyf Outlines. CFF Fonts Have No glyf
+OG_INT bool __parse_font(OGFont *font) {
+	if (font->size < 12) {
+		return false;
+	}
+
+	uint32_t head = __find_table(font, "head", 54);
+	uint32_t hhea = __find_table(font, "hhea", 36);
+	uint32_t maxp = __find_table(font, "maxp", 6);
+	uint32_t cmap = __find_table(font, "cmap", 4);
+	font->hmtx = __find_table(font, "hmtx", 4);
+	font->loca = __find_table(font, "loca", 2);
+	font->glyf = __find_table(font, "glyf", 0);
+
+	if (!head || !hhea || !maxp || !cmap || !font->hmtx || !font->loca || !font->glyf) {
+		return false;
+	}
+
+	font->units_per_em = __read_u16(font->data + head + 18);
+	font->long_loca = __read_i16(font->data + head + 50) != 0;
+	font->ascent = __read_i16(font->data + hhea + 4) / font->units_per_em;
+	font->descent = __read_i16(font->data + hhea + 6) / font->units_per_em;
+	font->line_gap = __read_i16(font->data + hhea + 8) / font->units_per_em;
+	font->hmetric_count = __read_u16(font->data + hhea + 34);
+	font->glyph_count = __read_u16(font->data + maxp + 4);
+
+	if (!font->units_per_em || !font->hmetric_count ||
+			font->loca + (font->glyph_count + 1u) * (font->long_loca ? 4u : 2u) > font->size ||
+			font->hmtx + font->hmetric_count * 4u > font->size) {
+		return false;
+	}
+
+	// Full Unicode (Format 12) When The Font Has It, The Basic Plane (Format 4) Otherwise
+	uint16_t subtable_count = __read_u16(font->data + cmap + 2);
+	for (uint32_t i = 0; i < subtable_count; i++) {
+		const uint8_t *record = font->data + cmap + 4 + i * 8;
+		if (record + 8 > font->data + font->size) {
+			break;
+		}
+
+		uint16_t platform = __read_u16(record);
+		uint16_t encoding = __read_u16(record + 2);
+		uint32_t offset = cmap + __read_u32(record + 4);
+		bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+		if (!unicode || offset + 16 > font->size) {
+			continue;
+		}
+
+		uint16_t format = __read_u16(font->data + offset);
+		if (format == 12 || (format == 4 && font->cmap_format != 12)) {
+			font->cmap = offset;
+			font->cmap_format = format;
+		}
+	}
+	return font->cmap != 0;
+}
+
+// 0 Is The Font's Missing Glyph
+OG_INT uint32_t __font_glyph_index(const OGFont *font, uint32_t codepoint) {
+	const uint8_t *sub = font->data + font->cmap;
+	const uint8_t *limit = font->data + font->size;
+
+	if (font->cmap_format == 12) {
+		uint32_t lo = 0;
+		uint32_t hi = __read_u32(sub + 12);
+		if (sub + 16 + (uint64_t)hi * 12 > limit) {
+			return 0;
+		}
+
+		while (lo < hi) {
+			uint32_t mid = (lo + hi) / 2;
+			const uint8_t *group = sub + 16 + mid * 12;
+			if (codepoint < __read_u32(group)) {
+				hi = mid;
+			} else if (codepoint > __read_u32(group + 4)) {
+				lo = mid + 1;
+			} else {
+				return __read_u32(group + 8) + (codepoint - __read_u32(group));
+			}
+		}
+		return 0;
+	}
+
+	if (codepoint > 0xFFFF) {
+		return 0;
+	}
+
+	uint32_t seg_count = __read_u16(sub + 6) / 2;
+	const uint8_t *ends = sub + 14;
+	const uint8_t *starts = ends + seg_count * 2 + 2;
+	const uint8_t *deltas = starts + seg_count * 2;
+	const uint8_t *ranges = deltas + seg_count * 2;
+	if (ranges + seg_count * 2 > limit) {
+		return 0;
+	}
+
+	// First Segment Ending At Or After The Codepoint
+	uint32_t lo = 0;
+	uint32_t hi = seg_count;
+	while (lo < hi) {
+		uint32_t mid = (lo + hi) / 2;
+		if (__read_u16(ends + mid * 2) < codepoint) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (lo == seg_count || __read_u16(starts + lo * 2) > codepoint) {
+		return 0;
+	}
+
+	uint16_t delta = __read_u16(deltas + lo * 2);
+	uint16_t range = __read_u16(ranges + lo * 2);
+	if (!range) {
+		return (codepoint + delta) & 0xFFFF;
+	}
+
+	const uint8_t *entry = ranges + lo * 2 + range + (codepoint - __read_u16(starts + lo * 2)) * 2;
+	if (entry + 2 > limit) {
+		return 0;
+	}
+
+	uint16_t index = __read_u16(entry);
+	return index ? (index + delta) & 0xFFFF : 0;
+}
+
+// Appends The Glyph's Contours To text->edges As Lines, In Font Units. Composite
+// Glyphs Place Their Parts By Offset, Scaled Components Are Drawn Unscaled.
+// Decoded Points Live In scratch, Which Is Only Rewound Between Frames
+OG_INT void __font_outline(OGTextSystem *text, OGArena *scratch, const OGFont *font, uint32_t index, float dx, float dy, uint32_t depth) {
+	uint32_t start = 0;
+	uint32_t end = 0;
+	if (depth > 4 || !__glyph_range(font, index, &start, &end) || end - start < 10) {
+		return;
+	}
+
+	const uint8_t *glyph = font->data + font->glyf + start;
+	const uint8_t *limit = font->data + font->glyf + end;
+	int16_t contour_count = __read_i16(glyph);
+
+	if (contour_count < 0) {
+		const uint8_t *p = glyph + 10;
+		uint16_t flags = 0;
+
+		do {
+			if (p + 8 > limit) {
+				return;
+			}
+
+			flags = __read_u16(p);
+			uint16_t component = __read_u16(p + 2);
+			p += 4;
+
+			float ox = 0.0f;
+			float oy = 0.0f;
+			if (flags & 0x0001) {
+				ox = __read_i16(p);
+				oy = __read_i16(p + 2);
+				p += 4;
+			} else {
+				ox = (int8_t)p[0];
+				oy = (int8_t)p[1];
+				p += 2;
+			}
+
+			// Without ARGS_ARE_XY_VALUES The Args Match Points, Which Isn't Supported
+			if (!(flags & 0x0002)) {
+				ox = 0.0f;
+				oy = 0.0f;
+			}
+
+			if (flags & 0x0008) {
+				p += 2;
+			} else if (flags & 0x0040) {
+				p += 4;
+			} else if (flags & 0x0080) {
+				p += 8;
+			}
+
+			__font_outline(text, scratch, font, component, dx + ox, dy + oy, depth + 1);
+		} while (flags & 0x0020);
+		return;
+	}
+
+	const uint8_t *ends = glyph + 10;
+	if (ends + contour_count * 2 + 2 > limit) {
+		return;
+	}
+
+	uint32_t point_count = contour_count ? __read_u16(ends + (contour_count - 1) * 2) + 1u : 0;
+	const uint8_t *p = ends + contour_count * 2;
+	p += 2 + __read_u16(p);
+	if (!point_count || p > limit) {
+		return;
+	}
+
+	float *xs = __arena_alloc(scratch, point_count * (2 * sizeof(float) + 1));
+	float *ys = xs + point_count;
+	uint8_t *flags = (uint8_t*)(ys + point_count);
+
+	// Flags Run Length Encoded, Then All x Deltas, Then All y Deltas. Every Read
+	// Is Checked Against The Glyph's End, A Short Array Drops The Whole Glyph
+	uint32_t flag_count = 0;
+	while (flag_count < point_count) {
+		if (p + 1 > limit) {
+			return;
+		}
+		uint8_t flag = *p++;
+		uint32_t repeat = 1;
+		if (flag & 0x08) {
+			if (p + 1 > limit) {
+				return;
+			}
+			repeat += *p++;
+		}
+		for (; repeat && flag_count < point_count; repeat--) {
+			flags[flag_count++] = flag;
+		}
+	}
+
+	float x = 0.0f;
+	for (uint32_t i = 0; i < point_count; i++) {
+		if (flags[i] & 0x02) {
+			if (p + 1 > limit) {
+				return;
+			}
+			x += (flags[i] & 0x10) ? p[0] : -p[0];
+			p += 1;
+		} else if (!(flags[i] & 0x10)) {
+			if (p + 2 > limit) {
+				return;
+			}
+			x += __read_i16(p);
+			p += 2;
+		}
+		xs[i] = x + dx;
+	}
+
+	float y = 0.0f;
+	for (uint32_t i = 0; i < point_count; i++) {
+		if (flags[i] & 0x04) {
+			if (p + 1 > limit) {
+				return;
+			}
+			y += (flags[i] & 0x20) ? p[0] : -p[0];
+			p += 1;
+		} else if (!(flags[i] & 0x20)) {
+			if (p + 2 > limit) {
+				return;
+			}
+			y += __read_i16(p);
+			p += 2;
+		}
+		ys[i] = y + dy;
+	}
+
+	// Two Off Curve Points In A Row Imply An On Curve One Halfway Between Them
+	uint32_t first = 0;
+	for (int16_t c = 0; c < contour_count; c++) {
+		uint32_t last = __read_u16(ends + c * 2);
+		if (last < first || last >= point_count) {
+			break;
+		}
+
+		uint32_t from = first;
+		uint32_t to = last;
+		float start_x = 0.0f;
+		float start_y = 0.0f;
+		if (flags[first] & 0x01) {
+			start_x = xs[first];
+			start_y = ys[first];
+			from = first + 1;
+		} else if (flags[last] & 0x01) {
+			start_x = xs[last];
+			start_y = ys[last];
+			to = last - 1;
+		} else {
+			start_x = (xs[first] + xs[last]) * 0.5f;
+			start_y = (ys[first] + ys[last]) * 0.5f;
+		}
+
+		float pen_x = start_x;
+		float pen_y = start_y;
+		bool control = false;
+		float cx = 0.0f;
+		float cy = 0.0f;
+
+		for (uint32_t i = from; i <= to && i <= last; i++) {
+			if (flags[i] & 0x01) {
+				if (control) {
+					__push_curve(text, pen_x, pen_y, cx, cy, xs[i], ys[i]);
+				} else {
+					__push_edge(text, pen_x, pen_y, xs[i], ys[i]);
+				}
+				pen_x = xs[i];
+				pen_y = ys[i];
+				control = false;
+			} else {
+				if (control) {
+					float mx = (cx + xs[i]) * 0.5f;
+					float my = (cy + ys[i]) * 0.5f;
+					__push_curve(text, pen_x, pen_y, cx, cy, mx, my);
+					pen_x = mx;
+					pen_y = my;
+				}
+				cx = xs[i];
+				cy = ys[i];
+				control = true;
+			}
+		}
+
+		if (control) {
+			__push_curve(text, pen_x, pen_y, cx, cy, start_x, start_y);
+		} else {
+			__push_edge(text, pen_x, pen_y, start_x, start_y);
+		}
+		first = last + 1;
+	}
+}
+
+// Edges In Pixels, y Up, (origin_x, origin_y) Being The Top Left Corner. Each Texel
+// Stores Its Distance To The Nearest Edge, Positive Inside By The Nonzero Rule,
+// Mapped So OG_GLYPH_SDF_RANGE Pixels Either Side Span The Whole Byte
+OG_INT void __rasterize_sdf(const float *edges, uint32_t edge_count, float origin_x, float origin_y,
+		uint8_t *dst, uint32_t width, uint32_t height) {
+	const float to_unit = 0.5f / OG_GLYPH_SDF_RANGE;
+	const float range2 = (float)(OG_GLYPH_SDF_RANGE * OG_GLYPH_SDF_RANGE);
+
+	for (uint32_t j = 0; j < height; j++) {
+		float py = origin_y - (float)j - 0.5f;
+
+		for (uint32_t i = 0; i < width; i++) {
+			float px = origin_x + (float)i + 0.5f;
+			float best = range2;
+			int32_t winding = 0;
+
+			for (uint32_t e = 0; e < edge_count; e++) {
+				const float *edge = &edges[e * 4];
+				float ex = edge[2] - edge[0];
+				float ey = edge[3] - edge[1];
+				float wx = px - edge[0];
+				float wy = py - edge[1];
+
+				// Crossings Of A Ray Towards +x
+				if ((edge[1] <= py) != (edge[3] <= py)) {
+					float cross_x = edge[0] + wy * ex / ey;
+					if (cross_x > px) {
+						winding += ey > 0.0f ? 1 : -1;
+					}
+				}
+
+				// Anything Further Than The Range Saturates, So Distant Edges Are Skipped
+				float lo_x = ex < 0.0f ? edge[2] : edge[0];
+				float hi_x = ex < 0.0f ? edge[0] : edge[2];
+				float lo_y = ey < 0.0f ? edge[3] : edge[1];
+				float hi_y = ey < 0.0f ? edge[1] : edge[3];
+				if (px < lo_x - OG_GLYPH_SDF_RANGE || px > hi_x + OG_GLYPH_SDF_RANGE ||
+						py < lo_y - OG_GLYPH_SDF_RANGE || py > hi_y + OG_GLYPH_SDF_RANGE) {
+					continue;
+				}
+
+				float len2 = ex * ex + ey * ey;
+				float t = len2 > 0.0f ? (wx * ex + wy * ey) / len2 : 0.0f;
+				t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+				float nx = wx - ex * t;
+				float ny = wy - ey * t;
+				float d2 = nx * nx + ny * ny;
+				best = d2 < best ? d2 : best;
+			}
+
+			float dist = sqrtf(best);
+			float value = 0.5f + (winding ? dist : -dist) * to_unit;
+			value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+			dst[j * width + i] = (uint8_t)(value * 255.0f + 0.5f);
+		}
+	}
+}
+
+// Looks The Codepoint Up, Rasterizing It On First Use. NULL Once The Font's Table Is Full
+OG_INT OGGlyph* __get_glyph(OGContext *og_ctx, OGFont *font, uint32_t codepoint) {
+	OGTextSystem *text = &og_ctx->text;
+
+	uint32_t mask = OG_FONT_GLYPH_SLOTS - 1;
+	uint32_t slot = (codepoint * 2654435761u) & mask;
+	OGGlyph *glyph = &font->glyphs[slot];
+
+	while (glyph->state != OG_GLYPH_EMPTY && glyph->codepoint != codepoint) {
+		slot = (slot + 1) & mask;
+		glyph = &font->glyphs[slot];
+	}
+
+	if (glyph->state == OG_GLYPH_EMPTY) {
+		// Kept Under Three Quarters Full So Probes Stay Short And Always End
+		if (font->glyphs_used >= OG_FONT_GLYPH_SLOTS / 4 * 3) {
+			return NULL;
+		}
+
+		glyph->codepoint = codepoint;
+		glyph->index = __font_glyph_index(font, codepoint);
+		glyph->advance = __glyph_advance(font, glyph->index);
+		glyph->state = OG_GLYPH_UNPLACED;
+		font->glyphs_used++;
+	}
+
+	if (glyph->state != OG_GLYPH_UNPLACED) {
+		return glyph;
+	}
+
+	// Out Of Time Or Staging Space This Frame, Tried Again When It Is Next Drawn
+	if (text->pending_count == OG_TEXT_GLYPHS_PER_FRAME) {
+		return glyph;
+	}
+
+	text->edge_count = 0;
+	__font_outline(text, &og_ctx->frame_arena, font, glyph->index, 0.0f, 0.0f, 0);
+	if (!text->edge_count) {
+		glyph->state = OG_GLYPH_BLANK;
+		return glyph;
+	}
+
+	float scale = OG_GLYPH_SDF_SIZE / font->units_per_em;
+	float min_x = 1e30f;
+	float min_y = 1e30f;
+	float max_x = -1e30f;
+	float max_y = -1e30f;
+
+	for (uint32_t i = 0; i < text->edge_count * 4; i += 2) {
+		float x = text->edges[i] *= scale;
+		float y = text->edges[i + 1] *= scale;
+		min_x = x < min_x ? x : min_x;
+		min_y = y < min_y ? y : min_y;
+		max_x = x > max_x ? x : max_x;
+		max_y = y > max_y ? y : max_y;
+	}
+
+	float origin_x = floorf(min_x) - OG_GLYPH_SDF_RANGE;
+	float origin_y = ceilf(max_y) + OG_GLYPH_SDF_RANGE;
+	uint32_t width = (uint32_t)(ceilf(max_x) + OG_GLYPH_SDF_RANGE - origin_x);
+	uint32_t height = (uint32_t)(origin_y - floorf(min_y) + OG_GLYPH_SDF_RANGE);
+
+	uint32_t offset = (text->pending_size + 3) & ~3u;
+	if (offset + width * height > OG_TEXT_UPLOAD_SIZE) {
+		return glyph;
+	}
+
+	if (text->shelf_x + width > OG_TEXT_ATLAS_SIZE) {
+		text->shelf_x = 0;
+		text->shelf_y += text->shelf_height + 1;
+		text->shelf_height = 0;
+	}
+
+	if (text->shelf_y + height > OG_TEXT_ATLAS_SIZE || width > OG_TEXT_ATLAS_SIZE) {
+		if (!text->atlas_full) {
+			OG_LOG_ERR("Glyph Atlas Full, New Glyphs Are Skipped");
+		}
+		text->atlas_full = true;
+		glyph->state = OG_GLYPH_BLANK;
+		return glyph;
+	}
+
+	__rasterize_sdf(text->edges, text->edge_count, origin_x, origin_y, text->pending + offset, width, height);
+
+	if (text->pending_count == text->pending_capacity) {
+		text->pending_capacity *= 2;
+		text->pending_copies = realloc(text->pending_copies, text->pending_capacity * sizeof(VkBufferImageCopy));
+	}
+
+	VkBufferImageCopy *copy = &text->pending_copies[text->pending_count++];
+	memset(copy, 0, sizeof(VkBufferImageCopy));
+	copy->bufferOffset = offset;
+	copy->imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	copy->imageSubresource.layerCount = 1;
+	copy->imageOffset.x = (int32_t)text->shelf_x;
+	copy->imageOffset.y = (int32_t)text->shelf_y;
+	copy->imageExtent.width = width;
+	copy->imageExtent.height = height;
+	copy->imageExtent.depth = 1;
+	text->pending_size = offset + width * height;
+
+	const float em = 1.0f / OG_GLYPH_SDF_SIZE;
+	const float texel = 1.0f / OG_TEXT_ATLAS_SIZE;
+	glyph->x0 = origin_x * em;
+	glyph->x1 = (origin_x + width) * em;
+	glyph->y0 = -origin_y * em;
+	glyph->y1 = (height - origin_y) * em;
+	glyph->u0 = text->shelf_x * texel;
+	glyph->v0 = text->shelf_y * texel;
+	glyph->u1 = (text->shelf_x + width) * texel;
+	glyph->v1 = (text->shelf_y + height) * texel;
+	glyph->state = OG_GLYPH_READY;
+
+	text->shelf_x += width + 1;
+	text->shelf_height = height > text->shelf_height ? height : text->shelf_height;
+	text->glyphs_rasterized++;
+	return glyph;
+}
+
+// Returns The String's Cached Layout, Laying It Out Again Only When It Was Evicted
+// Or The Last Layout Was Missing Glyphs
+OG_INT OGTextRun* __get_run(OGContext *og_ctx, OGFont *font, const char *str) {
+	OGTextSystem *text = &og_ctx->text;
+
+	// FNV-1a, Seeded With The Font So The Same String In Two Fonts Gets Two Runs
+	uint64_t hash = 14695981039346656037ull ^ (uint64_t)(uintptr_t)font;
+	const char *c = str;
+	while (*c) {
+		hash ^= (uint8_t)*c++;
+		hash *= 1099511628211ull;
+	}
+	uint32_t length = (uint32_t)(c - str);
+
+	OGTextRun *set = &text->runs[(hash ^ hash >> 32) & (OG_TEXT_RUN_SLOTS - OG_TEXT_RUN_WAYS)];
+	OGTextRun *run = set;
+	bool hit = false;
+
+	for (uint32_t i = 0; i < OG_TEXT_RUN_WAYS && !hit; i++) {
+		OGTextRun *way = &set[i];
+		hit = way->hash == hash && way->font == font && way->length == length && !memcmp(way->text, str, length);
+		run = hit || way->last_used < run->last_used ? way : run;
+	}
+
+	run->last_used = ++text->run_clock;
+	if (hit && run->complete) {
+		text->runs_reused++;
+		return run;
+	}
+
+	if (run->text_capacity < length + 1) {
+		run->text_capacity = length + 1;
+		run->text = realloc(run->text, run->text_capacity);
+	}
+	memcpy(run->text, str, length + 1);
+
+	// One Quad Per Byte At Most
+	if (run->capacity < length) {
+		run->capacity = length;
+		run->quads = realloc(run->quads, run->capacity * sizeof(OGGlyphQuad));
+	}
+
+	run->hash = hash;
+	run->font = font;
+	run->length = length;
+	run->count = 0;
+	run->width = 0.0f;
+	run->complete = true;
+
+	float line_height = font->ascent - font->descent + font->line_gap;
+	float pen_x = 0.0f;
+	float pen_y = font->ascent;
+
+	const uint8_t *s = (const uint8_t*)str;
+	while (*s) {
+		uint32_t codepoint = __next_codepoint(&s);
+		if (codepoint == '\n') {
+			run->width = pen_x > run->width ? pen_x : run->width;
+			pen_x = 0.0f;
+			pen_y += line_height;
+			continue;
+		}
+
+		OGGlyph *glyph = __get_glyph(og_ctx, font, codepoint);
+		if (!glyph) {
+			continue;
+		}
+
+		if (glyph->state == OG_GLYPH_READY) {
+			OGGlyphQuad *quad = &run->quads[run->count++];
+			quad->x0 = pen_x + glyph->x0;
+			quad->y0 = pen_y + glyph->y0;
+			quad->x1 = pen_x + glyph->x1;
+			quad->y1 = pen_y + glyph->y1;
+			quad->u0 = glyph->u0;
+			quad->v0 = glyph->v0;
+			quad->u1 = glyph->u1;
+			quad->v1 = glyph->v1;
+		} else if (glyph->state == OG_GLYPH_UNPLACED) {
+			run->complete = false;
+		}
+		pen_x += glyph->advance;
+	}
+
+	run->width = pen_x > run->width ? pen_x : run->width;
+	run->height = pen_y - font->descent;
+	text->runs_shaped++;
+	return run;
+}
+
+OG_INT void __atlas_barrier(VkCommandBuffer cmd_buffer, VkImage image, VkImageLayout old_layout,
+		VkImageLayout new_layout, VkAccessFlags src_access, VkAccessFlags dst_access,
+		VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage) {
+	VkImageMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.oldLayout = old_layout;
+	barrier.newLayout = new_layout;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = image;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.levelCount = 1;
+	barrier.subresourceRange.layerCount = 1;
+	barrier.srcAccessMask = src_access;
+	barrier.dstAccessMask = dst_access;
+
+	vkCmdPipelineBarrier(cmd_buffer, src_stage, dst_stage, 0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+
+OG_API OGFont* og_load_font(OGContext *og_ctx, const char* path) {
+	(void)og_ctx;
+
+	FILE *file = fopen(path, "rb");
+	if (!file) {
+		OG_LOG_ERR("Font File Could Not Be Opened");
+		return NULL;
+	}
+
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	OGFont *font = calloc(1, sizeof(OGFont));
+	font->size = size > 0 ? (uint32_t)size : 0;
+	font->data = malloc(font->size ? font->size : 1);
+	bool read = fread(font->data, 1, font->size, file) == font->size;
+	fclose(file);
+
+	if (!read || !__parse_font(font)) {
+		OG_LOG_ERR("Font Parsing Failed, Only TrueType Outlines Are Supported");
+		free(font->data);
+		free(font);
+		return NULL;
+	}
+	return font;
+}
+
+// Its Glyphs Keep Their Atlas Space, Which Is Only Reclaimed By og_quit
+OG_API void og_destroy_font(OGContext *og_ctx, OGFont *font) {
+	OGTextSystem *text = &og_ctx->text;
+
+	for (uint32_t i = 0; i < OG_TEXT_RUN_SLOTS; i++) {
+		if (text->runs[i].font == font) {
+			text->runs[i].font = NULL;
+			text->runs[i].complete = false;
+		}
+	}
+
+	free(font->data);
+	free(font);
+}
+
+// Replays The Cached Run Straight Into The Sprite Batch, All Text Sharing The
+// Atlas And Layer, So A Frame's Labels Usually End Up In A Single Draw
+OG_API void og_draw_text(OGContext *og_ctx, OGFont *font, const char* str, float x, float y,
+		float size, VkClearColorValue color) {
+	OGTextRun *run = __get_run(og_ctx, font, str);
+	if (!run->count) {
+		return;
+	}
+
+	OGSpriteInstance *instance = _reserve_sprites(og_ctx, og_ctx->text.atlas, OG_OVERLAY_LAYER, run->count);
+	if (!instance) {
+		return;
+	}
+
+	uint32_t packed = __pack_color(color);
+	float half = size * 0.5f;
+
+	for (uint32_t i = 0; i < run->count; i++, instance++) {
+		const OGGlyphQuad *quad = &run->quads[i];
+		instance->pos[0] = x + (quad->x0 + quad->x1) * half;
+		instance->pos[1] = y + (quad->y0 + quad->y1) * half;
+		instance->size[0] = (quad->x1 - quad->x0) * size;
+		instance->size[1] = (quad->y1 - quad->y0) * size;
+		instance->uv[0] = quad->u0;
+		instance->uv[1] = quad->v0;
+		instance->uv[2] = quad->u1;
+		instance->uv[3] = quad->v1;
+		instance->color = packed;
+		instance->rotation = 0.0f;
+		instance->sdf = 1.0f;
+	}
+}
+
+OG_API void og_measure_text(OGContext *og_ctx, OGFont *font, const char* str, float size, float *w, float *h) {
+	OGTextRun *run = __get_run(og_ctx, font, str);
+	if (w) {
+		*w = run->width * size;
+	}
+	if (h) {
+		*h = run->height * size;
+	}
+}
+
+
+// Copies Last Frame's New Glyphs Into The Atlas, Recorded Ahead Of Every Pass So
+// They Can Be Sampled Anywhere In The Frame
+OG_INT void _flush_glyphs(OGContext *og_ctx) {
+	OGTextSystem *text = &og_ctx->text;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+
+	if (!text->pending_count) {
+		return;
+	}
+
+	OGBuffer *staging = &text->staging[og_ctx->frame_idx];
+	memcpy(staging->alloc.mapped, text->pending, text->pending_size);
+
+	__atlas_barrier(cmd_buffer, text->atlas->image.image,
+			VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			0, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+	vkCmdCopyBufferToImage(cmd_buffer, staging->buffer, text->atlas->image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, text->pending_count, text->pending_copies);
+
+	__atlas_barrier(cmd_buffer, text->atlas->image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+	text->pending_size = 0;
+	text->pending_count = 0;
+}
+
+OG_INT void _create_text_system(OGContext *og_ctx) {
+	OGTextSystem *text = &og_ctx->text;
+
+	text->atlas = calloc(1, sizeof(OGTexture));
+	text->atlas->width = OG_TEXT_ATLAS_SIZE;
+	text->atlas->height = OG_TEXT_ATLAS_SIZE;
+	_acquire_texture_id(og_ctx, text->atlas);
+
+	// Only Ever Touched On The Graphics Queue, Unlike Uploaded Textures
+	VkImageCreateInfo img_create_info = {};
+	img_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	img_create_info.imageType = VK_IMAGE_TYPE_2D;
+	img_create_info.format = VK_FORMAT_R8_UNORM;
+	img_create_info.extent.width = OG_TEXT_ATLAS_SIZE;
+	img_create_info.extent.height = OG_TEXT_ATLAS_SIZE;
+	img_create_info.extent.depth = 1;
+	img_create_info.mipLevels = 1;
+	img_create_info.arrayLayers = 1;
+	img_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+	img_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	img_create_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	img_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	img_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	if (!og_create_image(og_ctx, &img_create_info, OG_MEMORY_GPU_ONLY, &text->atlas->image)) {
+		OG_LOG_ERR("Glyph Atlas Creation Failed");
+	}
+
+	VkImageViewCreateInfo iv_create_info = {};
+	iv_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	iv_create_info.image = text->atlas->image.image;
+	iv_create_info.format = img_create_info.format;
+	iv_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	iv_create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	iv_create_info.subresourceRange.layerCount = 1;
+	iv_create_info.subresourceRange.levelCount = 1;
+
+	OG_CHECK_VK(vkCreateImageView(og_ctx->logical_device, &iv_create_info,
+				NULL, &text->atlas->view), "Glyph Atlas View Creation Failed");
+
+	_create_texture_set(og_ctx, text->atlas);
+
+	// Cleared Up Front, Glyphs Drawn Before Their Copy Lands Sample Empty Space
+	VkClearColorValue clear = {};
+	VkImageSubresourceRange range = {};
+	range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	range.levelCount = 1;
+	range.layerCount = 1;
+
+	VkCommandBuffer cmd_buffer = __begin_one_shot(og_ctx);
+	__atlas_barrier(cmd_buffer, text->atlas->image.image,
+			VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			0, VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+	vkCmdClearColorImage(cmd_buffer, text->atlas->image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			&clear, 1, &range);
+	__atlas_barrier(cmd_buffer, text->atlas->image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	__end_one_shot(og_ctx, cmd_buffer);
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		if (!og_create_buffer(og_ctx, OG_TEXT_UPLOAD_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+					OG_MEMORY_CPU_TO_GPU, &text->staging[i])) {
+			OG_LOG_ERR("Glyph Staging Buffer Creation Failed");
+		}
+	}
+
+	text->pending = malloc(OG_TEXT_UPLOAD_SIZE);
+	text->pending_capacity = 64;
+	text->pending_copies = malloc(text->pending_capacity * sizeof(VkBufferImageCopy));
+	text->edge_capacity = 256;
+	text->edges = malloc(text->edge_capacity * 4 * sizeof(float));
+	text->runs = calloc(OG_TEXT_RUN_SLOTS, sizeof(OGTextRun));
+}
+
+OG_INT void _destroy_text_system(OGContext *og_ctx) {
+	OGTextSystem *text = &og_ctx->text;
+
+	og_destroy_texture(og_ctx, text->atlas);
+
+	for (uint32_t i = 0; i < og_ctx->frame_count; i++) {
+		og_destroy_buffer(og_ctx, &text->staging[i]);
+	}
+
+	for (uint32_t i = 0; i < OG_TEXT_RUN_SLOTS; i++) {
+		free(text->runs[i].text);
+		free(text->runs[i].quads);
+	}
+
+	free(text->runs);
+	free(text->edges);
+	free(text->pending);
+	free(text->pending_copies);
+}
@@ -0,0 +1,421 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_tilemap.h"
+
+#include <math.h>
+#include <stddef.h>
+
+static const uint32_t tile_vert_spv[] =
+#include "shaders/tile.vert.inc"
+;
+
+static const uint32_t sprite_frag_spv[] =
+#include "shaders/sprite.frag.inc"
+;
+
+static const uint32_t sprite_bindless_frag_spv[] =
+#include "shaders/sprite_bindless.frag.inc"
+;
+
+#define OG_TILEMAP_HALF_BYTES ((VkDeviceSize)OG_TILEMAP_CHUNK_TILES * sizeof(uint32_t))
+
+// Holds OG_TILEMAP_PAGE_CHUNKS Chunks, Both Halves Each
+OG_INT bool __create_tile_page(OGContext *og_ctx, OGBuffer *out) {
+	VkBufferCreateInfo buf_create_info = {};
+	buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buf_create_info.size = OG_TILEMAP_PAGE_CHUNKS * 2 * OG_TILEMAP_HALF_BYTES;
+	buf_create_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	buf_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	// Written On The Transfer Queue, Read On The Graphics One
+	if (og_ctx->upload.concurrent) {
+		buf_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		buf_create_info.queueFamilyIndexCount = 2;
+		buf_create_info.pQueueFamilyIndices = og_ctx->upload.families;
+	}
+
+	memset(out, 0, sizeof(OGBuffer));
+	OG_CHECK_VK(vkCreateBuffer(og_ctx->logical_device, &buf_create_info,
+				NULL, &out->buffer), "Tile Page Creation Failed");
+	out->size = buf_create_info.size;
+
+	VkMemoryRequirements mem_reqs = {};
+	vkGetBufferMemoryRequirements(og_ctx->logical_device, out->buffer, &mem_reqs);
+
+	if (!_mem_alloc(og_ctx, &mem_reqs, OG_MEMORY_GPU_ONLY, OG_ALLOC_FREE_LIST, false, &out->alloc)) {
+		vkDestroyBuffer(og_ctx->logical_device, out->buffer, NULL);
+		out->buffer = VK_NULL_HANDLE;
+		return false;
+	}
+
+	OG_CHECK_VK(vkBindBufferMemory(og_ctx->logical_device, out->buffer,
+				out->alloc.memory, out->alloc.offset), "Buffer Memory Bind Failed");
+	return true;
+}
+
+// Packs The Chunk's Tiles Into The Half Not Being Drawn. False When Nothing Was
+// Uploaded, Either Because The Chunk Is Empty Or Because It Has To Wait
+OG_INT bool __rebuild_chunk(OGContext *og_ctx, OGTilemap *map, uint32_t cx, uint32_t cy) {
+	OGTilemapChunk *chunk = &map->chunks[cy * map->chunks_x + cx];
+	if (chunk->pending) {
+		return false;
+	}
+
+	uint32_t packed[OG_TILEMAP_CHUNK_TILES];
+	uint32_t count = 0;
+
+	uint32_t x0 = cx * OG_TILEMAP_CHUNK;
+	uint32_t y0 = cy * OG_TILEMAP_CHUNK;
+	uint32_t w = map->width - x0 < OG_TILEMAP_CHUNK ? map->width - x0 : OG_TILEMAP_CHUNK;
+	uint32_t h = map->height - y0 < OG_TILEMAP_CHUNK ? map->height - y0 : OG_TILEMAP_CHUNK;
+
+	for (uint32_t y = 0; y < h; y++) {
+		const uint16_t *row = map->tiles + (size_t)(y0 + y) * map->width + x0;
+		for (uint32_t x = 0; x < w; x++) {
+			if (row[x]) {
+				packed[count++] = OG_TILE_PACK(x, y, row[x] - 1);
+			}
+		}
+	}
+
+	// Nothing Left To Draw, Which Needs No Upload
+	if (!count) {
+		chunk->counts[chunk->shown] = 0;
+		chunk->dirty = false;
+		return false;
+	}
+
+	// The Other Half Was Drawn By A Frame The GPU May Still Be Reading
+	uint32_t back = 1 - chunk->shown;
+	if (chunk->drawn[back] && chunk->drawn[back] + og_ctx->frame_count > og_ctx->frame_number + 1) {
+		return false;
+	}
+
+	if (chunk->slot == OG_TILEMAP_NONE) {
+		if (map->slot_count == map->page_count * OG_TILEMAP_PAGE_CHUNKS) {
+			map->pages = realloc(map->pages, (map->page_count + 1) * sizeof(OGBuffer));
+			if (!__create_tile_page(og_ctx, &map->pages[map->page_count])) {
+				OG_LOG_ERR("Tile Page Allocation Failed");
+				return false;
+			}
+			map->page_count++;
+		}
+		chunk->slot = map->slot_count++;
+	}
+
+	OGBuffer *page = &map->pages[chunk->slot / OG_TILEMAP_PAGE_CHUNKS];
+	VkDeviceSize offset = ((chunk->slot % OG_TILEMAP_PAGE_CHUNKS) * 2 + back) * OG_TILEMAP_HALF_BYTES;
+
+	OGUploadToken token = og_upload_buffer(og_ctx, page->buffer, offset, packed, count * sizeof(uint32_t));
+	if (!token) {
+		return false;
+	}
+
+	chunk->counts[back] = count;
+	chunk->upload = token;
+	chunk->pending = true;
+	chunk->dirty = false;
+	return true;
+}
+
+
+OG_INT void _create_tile_renderer(OGContext *og_ctx) {
+	OGTileRenderer *tr = &og_ctx->tiles;
+
+	// Same Texture Sets As Sprites, Or The Same Bindless Array, Any Texture Can Be A Tileset
+	VkPushConstantRange push_range = {};
+	push_range.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	push_range.offset = 0;
+	push_range.size = sizeof(OGTilePush);
+
+	VkPipelineLayoutCreateInfo pl_create_info = {};
+	pl_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pl_create_info.setLayoutCount = 1;
+	pl_create_info.pSetLayouts = &og_ctx->sprites.set_layout;
+	pl_create_info.pushConstantRangeCount = 1;
+	pl_create_info.pPushConstantRanges = &push_range;
+
+	OG_CHECK_VK(vkCreatePipelineLayout(og_ctx->logical_device, &pl_create_info,
+				NULL, &tr->layout), "Tile Pipeline Layout Creation Failed");
+
+	VkShaderModule vert_module = og_get_shader_module(og_ctx, tile_vert_spv, sizeof(tile_vert_spv));
+	VkShaderModule frag_module = og_ctx->descriptor_indexing ?
+		og_get_shader_module(og_ctx, sprite_bindless_frag_spv, sizeof(sprite_bindless_frag_spv)) :
+		og_get_shader_module(og_ctx, sprite_frag_spv, sizeof(sprite_frag_spv));
+
+	VkPipelineShaderStageCreateInfo stages[2] = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+	stages[0].module = vert_module;
+	stages[0].pName = "main";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = frag_module;
+	stages[1].pName = "main";
+
+	// Four Bytes Per Tile, Everything Else Comes From Push Constants
+	VkVertexInputBindingDescription vi_binding = {};
+	vi_binding.binding = 0;
+	vi_binding.stride = sizeof(uint32_t);
+	vi_binding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+	VkVertexInputAttributeDescription vi_attribute = {};
+	vi_attribute.location = 0;
+	vi_attribute.binding = 0;
+	vi_attribute.format = VK_FORMAT_R32_UINT;
+	vi_attribute.offset = 0;
+
+	VkPipelineVertexInputStateCreateInfo vi_state = {};
+	vi_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+	vi_state.vertexBindingDescriptionCount = 1;
+	vi_state.pVertexBindingDescriptions = &vi_binding;
+	vi_state.vertexAttributeDescriptionCount = 1;
+	vi_state.pVertexAttributeDescriptions = &vi_attribute;
+
+	VkPipelineInputAssemblyStateCreateInfo ia_state = {};
+	ia_state.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+	ia_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+	VkPipelineViewportStateCreateInfo vp_state = {};
+	vp_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+	vp_state.viewportCount = 1;
+	vp_state.scissorCount = 1;
+
+	VkPipelineRasterizationStateCreateInfo rs_state = {};
+	rs_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+	rs_state.polygonMode = VK_POLYGON_MODE_FILL;
+	rs_state.cullMode = VK_CULL_MODE_NONE;
+	rs_state.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	rs_state.lineWidth = 1.0f;
+
+	VkPipelineMultisampleStateCreateInfo ms_state = {};
+	ms_state.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+	ms_state.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+	VkPipelineColorBlendAttachmentState blend_attachment = {};
+	blend_attachment.blendEnable = VK_TRUE;
+	blend_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+	blend_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+	blend_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+	blend_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+	blend_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+		VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+	VkPipelineColorBlendStateCreateInfo cb_state = {};
+	cb_state.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+	cb_state.attachmentCount = 1;
+	cb_state.pAttachments = &blend_attachment;
+
+	VkDynamicState dynamic_states[] = {
+		VK_DYNAMIC_STATE_VIEWPORT,
+		VK_DYNAMIC_STATE_SCISSOR,
+	};
+
+	VkPipelineDynamicStateCreateInfo dyn_state = {};
+	dyn_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+	dyn_state.dynamicStateCount = OG_ARR_SIZE(dynamic_states);
+	dyn_state.pDynamicStates = dynamic_states;
+
+	VkGraphicsPipelineCreateInfo gp_create_info = {};
+	gp_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+	gp_create_info.stageCount = OG_ARR_SIZE(stages);
+	gp_create_info.pStages = stages;
+	gp_create_info.pVertexInputState = &vi_state;
+	gp_create_info.pInputAssemblyState = &ia_state;
+	gp_create_info.pViewportState = &vp_state;
+	gp_create_info.pRasterizationState = &rs_state;
+	gp_create_info.pMultisampleState = &ms_state;
+	gp_create_info.pColorBlendState = &cb_state;
+	gp_create_info.pDynamicState = &dyn_state;
+	gp_create_info.layout = tr->layout;
+	gp_create_info.renderPass = og_ctx->render_pass;
+	gp_create_info.subpass = 0;
+
+	tr->pipeline = og_get_graphics_pipeline(og_ctx, &gp_create_info);
+}
+
+OG_INT void _destroy_tile_renderer(OGContext *og_ctx) {
+	vkDestroyPipelineLayout(og_ctx->logical_device, og_ctx->tiles.layout, NULL);
+}
+
+
+OG_API OGTilemap* og_create_tilemap(OGContext *og_ctx, uint32_t width, uint32_t height, float tile_size,
+		OGTexture *tileset, uint32_t columns) {
+	// Kept For Symmetry With og_destroy_tilemap, Nothing Touches The GPU Until The First Draw
+	(void)og_ctx;
+
+	OGTilemap *map = calloc(1, sizeof(OGTilemap));
+	map->width = width;
+	map->height = height;
+	map->tile_size = tile_size;
+	map->tiles = calloc((size_t)width * height, sizeof(uint16_t));
+	map->tileset = tileset;
+	map->columns = columns ? columns : 1;
+
+	// Every Chunk Starts Dirty, So Each Is Built The First Time It Is Seen
+	map->chunks_x = (width + OG_TILEMAP_CHUNK - 1) / OG_TILEMAP_CHUNK;
+	map->chunks_y = (height + OG_TILEMAP_CHUNK - 1) / OG_TILEMAP_CHUNK;
+	map->chunks = calloc((size_t)map->chunks_x * map->chunks_y, sizeof(OGTilemapChunk));
+	for (uint32_t i = 0; i < map->chunks_x * map->chunks_y; i++) {
+		map->chunks[i].slot = OG_TILEMAP_NONE;
+		map->chunks[i].dirty = true;
+	}
+	return map;
+}
+
+OG_API void og_destroy_tilemap(OGContext *og_ctx, OGTilemap *map) {
+	// Uploads And Frames Still In Flight May Touch The Pages, Not Meant For The Hot Path
+	for (uint32_t i = 0; i < map->chunks_x * map->chunks_y; i++) {
+		if (map->chunks[i].pending) {
+			og_upload_wait(og_ctx, map->chunks[i].upload);
+		}
+	}
+	OG_CHECK_VK(vkDeviceWaitIdle(og_ctx->logical_device), "Device Wait Idle Failed");
+
+	for (uint32_t i = 0; i < map->page_count; i++) {
+		og_destroy_buffer(og_ctx, &map->pages[i]);
+	}
+	free(map->pages);
+	free(map->chunks);
+	free(map->tiles);
+	free(map);
+}
+
+OG_API void og_set_tile(OGTilemap *map, uint32_t x, uint32_t y, uint16_t tile) {
+	if (x >= map->width || y >= map->height) {
+		return;
+	}
+
+	uint16_t *dst = &map->tiles[(size_t)y * map->width + x];
+	if (*dst != tile) {
+		*dst = tile;
+		map->chunks[(y / OG_TILEMAP_CHUNK) * map->chunks_x + x / OG_TILEMAP_CHUNK].dirty = true;
+	}
+}
+
+OG_API uint16_t og_get_tile(const OGTilemap *map, uint32_t x, uint32_t y) {
+	if (x >= map->width || y >= map->height) {
+		return 0;
+	}
+	return map->tiles[(size_t)y * map->width + x];
+}
+
+// Row Major w By h Block, Clipped To The Map
+OG_API void og_set_tiles(OGTilemap *map, uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint16_t *tiles) {
+	// An Empty Block Would Wrap The Last Chunk Index Below Around
+	if (!w || !h || x >= map->width || y >= map->height) {
+		return;
+	}
+
+	uint32_t cw = map->width - x < w ? map->width - x : w;
+	uint32_t ch = map->height - y < h ? map->height - y : h;
+
+	for (uint32_t row = 0; row < ch; row++) {
+		memcpy(&map->tiles[(size_t)(y + row) * map->width + x], tiles + (size_t)row * w, cw * sizeof(uint16_t));
+	}
+
+	for (uint32_t cy = y / OG_TILEMAP_CHUNK; cy <= (y + ch - 1) / OG_TILEMAP_CHUNK; cy++) {
+		for (uint32_t cx = x / OG_TILEMAP_CHUNK; cx <= (x + cw - 1) / OG_TILEMAP_CHUNK; cx++) {
+			map->chunks[cy * map->chunks_x + cx].dirty = true;
+		}
+	}
+}
+
+OG_API void og_draw_tilemap(OGContext *og_ctx, OGTilemap *map, float cam_x, float cam_y, float zoom) {
+	OGTileRenderer *tr = &og_ctx->tiles;
+	VkCommandBuffer cmd_buffer = og_ctx->curr_cmd_buffer;
+
+	map->chunks_drawn = 0;
+	map->chunks_rebuilt = 0;
+	map->tiles_drawn = 0;
+
+	if (zoom <= 0.0f) {
+		zoom = 1.0f;
+	}
+
+	VkViewport viewport = {};
+	viewport.width = (float)og_ctx->curr_extent.width;
+	viewport.height = (float)og_ctx->curr_extent.height;
+	viewport.maxDepth = 1.0f;
+
+	// Chunks Overlapping The View, Clamped To The Map
+	float chunk_size = map->tile_size * OG_TILEMAP_CHUNK;
+	float x0 = floorf(cam_x / chunk_size);
+	float y0 = floorf(cam_y / chunk_size);
+	float x1 = floorf((cam_x + viewport.width / zoom) / chunk_size);
+	float y1 = floorf((cam_y + viewport.height / zoom) / chunk_size);
+
+	if (x1 < 0.0f || y1 < 0.0f || x0 >= (float)map->chunks_x || y0 >= (float)map->chunks_y) {
+		return;
+	}
+
+	uint32_t cx0 = x0 < 0.0f ? 0 : (uint32_t)x0;
+	uint32_t cy0 = y0 < 0.0f ? 0 : (uint32_t)y0;
+	uint32_t cx1 = x1 >= (float)map->chunks_x ? map->chunks_x - 1 : (uint32_t)x1;
+	uint32_t cy1 = y1 >= (float)map->chunks_y ? map->chunks_y - 1 : (uint32_t)y1;
+
+	// Until The Tileset Lands, Chunks Still Build But Nothing Is Drawn
+	bool ready = map->tileset->upload <= og_ctx->upload.completed;
+
+	if (ready) {
+		VkRect2D scissor = og_ctx->curr_scissor;
+
+		OGTilePush push = {};
+		push.scale[0] = 2.0f * zoom / viewport.width;
+		push.scale[1] = 2.0f * zoom / viewport.height;
+		push.offset[0] = -1.0f - cam_x * push.scale[0];
+		push.offset[1] = -1.0f - cam_y * push.scale[1];
+		push.tile_size = map->tile_size;
+		push.columns = map->columns;
+		push.cell[0] = map->tile_size / (float)map->tileset->width;
+		push.cell[1] = map->tile_size / (float)map->tileset->height;
+		push.inset[0] = 0.5f / (float)map->tileset->width;
+		push.inset[1] = 0.5f / (float)map->tileset->height;
+		push.tileset = map->tileset->id;
+
+		vkCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, tr->pipeline);
+		vkCmdSetViewport(cmd_buffer, 0, 1, &viewport);
+		vkCmdSetScissor(cmd_buffer, 0, 1, &scissor);
+		vkCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, tr->layout,
+				0, 1, &map->tileset->set, 0, NULL);
+		vkCmdPushConstants(cmd_buffer, tr->layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push), &push);
+	}
+
+	for (uint32_t cy = cy0; cy <= cy1; cy++) {
+		for (uint32_t cx = cx0; cx <= cx1; cx++) {
+			OGTilemapChunk *chunk = &map->chunks[cy * map->chunks_x + cx];
+
+			if (chunk->pending && og_upload_done(og_ctx, chunk->upload)) {
+				chunk->shown = 1 - chunk->shown;
+				chunk->pending = false;
+			}
+
+			if (chunk->dirty && map->chunks_rebuilt < OG_TILEMAP_MAX_REBUILDS) {
+				map->chunks_rebuilt += __rebuild_chunk(og_ctx, map, cx, cy);
+			}
+
+			uint32_t count = chunk->counts[chunk->shown];
+			if (!ready || !count) {
+				continue;
+			}
+
+			// Only The Corner Changes Between Chunks
+			float origin[2] = { cx * chunk_size, cy * chunk_size };
+			VkDeviceSize offset = ((chunk->slot % OG_TILEMAP_PAGE_CHUNKS) * 2 + chunk->shown) * OG_TILEMAP_HALF_BYTES;
+
+			vkCmdPushConstants(cmd_buffer, tr->layout, VK_SHADER_STAGE_VERTEX_BIT,
+					offsetof(OGTilePush, origin), sizeof(origin), origin);
+			vkCmdBindVertexBuffers(cmd_buffer, 0, 1, &map->pages[chunk->slot / OG_TILEMAP_PAGE_CHUNKS].buffer, &offset);
+			vkCmdDraw(cmd_buffer, 6, count, 0, 0);
+
+			chunk->drawn[chunk->shown] = og_ctx->frame_number + 1;
+			map->chunks_drawn++;
+			map->tiles_drawn += count;
+		}
+	}
+}
@@ -0,0 +1,420 @@
+/* Author: Da Vinci
+ * This Code is in the Public Domain
+ */
+
+#include "origami/og_renderer.h"
+#include "origami/og_upload.h"
+#include "origami/common.h"
+
+// The Batch Currently Recording, Started On Demand
+OG_INT OGUploadBatch* __upload_batch(OGContext *og_ctx) {
+	OGUploader *up = &og_ctx->upload;
+	OGUploadBatch *batch = &up->batches[up->batch_idx];
+
+	if (batch->recording) {
+		return batch;
+	}
+
+	// The Slot Wraps Around Onto An Earlier Submission, Which Has To Finish First
+	if (batch->in_flight) {
+		og_upload_wait(og_ctx, batch->value);
+	}
+
+	OG_CHECK_VK(vkResetCommandPool(og_ctx->logical_device, batch->command_pool, 0), "Upload Pool Reset Failed");
+
+	VkCommandBufferBeginInfo cb_begin_info = {};
+	cb_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cb_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+	OG_CHECK_VK(vkBeginCommandBuffer(batch->cmd_buffer, &cb_begin_info), "Upload Command Buffer Begin Failed");
+
+	batch->value = ++up->last_value;
+	batch->ring_end = up->head;
+	batch->recording = true;
+	batch->copy_count = 0;
+	return batch;
+}
+
+// Copies data Into Staging Memory And Returns The Batch The Copy Must Be Recorded Into
+OG_INT OGUploadBatch* __upload_stage(OGContext *og_ctx, const void* data, VkDeviceSize size,
+		VkBuffer *src, VkDeviceSize *src_offset) {
+	OGUploader *up = &og_ctx->upload;
+
+	// Anything Over Half The Ring Would Stall It, Give It Its Own Staging Instead
+	if (size > up->ring_size / 2) {
+		OGBuffer staging = {};
+		if (!og_create_transient_buffer(og_ctx, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+					OG_MEMORY_CPU_ONLY, &staging)) {
+			OG_LOG_ERR("Upload Staging Creation Failed");
+			return NULL;
+		}
+		memcpy(staging.alloc.mapped, data, size);
+
+		OGUploadBatch *batch = __upload_batch(og_ctx);
+		if (batch->oversized_count == batch->oversized_capacity) {
+			batch->oversized_capacity = batch->oversized_capacity ? batch->oversized_capacity * 2 : 4;
+			batch->oversized = realloc(batch->oversized, sizeof(OGBuffer) * batch->oversized_capacity);
+		}
+		batch->oversized[batch->oversized_count++] = staging;
+
+		*src = staging.buffer;
+		*src_offset = 0;
+		return batch;
+	}
+
+	VkDeviceSize aligned = (size + OG_UPLOAD_ALIGN - 1) & ~(VkDeviceSize)(OG_UPLOAD_ALIGN - 1);
+	VkDeviceSize offset = 0;
+	VkDeviceSize pad = 0;
+
+	for (;;) {
+		// Never Split A Copy Across The End Of The Ring, Skip To The Start Instead
+		offset = up->head % up->ring_size;
+		pad = offset + aligned > up->ring_size ? up->ring_size - offset : 0;
+		if (up->head + pad + aligned - up->tail <= up->ring_size) {
+			break;
+		}
+
+		// Ring Is Full, Push Out What Is Recorded And Wait For The Oldest Batch
+		if (up->batches[up->batch_idx].recording) {
+			og_upload_flush(og_ctx);
+		}
+
+		OGUploadBatch *oldest = NULL;
+		for (uint32_t i = 0; i < OG_UPLOAD_BATCHES; i++) {
+			OGUploadBatch *batch = &up->batches[i];
+			if (batch->in_flight && (!oldest || batch->value < oldest->value)) {
+				oldest = batch;
+			}
+		}
+		if (!oldest) {
+			OG_LOG_ERR("Upload Ring Exhausted");
+			return NULL;
+		}
+		og_upload_wait(og_ctx, oldest->value);
+	}
+
+	up->head += pad;
+	offset = up->head % up->ring_size;
+	up->head += aligned;
+
+	memcpy((char*)up->ring.alloc.mapped + offset, data, size);
+
+	OGUploadBatch *batch = __upload_batch(og_ctx);
+	batch->ring_end = up->head;
+
+	*src = up->ring.buffer;
+	*src_offset = offset;
+	return batch;
+}
+
+// Releases Ring Space And Staging Held By Every Batch The GPU Has Finished
+OG_INT void __retire_uploads(OGContext *og_ctx) {
+	OGUploader *up = &og_ctx->upload;
+
+	OG_CHECK_VK(vkGetSemaphoreCounterValue(og_ctx->logical_device, up->timeline,
+				&up->completed), "Upload Timeline Query Failed");
+
+	for (uint32_t i = 0; i < OG_UPLOAD_BATCHES; i++) {
+		OGUploadBatch *batch = &up->batches[i];
+		if (!batch->in_flight || batch->value > up->completed) {
+			continue;
+		}
+
+		if (batch->ring_end > up->tail) {
+			up->tail = batch->ring_end;
+		}
+		for (uint32_t j = 0; j < batch->oversized_count; j++) {
+			og_destroy_buffer(og_ctx, &batch->oversized[j]);
+		}
+		batch->oversized_count = 0;
+		batch->in_flight = false;
+	}
+}
+
+// Bytes In One Tightly Packed Mip Level, Zero For Formats Uploads Don't Know
+OG_INT VkDeviceSize __image_level_size(VkFormat format, uint32_t width, uint32_t height) {
+	VkDeviceSize block_bytes = 0;
+	uint32_t block_dim = 1;
+
+	switch (format) {
+		case VK_FORMAT_R8_UNORM:
+			block_bytes = 1;
+			break;
+		case VK_FORMAT_R8G8_UNORM:
+			block_bytes = 2;
+			break;
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+			block_bytes = 4;
+			break;
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+		case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+		case VK_FORMAT_BC4_UNORM_BLOCK:
+		case VK_FORMAT_BC4_SNORM_BLOCK:
+			block_bytes = 8;
+			block_dim = 4;
+			break;
+		case VK_FORMAT_BC2_UNORM_BLOCK:
+		case VK_FORMAT_BC2_SRGB_BLOCK:
+		case VK_FORMAT_BC3_UNORM_BLOCK:
+		case VK_FORMAT_BC3_SRGB_BLOCK:
+		case VK_FORMAT_BC5_UNORM_BLOCK:
+		case VK_FORMAT_BC5_SNORM_BLOCK:
+		case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+		case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+		case VK_FORMAT_BC7_UNORM_BLOCK:
+		case VK_FORMAT_BC7_SRGB_BLOCK:
+			block_bytes = 16;
+			block_dim = 4;
+			break;
+		default:
+			return 0;
+	}
+
+	VkDeviceSize blocks_x = (width + block_dim - 1) / block_dim;
+	VkDeviceSize blocks_y = (height + block_dim - 1) / block_dim;
+	return blocks_x * blocks_y * block_bytes;
+}
+
+
+OG_INT void _create_uploader(OGContext *og_ctx, VkDeviceSize ring_size) {
+	OGUploader *up = &og_ctx->upload;
+	memset(up, 0, sizeof(OGUploader));
+
+	up->queue = og_ctx->transfer_queue;
+	up->family = og_ctx->transfer_idx;
+	up->families[0] = og_ctx->graphics_idx;
+	up->families[1] = og_ctx->transfer_idx;
+	up->concurrent = og_ctx->transfer_idx != og_ctx->graphics_idx;
+
+	VkSemaphoreTypeCreateInfo sem_type_info = {};
+	sem_type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+	sem_type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+	sem_type_info.initialValue = 0;
+
+	VkSemaphoreCreateInfo sem_create_info = {};
+	sem_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	sem_create_info.pNext = &sem_type_info;
+
+	OG_CHECK_VK(vkCreateSemaphore(og_ctx->logical_device, &sem_create_info,
+				NULL, &up->timeline), "Upload Timeline Creation Failed");
+
+	up->ring_size = ring_size;
+	if (!og_create_buffer(og_ctx, ring_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				OG_MEMORY_CPU_ONLY, &up->ring)) {
+		OG_LOG_ERR("Upload Ring Creation Failed");
+	}
+
+	VkCommandPoolCreateInfo pool_create_info = {};
+	pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+	pool_create_info.queueFamilyIndex = up->family;
+
+	VkCommandBufferAllocateInfo cmd_alloc_info = {};
+	cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	cmd_alloc_info.commandBufferCount = 1;
+	cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+	for (uint32_t i = 0; i < OG_UPLOAD_BATCHES; i++) {
+		OGUploadBatch *batch = &up->batches[i];
+
+		OG_CHECK_VK(vkCreateCommandPool(og_ctx->logical_device, &pool_create_info, NULL,
+					&batch->command_pool), "Upload Command Pool Creation Failed");
+
+		cmd_alloc_info.commandPool = batch->command_pool;
+		OG_CHECK_VK(vkAllocateCommandBuffers(og_ctx->logical_device,
+					&cmd_alloc_info, &batch->cmd_buffer), "Upload Command Buffer Allocation Failed");
+	}
+}
+
+OG_INT void _destroy_uploader(OGContext *og_ctx) {
+	OGUploader *up = &og_ctx->upload;
+
+	for (uint32_t i = 0; i < OG_UPLOAD_BATCHES; i++) {
+		OGUploadBatch *batch = &up->batches[i];
+
+		for (uint32_t j = 0; j < batch->oversized_count; j++) {
+			og_destroy_buffer(og_ctx, &batch->oversized[j]);
+		}
+		free(batch->oversized);
+		vkDestroyCommandPool(og_ctx->logical_device, batch->command_pool, NULL);
+	}
+
+	og_destroy_buffer(og_ctx, &up->ring);
+	vkDestroySemaphore(og_ctx->logical_device, up->timeline, NULL);
+}
+
+
+// dst Must Be Shareable With The Upload Queue, See OGUploader.concurrent
+OG_API OGUploadToken og_upload_buffer(OGContext *og_ctx, VkBuffer dst, VkDeviceSize dst_offset,
+		const void* data, VkDeviceSize size) {
+	VkBuffer src = VK_NULL_HANDLE;
+	VkDeviceSize src_offset = 0;
+
+	OGUploadBatch *batch = __upload_stage(og_ctx, data, size, &src, &src_offset);
+	if (!batch) {
+		return 0;
+	}
+
+	VkBufferCopy copy_region = {};
+	copy_region.srcOffset = src_offset;
+	copy_region.dstOffset = dst_offset;
+	copy_region.size = size;
+
+	vkCmdCopyBuffer(batch->cmd_buffer, src, dst, 1, &copy_region);
+	batch->copy_count++;
+	return batch->value;
+}
+
+// Takes The Whole Image From UNDEFINED To SHADER_READ_ONLY, RGBA8 Texels Expected
+OG_API OGUploadToken og_upload_image(OGContext *og_ctx, VkImage dst, uint32_t width, uint32_t height,
+		const void* rgba) {
+	return og_upload_image_mips(og_ctx, dst, VK_FORMAT_R8G8B8A8_UNORM, width, height, 1, rgba);
+}
+
+// data Holds Every Level Largest First, Each Tightly Packed, See __image_level_size.
+// It Is Staged With A Single Copy, So It Can Point Straight Into A Mapped Pack
+OG_API OGUploadToken og_upload_image_mips(OGContext *og_ctx, VkImage dst, VkFormat format,
+		uint32_t width, uint32_t height, uint32_t mip_levels, const void* data) {
+	VkBufferImageCopy copy_regions[OG_UPLOAD_MAX_MIPS] = {};
+	if (mip_levels == 0 || mip_levels > OG_UPLOAD_MAX_MIPS) {
+		OG_LOG_ERR("Upload Mip Count Out Of Range");
+		return 0;
+	}
+
+	VkDeviceSize size = 0;
+	for (uint32_t i = 0; i < mip_levels; i++) {
+		uint32_t level_w = width >> i ? width >> i : 1;
+		uint32_t level_h = height >> i ? height >> i : 1;
+		VkDeviceSize level_size = __image_level_size(format, level_w, level_h);
+		if (!level_size) {
+			OG_LOG_ERR("Upload Image Format Not Supported");
+			return 0;
+		}
+
+		copy_regions[i].bufferOffset = size;
+		copy_regions[i].imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		copy_regions[i].imageSubresource.mipLevel = i;
+		copy_regions[i].imageSubresource.layerCount = 1;
+		copy_regions[i].imageExtent.width = level_w;
+		copy_regions[i].imageExtent.height = level_h;
+		copy_regions[i].imageExtent.depth = 1;
+		size += level_size;
+	}
+
+	VkBuffer src = VK_NULL_HANDLE;
+	VkDeviceSize src_offset = 0;
+
+	OGUploadBatch *batch = __upload_stage(og_ctx, data, size, &src, &src_offset);
+	if (!batch) {
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < mip_levels; i++) {
+		copy_regions[i].bufferOffset += src_offset;
+	}
+
+	VkImageMemoryBarrier img_barrier = {};
+	img_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	img_barrier.srcAccessMask = 0;
+	img_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	img_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	img_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	img_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	img_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	img_barrier.image = dst;
+	img_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	img_barrier.subresourceRange.levelCount = mip_levels;
+	img_barrier.subresourceRange.layerCount = 1;
+
+	vkCmdPipelineBarrier(batch->cmd_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0, 0, NULL, 0, NULL, 1, &img_barrier);
+
+	vkCmdCopyBufferToImage(batch->cmd_buffer, src, dst,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mip_levels, copy_regions);
+
+	// Transfer Queues Know No Shader Stages, The Graphics Side Picks The
+	// Writes Up Through The Timeline Wait In og_render
+	img_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	img_barrier.dstAccessMask = 0;
+	img_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	img_barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+	vkCmdPipelineBarrier(batch->cmd_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			0, 0, NULL, 0, NULL, 1, &img_barrier);
+
+	batch->copy_count++;
+	return batch->value;
+}
+
+// Submits Everything Recorded So Far In One Go, og_render Calls This Every Frame
+OG_API OGUploadToken og_upload_flush(OGContext *og_ctx) {
+	OGUploader *up = &og_ctx->upload;
+	OGUploadBatch *batch = &up->batches[up->batch_idx];
+
+	if (!batch->recording) {
+		return up->submitted;
+	}
+
+	OG_CHECK_VK(vkEndCommandBuffer(batch->cmd_buffer), "Upload Command Buffer End Failed");
+
+	VkTimelineSemaphoreSubmitInfo timeline_info = {};
+	timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timeline_info.signalSemaphoreValueCount = 1;
+	timeline_info.pSignalSemaphoreValues = &batch->value;
+
+	VkSubmitInfo submit_info = {};
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = &timeline_info;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &batch->cmd_buffer;
+	submit_info.signalSemaphoreCount = 1;
+	submit_info.pSignalSemaphores = &up->timeline;
+
+	OG_CHECK_VK(vkQueueSubmit(up->queue, 1, &submit_info, 0), "Upload Submit Failed");
+
+	batch->recording = false;
+	batch->in_flight = true;
+	up->submitted = batch->value;
+	up->batch_idx = (up->batch_idx + 1) % OG_UPLOAD_BATCHES;
+	return batch->value;
+}
+
+// Never Blocks, Tokens Still Recording Only Complete After The Next Flush
+OG_API bool og_upload_done(OGContext *og_ctx, OGUploadToken token) {
+	OGUploader *up = &og_ctx->upload;
+
+	if (token <= up->completed) {
+		return true;
+	}
+	if (token > up->submitted) {
+		return false;
+	}
+
+	__retire_uploads(og_ctx);
+	return token <= up->completed;
+}
+
+OG_API void og_upload_wait(OGContext *og_ctx, OGUploadToken token) {
+	OGUploader *up = &og_ctx->upload;
+
+	if (token <= up->completed) {
+		return;
+	}
+	if (token > up->submitted) {
+		og_upload_flush(og_ctx);
+	}
+
+	VkSemaphoreWaitInfo wait_info = {};
+	wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+	wait_info.semaphoreCount = 1;
+	wait_info.pSemaphores = &up->timeline;
+	wait_info.pValues = &token;
+
+	OG_CHECK_VK(vkWaitSemaphores(og_ctx->logical_device, &wait_info, UINT64_MAX), "Upload Wait Failed");
+	__retire_uploads(og_ctx);
+}
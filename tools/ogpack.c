@@ -0,0 +1,343 @@
+#include "origami/og_renderer.h"
+
+#include <math.h>
+
+// Builds An Asset Pack For og_open_pack. Each Input Is name=path, Typed By Extension:
+//   .pam / .ppm  Texture, Baked To RGBA8 With A Full Box Filtered Mip Chain
+//   .spv         SPIR-V Shader Module
+//   Anything Else Is Stored As An Opaque Blob
+//
+// Usage: ogpack out.ogpk [--srgb] name=path ...
+//   --srgb Stores The Textures That Follow As sRGB And Filters Their Mips In Linear
+
+typedef struct {
+	OGPackEntry entry;
+	const char* name;
+} Input;
+
+bool read_file(const char* path, uint8_t **data, size_t *size);
+const char* netpbm_token(const uint8_t *data, size_t size, size_t *pos, char *token, size_t token_size);
+uint8_t* read_netpbm(const uint8_t *data, size_t size, uint32_t *width, uint32_t *height);
+uint8_t* bake_mips(const uint8_t *rgba, uint32_t width, uint32_t height, bool srgb,
+		uint32_t *mip_levels, size_t *size);
+float srgb_to_linear(uint8_t c);
+uint8_t linear_to_srgb(float v);
+bool has_extension(const char* path, const char* ext);
+bool write_padded(FILE *file, const void* data, size_t size, uint64_t *offset, uint32_t align);
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		printf("Usage: %s out.ogpk [--srgb] name=path ...\n", argv[0]);
+		return 1;
+	}
+
+	FILE *file = fopen(argv[1], "wb");
+	if (!file) {
+		printf("[ERROR]: Could Not Create %s\n", argv[1]);
+		return 1;
+	}
+
+	Input *inputs = calloc(argc, sizeof(Input));
+	uint32_t count = 0;
+	bool srgb = false;
+
+	// The Header Goes In Last, Once Every Offset Is Known
+	OGPackHeader header = {};
+	uint64_t offset = 0;
+	write_padded(file, &header, sizeof(header), &offset, OG_PACK_ALIGN);
+
+	for (int i = 2; i < argc; i++) {
+		if (!strcmp(argv[i], "--srgb")) {
+			srgb = true;
+			continue;
+		}
+
+		char *path = strchr(argv[i], '=');
+		if (!path) {
+			printf("[ERROR]: Expected name=path, Got %s\n", argv[i]);
+			return 1;
+		}
+		*path++ = '\0';
+
+		uint8_t *data = NULL;
+		size_t size = 0;
+		if (!read_file(path, &data, &size)) {
+			printf("[ERROR]: Could Not Read %s\n", path);
+			return 1;
+		}
+
+		Input *input = &inputs[count++];
+		input->name = argv[i];
+		input->entry.hash = __fnv1a(OG_FNV_OFFSET, input->name, strlen(input->name));
+		input->entry.type = OG_PACK_BLOB;
+
+		if (has_extension(path, ".pam") || has_extension(path, ".ppm")) {
+			uint32_t width = 0, height = 0;
+			uint8_t *rgba = read_netpbm(data, size, &width, &height);
+			if (!rgba) {
+				printf("[ERROR]: %s Is Not An 8 Bit PAM Or PPM\n", path);
+				return 1;
+			}
+
+			free(data);
+			data = bake_mips(rgba, width, height, srgb, &input->entry.mip_levels, &size);
+			free(rgba);
+
+			input->entry.type = OG_PACK_TEXTURE;
+			input->entry.format = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+			input->entry.width = width;
+			input->entry.height = height;
+		} else if (has_extension(path, ".spv")) {
+			if (size % 4) {
+				printf("[ERROR]: %s Is Not SPIR-V\n", path);
+				return 1;
+			}
+			input->entry.type = OG_PACK_SHADER;
+		}
+
+		input->entry.offset = offset;
+		input->entry.size = size;
+		write_padded(file, data, size, &offset, OG_PACK_ALIGN);
+		free(data);
+	}
+
+	// Names Go Last So The File Ends On A NUL, Which The Reader Checks
+	uint32_t names_size = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		inputs[i].entry.name = names_size;
+		names_size += (uint32_t)strlen(inputs[i].name) + 1;
+	}
+
+	uint32_t slot_count = 16;
+	while (slot_count < count * 2) {
+		slot_count *= 2;
+	}
+
+	uint32_t *slots = malloc(slot_count * sizeof(uint32_t));
+	memset(slots, 0xFF, slot_count * sizeof(uint32_t));
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t slot = (uint32_t)inputs[i].entry.hash & (slot_count - 1);
+		while (slots[slot] != OG_PACK_EMPTY) {
+			OGPackEntry *other = &inputs[slots[slot]].entry;
+			if (other->hash == inputs[i].entry.hash && !strcmp(inputs[slots[slot]].name, inputs[i].name)) {
+				printf("[ERROR]: %s Is In The Pack Twice\n", inputs[i].name);
+				return 1;
+			}
+			slot = (slot + 1) & (slot_count - 1);
+		}
+		slots[slot] = i;
+	}
+
+	header.magic = OG_PACK_MAGIC;
+	header.version = OG_PACK_VERSION;
+	header.entry_count = count;
+	header.slot_count = slot_count;
+
+	header.entries_offset = offset;
+	for (uint32_t i = 0; i < count; i++) {
+		write_padded(file, &inputs[i].entry, sizeof(OGPackEntry), &offset, 1);
+	}
+	header.slots_offset = offset;
+	write_padded(file, slots, slot_count * sizeof(uint32_t), &offset, 1);
+	header.names_offset = offset;
+	for (uint32_t i = 0; i < count; i++) {
+		write_padded(file, inputs[i].name, strlen(inputs[i].name) + 1, &offset, 1);
+	}
+	header.file_size = offset;
+
+	fseek(file, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, file);
+
+	if (fclose(file) != 0) {
+		printf("[ERROR]: Could Not Write %s\n", argv[1]);
+		return 1;
+	}
+
+	printf("[INFO]: %u Entries, %llu Bytes\n", count, (unsigned long long)header.file_size);
+	free(slots);
+	free(inputs);
+	return 0;
+}
+
+bool read_file(const char* path, uint8_t **data, size_t *size) {
+	FILE *file = fopen(path, "rb");
+	if (!file) {
+		return false;
+	}
+
+	fseek(file, 0, SEEK_END);
+	*size = (size_t)ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	*data = malloc(*size ? *size : 1);
+	bool ok = fread(*data, 1, *size, file) == *size;
+	fclose(file);
+	return ok;
+}
+
+// Skips Whitespace And # Comments, Then Reads One Header Token
+const char* netpbm_token(const uint8_t *data, size_t size, size_t *pos, char *token, size_t token_size) {
+	while (*pos < size) {
+		if (data[*pos] == '#') {
+			while (*pos < size && data[*pos] != '\n') {
+				(*pos)++;
+			}
+		} else if (data[*pos] == ' ' || data[*pos] == '\t' || data[*pos] == '\r' || data[*pos] == '\n') {
+			(*pos)++;
+		} else {
+			break;
+		}
+	}
+
+	size_t len = 0;
+	while (*pos < size && len + 1 < token_size && data[*pos] > ' ') {
+		token[len++] = (char)data[(*pos)++];
+	}
+	token[len] = '\0';
+	return token;
+}
+
+// P6 (RGB) Or P7 With DEPTH 3 Or 4, MAXVAL 255, Returned As RGBA8
+uint8_t* read_netpbm(const uint8_t *data, size_t size, uint32_t *width, uint32_t *height) {
+	char token[64];
+	size_t pos = 0;
+	uint32_t depth = 3, maxval = 0;
+
+	netpbm_token(data, size, &pos, token, sizeof(token));
+	if (!strcmp(token, "P6")) {
+		*width = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+		*height = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+		maxval = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+	} else if (!strcmp(token, "P7")) {
+		for (;;) {
+			netpbm_token(data, size, &pos, token, sizeof(token));
+			if (!token[0] || !strcmp(token, "ENDHDR")) {
+				break;
+			}
+			if (!strcmp(token, "WIDTH")) {
+				*width = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+			} else if (!strcmp(token, "HEIGHT")) {
+				*height = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+			} else if (!strcmp(token, "DEPTH")) {
+				depth = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+			} else if (!strcmp(token, "MAXVAL")) {
+				maxval = (uint32_t)atoi(netpbm_token(data, size, &pos, token, sizeof(token)));
+			} else if (!strcmp(token, "TUPLTYPE")) {
+				netpbm_token(data, size, &pos, token, sizeof(token));
+			}
+		}
+	} else {
+		return NULL;
+	}
+
+	// Exactly One Whitespace Byte Between The Header And The Samples
+	pos++;
+	if (!*width || !*height || maxval != 255 || (depth != 3 && depth != 4) ||
+			pos > size || (size_t)*width * *height * depth > size - pos) {
+		return NULL;
+	}
+
+	size_t texels = (size_t)*width * *height;
+	uint8_t *rgba = malloc(texels * 4);
+	for (size_t i = 0; i < texels; i++) {
+		const uint8_t *src = data + pos + i * depth;
+		rgba[i * 4 + 0] = src[0];
+		rgba[i * 4 + 1] = src[1];
+		rgba[i * 4 + 2] = src[2];
+		rgba[i * 4 + 3] = depth == 4 ? src[3] : 255;
+	}
+	return rgba;
+}
+
+float srgb_to_linear(uint8_t c) {
+	float v = c / 255.0f;
+	return v <= 0.04045f ? v / 12.92f : powf((v + 0.055f) / 1.055f, 2.4f);
+}
+
+uint8_t linear_to_srgb(float v) {
+	v = v <= 0.0031308f ? v * 12.92f : 1.055f * powf(v, 1.0f / 2.4f) - 0.055f;
+	return (uint8_t)(fminf(fmaxf(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+// Every Level Down To 1x1, Largest First And Tightly Packed, As og_upload_image_mips Expects.
+// Odd Sizes Fold The Last Row Or Column Into The One Before
+uint8_t* bake_mips(const uint8_t *rgba, uint32_t width, uint32_t height, bool srgb,
+		uint32_t *mip_levels, size_t *size) {
+	uint32_t levels = 1;
+	while ((width >> levels) || (height >> levels)) {
+		levels++;
+	}
+	if (levels > OG_UPLOAD_MAX_MIPS) {
+		levels = OG_UPLOAD_MAX_MIPS;
+	}
+
+	size_t total = 0;
+	for (uint32_t m = 0; m < levels; m++) {
+		total += __image_level_size(VK_FORMAT_R8G8B8A8_UNORM, width >> m ? width >> m : 1, height >> m ? height >> m : 1);
+	}
+
+	uint8_t *out = malloc(total);
+	memcpy(out, rgba, (size_t)width * height * 4);
+
+	uint8_t *src = out;
+	uint32_t src_w = width, src_h = height;
+	for (uint32_t m = 1; m < levels; m++) {
+		uint32_t dst_w = src_w > 1 ? src_w / 2 : 1;
+		uint32_t dst_h = src_h > 1 ? src_h / 2 : 1;
+		uint8_t *dst = src + (size_t)src_w * src_h * 4;
+
+		for (uint32_t y = 0; y < dst_h; y++) {
+			for (uint32_t x = 0; x < dst_w; x++) {
+				uint32_t x0 = x * 2, y0 = y * 2;
+				uint32_t x1 = x == dst_w - 1 ? src_w : x0 + 2;
+				uint32_t y1 = y == dst_h - 1 ? src_h : y0 + 2;
+				x1 = x1 > x0 + 1 ? x1 : x0 + 1;
+				y1 = y1 > y0 + 1 ? y1 : y0 + 1;
+
+				float sum[4] = {};
+				for (uint32_t sy = y0; sy < y1; sy++) {
+					for (uint32_t sx = x0; sx < x1; sx++) {
+						const uint8_t *texel = src + ((size_t)sy * src_w + sx) * 4;
+						for (uint32_t c = 0; c < 3; c++) {
+							sum[c] += srgb ? srgb_to_linear(texel[c]) : texel[c] / 255.0f;
+						}
+						sum[3] += texel[3] / 255.0f;
+					}
+				}
+
+				float inv = 1.0f / (float)((x1 - x0) * (y1 - y0));
+				uint8_t *texel = dst + ((size_t)y * dst_w + x) * 4;
+				for (uint32_t c = 0; c < 3; c++) {
+					texel[c] = srgb ? linear_to_srgb(sum[c] * inv) : (uint8_t)(sum[c] * inv * 255.0f + 0.5f);
+				}
+				texel[3] = (uint8_t)(sum[3] * inv * 255.0f + 0.5f);
+			}
+		}
+
+		src = dst;
+		src_w = dst_w;
+		src_h = dst_h;
+	}
+
+	*mip_levels = levels;
+	*size = total;
+	return out;
+}
+
+bool has_extension(const char* path, const char* ext) {
+	size_t len = strlen(path), ext_len = strlen(ext);
+	return len >= ext_len && !strcmp(path + len - ext_len, ext);
+}
+
+// Writes data And Zero Pads Up To The Next Multiple Of align
+bool write_padded(FILE *file, const void* data, size_t size, uint64_t *offset, uint32_t align) {
+	static const uint8_t zeros[OG_PACK_ALIGN] = {};
+
+	bool ok = fwrite(data, 1, size, file) == size;
+	*offset += size;
+
+	uint32_t pad = (uint32_t)((align - *offset % align) % align);
+	ok = ok && fwrite(zeros, 1, pad, file) == pad;
+	*offset += pad;
+	return ok;
+}